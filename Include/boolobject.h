@@ -12,7 +12,7 @@ PyAPI_DATA(PyTypeObject) PyBool_Type;
 #ifdef BITPACKED
 #define PyBool_Check(x) (BITPACKED_TYPEID(x) == BITPACKED_TYPEID_BOOL)
 #define Py_False ((PyObject *)(BITPACKED_TYPEID_BOOL))
-#define Py_True ((PyObject *)(BITPACKED_TYPEID_BOOL | (1UL << 32)))
+#define Py_True ((PyObject *)(BITPACKED_TYPEID_BOOL | (1UL << BITPACKED_LONG_SHIFT)))
 #else
 #define PyBool_Check(x) (Py_TYPE(x) == &PyBool_Type)
 
@@ -35,8 +35,36 @@ typedef struct {
 				   Objects/lnotab_notes.txt for details. */
     void *co_zombieframe;     /* for optimization only (see frameobject.c) */
     PyObject *co_weakreflist;   /* to support weakrefs to code objects */
+    struct _globalcache *co_globalcache; /* LOAD_GLOBAL results, see below */
+    int co_warmth;              /* entries and loop iterations so far */
+    unsigned char *co_quickened; /* specialized copy of co_code, or NULL */
+    struct _attrcache *co_attrcache; /* LOAD_ATTR guards, see below */
 } PyCodeObject;
 
+/* LOAD_GLOBAL caches the object it found for each name of co_names, along
+   with the versions of the globals and builtins dicts it was looked up
+   in.  The entry is valid while both versions are unchanged, and then the
+   dicts still hold a reference to the object.  The array is allocated
+   on the first lookup; zeroed entries never match. */
+typedef struct _globalcache {
+    PY_UINT64_T gc_globals_version;
+    PY_UINT64_T gc_builtins_version;
+    PyObject *gc_value;         /* borrowed */
+} _PyCodeGlobalCache;
+
+/* Once co_warmth reaches a threshold, frames of the code object run
+   co_quickened, a copy of co_code whose LOAD_ATTR, LOAD_GLOBAL, COMPARE_OP
+   and BINARY_ADD sites rewrite themselves to specialized forms and back
+   (see ceval.c).  The copy keeps the layout of co_code, so offsets and
+   line numbers are the same.  For each name of co_names, co_attrcache
+   holds the type that LOAD_ATTR_INSTANCE_DICT expects and its version
+   tag; the type is only compared, not referenced. */
+typedef struct _attrcache {
+    PyTypeObject *ac_type;      /* borrowed */
+    unsigned int ac_type_version;
+    int ac_specialize;          /* 0 if LOAD_ATTR should not try for ac_type */
+} _PyCodeAttrCache;
+
 /* Masks for co_flags above */
 #define CO_OPTIMIZED	0x0001
 #define CO_NEWLOCALS	0x0002
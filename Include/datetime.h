@@ -112,11 +112,36 @@ typedef struct
 } PyDateTime_DateTime;          /* hastzinfo true */
 
 
+#ifdef BITPACKED
+/* Exact date objects, time objects without a tzinfo and timedelta objects
+ * of -2**21 <= days < 2**21 are tagged values (BITPACKED_TYPEID_DATE, _TIME
+ * and _DELTA).  Above the type id the word holds, from the top down,
+ *
+ *   date:      year (14 bits), month (4), day (5)
+ *   time:      hour (5), minute (6), second (6), microsecond (20)
+ *   timedelta: days (22, signed), seconds (17), microseconds (20)
+ *
+ * so that two tagged values of a type compare like their words.  The
+ * accessors below read both forms; they are not lvalues in this mode.
+ */
+#define _PyDateTime_TAGGED(o, lsb, bits) \
+    ((int)(((BITPACKED_UWORD)(o) >> (5 + (lsb))) & ((1U << (bits)) - 1)))
+#define _PyDateTime_FIELD(o, lsb, bits, boxed) \
+    (BITPACKED_CHECK(o) ? _PyDateTime_TAGGED(o, lsb, bits) : (boxed))
+#define _PyDateTime_DELTA_DAYS(o, boxed) \
+    (BITPACKED_CHECK(o) ? (int)((BITPACKED_SWORD)(o) >> 42) : (boxed))
+#else
+#define _PyDateTime_FIELD(o, lsb, bits, boxed) (boxed)
+#define _PyDateTime_DELTA_DAYS(o, boxed) (boxed)
+#endif
+
 /* Apply for date and datetime instances. */
-#define PyDateTime_GET_YEAR(o)     ((((PyDateTime_Date*)o)->data[0] << 8) | \
-                     ((PyDateTime_Date*)o)->data[1])
-#define PyDateTime_GET_MONTH(o)    (((PyDateTime_Date*)o)->data[2])
-#define PyDateTime_GET_DAY(o)      (((PyDateTime_Date*)o)->data[3])
+#define PyDateTime_GET_YEAR(o)     _PyDateTime_FIELD(o, 9, 14,          \
+    (((PyDateTime_Date*)o)->data[0] << 8) | ((PyDateTime_Date*)o)->data[1])
+#define PyDateTime_GET_MONTH(o)    _PyDateTime_FIELD(o, 5, 4,           \
+    ((PyDateTime_Date*)o)->data[2])
+#define PyDateTime_GET_DAY(o)      _PyDateTime_FIELD(o, 0, 5,           \
+    ((PyDateTime_Date*)o)->data[3])
 
 #define PyDateTime_DATE_GET_HOUR(o)        (((PyDateTime_DateTime*)o)->data[4])
 #define PyDateTime_DATE_GET_MINUTE(o)      (((PyDateTime_DateTime*)o)->data[5])
@@ -127,19 +152,24 @@ typedef struct
       ((PyDateTime_DateTime*)o)->data[9])
 
 /* Apply for time instances. */
-#define PyDateTime_TIME_GET_HOUR(o)        (((PyDateTime_Time*)o)->data[0])
-#define PyDateTime_TIME_GET_MINUTE(o)      (((PyDateTime_Time*)o)->data[1])
-#define PyDateTime_TIME_GET_SECOND(o)      (((PyDateTime_Time*)o)->data[2])
-#define PyDateTime_TIME_GET_MICROSECOND(o)              \
-    ((((PyDateTime_Time*)o)->data[3] << 16) |           \
-     (((PyDateTime_Time*)o)->data[4] << 8)  |           \
-      ((PyDateTime_Time*)o)->data[5])
+#define PyDateTime_TIME_GET_HOUR(o)        _PyDateTime_FIELD(o, 32, 5,  \
+    ((PyDateTime_Time*)o)->data[0])
+#define PyDateTime_TIME_GET_MINUTE(o)      _PyDateTime_FIELD(o, 26, 6,  \
+    ((PyDateTime_Time*)o)->data[1])
+#define PyDateTime_TIME_GET_SECOND(o)      _PyDateTime_FIELD(o, 20, 6,  \
+    ((PyDateTime_Time*)o)->data[2])
+#define PyDateTime_TIME_GET_MICROSECOND(o) _PyDateTime_FIELD(o, 0, 20,  \
+    (((PyDateTime_Time*)o)->data[3] << 16) |            \
+    (((PyDateTime_Time*)o)->data[4] << 8)  |            \
+     ((PyDateTime_Time*)o)->data[5])
 
 /* Apply for time delta instances */
-#define PyDateTime_DELTA_GET_DAYS(o)         (((PyDateTime_Delta*)o)->days)
-#define PyDateTime_DELTA_GET_SECONDS(o)      (((PyDateTime_Delta*)o)->seconds)
-#define PyDateTime_DELTA_GET_MICROSECONDS(o)            \
-    (((PyDateTime_Delta*)o)->microseconds)
+#define PyDateTime_DELTA_GET_DAYS(o)         _PyDateTime_DELTA_DAYS(o, \
+    ((PyDateTime_Delta*)o)->days)
+#define PyDateTime_DELTA_GET_SECONDS(o)      _PyDateTime_FIELD(o, 20, 17, \
+    ((PyDateTime_Delta*)o)->seconds)
+#define PyDateTime_DELTA_GET_MICROSECONDS(o) _PyDateTime_FIELD(o, 0, 20, \
+    ((PyDateTime_Delta*)o)->microseconds)
 
 
 /* Define structure for C API. */
@@ -23,6 +23,10 @@ typedef struct _dictkeysobject PyDictKeysObject;
 typedef struct {
     PyObject_HEAD
     Py_ssize_t ma_used;
+    /* Taken from a global counter on creation and on every change of the
+       mapping, so it is never 0 and no two dicts share a version.  Resizes
+       keep it. */
+    PY_UINT64_T ma_version_tag;
     PyDictKeysObject *ma_keys;
     PyObject **ma_values;
 } PyDictObject;
@@ -143,6 +147,9 @@ PyAPI_FUNC(void) _PyDict_DebugMallocStats(FILE *out);
 
 int _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr, PyObject *name, PyObject *value);
 PyObject *_PyDict_LoadGlobal(PyDictObject *, PyDictObject *, PyObject *);
+#ifdef BITPACKED_COMPACT_HEADER
+PyAPI_FUNC(void) _PyDict_InitDummy(void);
+#endif
 #endif
 
 #ifdef __cplusplus
@@ -19,7 +19,11 @@ typedef struct {
 #endif
 
 #ifdef BITPACKED
-#define BITPACKED_FLOAT_CHECK(ob) (((BITPACKED_UWORD)(ob) & 0x000eULL) == (BITPACKED_TYPEID_FLOAT & 0x000eULL))
+/* type ids FLOAT, FLOAT_RSV, FLOAT_WIDE and FLOAT_WIDE_RSV */
+#define BITPACKED_FLOAT_IDMASK \
+    ((1UL << BITPACKED_TYPEID_FLOAT) | (1UL << BITPACKED_TYPEID_FLOAT_RSV) | \
+     (1UL << BITPACKED_TYPEID_FLOAT_WIDE) | (1UL << BITPACKED_TYPEID_FLOAT_WIDE_RSV))
+#define BITPACKED_FLOAT_CHECK(ob) ((BITPACKED_FLOAT_IDMASK >> BITPACKED_TYPEID(ob)) & 1)
 #else
 #define BITPACKED_FLOAT_CHECK(ob) 0
 #endif
@@ -59,8 +63,45 @@ PyAPI_FUNC(double) PyFloat_AsDouble(PyObject *);
 #ifdef BITPACKED
 PyAPI_FUNC(double) _bitpacked_float_as_double(void*);
 #define PyFloat_AS_DOUBLE(op) (BITPACKED_CHECK(op) \
-                              ?_bitpacked_float_as_double(op) \
+                              ?_PyBitpacked_FloatValue(op) \
                               :((PyFloatObject *)(op))->ob_fval)
+
+/* Value of a tagged float; the two layouts are described in floatobject.c.
+ * _bitpacked_float_as_double() is the same as a function.
+ */
+Py_LOCAL_INLINE(double)
+_PyBitpacked_FloatValue(const void *op)
+{
+    union { double d; BITPACKED_UWORD u; } bits;
+    BITPACKED_UWORD x = (BITPACKED_UWORD)op;
+    if (x & 4) {    /* FLOAT_WIDE */
+        BITPACKED_UWORD e = (x >> 56) & 0x7F;
+        e += (e & 0x40) + 928;
+        bits.u = (x & 0x8000000000000000ULL) | (e << 52)
+            | ((x & 0x00FFFFFFFFFFFFE0ULL) >> 4) | ((x >> 1) & 1);
+    }
+    else {
+        bits.u = (x & 0xC000000000000000ULL)
+            | ((x & 0x2000000000000000ULL) ? 0x3E00000000000000ULL : 0)
+            | ((x >> 4) & 0x03FFFFFFFFFFFFFFULL);
+    }
+    return bits.d;
+}
+
+/* True when v and w are both tagged ints or floats and at least one of
+ * them is a float.  float op int converts the int to double first, so
+ * the result is the double operation on _PyBitpacked_NumberValue()s.
+ */
+#define BITPACKED_NUMBER_IDMASK \
+    (BITPACKED_FLOAT_IDMASK | (1UL << BITPACKED_TYPEID_LONG))
+#define BITPACKED_FLOAT_OPERANDS(v, w)                      \
+    ((BITPACKED_NUMBER_IDMASK >> BITPACKED_TYPEID(v)) &     \
+     (BITPACKED_NUMBER_IDMASK >> BITPACKED_TYPEID(w)) & 1   \
+     && !(BITPACKED_LONG_CHECKEXACT(v) && BITPACKED_LONG_CHECKEXACT(w)))
+#define _PyBitpacked_NumberValue(ob)                        \
+    (BITPACKED_LONG_CHECKEXACT(ob)                          \
+     ? (double)BITPACKED_LONG_VALUE(ob)                     \
+     : _PyBitpacked_FloatValue(ob))
 #else
 #define PyFloat_AS_DOUBLE(op) (((PyFloatObject *)(op))->ob_fval)
 #endif
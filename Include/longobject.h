@@ -5,28 +5,29 @@ extern "C" {
 #endif
 
 #ifdef BITPACKED
-typedef union{
-    struct{
-#if PY_LITTLE_ENDIAN
-        int reserved;
-        int value;
-#else
-        int value;
-        int reserved;
-#endif
-    };
-    BITPACKED_UWORD uword;
-    PyObject* pyobj;
-    /* rangeobject* rangeobj; */
-} bitpacked_longobject;
+/* A bitpacked int keeps its value in the upper 59 bits of the word and
+ * the 5-bit type ID below it, so any value in
+ * [BITPACKED_LONG_MIN, BITPACKED_LONG_MAX] (about +-2.9e17) is unboxed.
+ */
+#define BITPACKED_LONG_SHIFT 5
+#define BITPACKED_LONG_BITS (64 - BITPACKED_LONG_SHIFT)
+#define BITPACKED_LONG_MAX ((long)((1ULL << (BITPACKED_LONG_BITS - 1)) - 1))
+#define BITPACKED_LONG_MIN (-BITPACKED_LONG_MAX - 1)
 #define BITPACKED_LONG_CHECKEXACT(ob) (BITPACKED_TYPEID(ob) == BITPACKED_TYPEID_LONG)
 /* BITPACKED_LONG_CHECK() accepts bitpacked-bool objects as kind of long objects */
 #define BITPACKED_LONG_CHECK(ob) (((BITPACKED_UWORD)(ob) & 0x000eULL) == (BITPACKED_TYPEID_LONG & 0x000eULL))
-#define BITPACKED_LONG_VALUE(ob) (((bitpacked_longobject*)&(ob))->value)
+#define BITPACKED_LONG_VALUE(ob) ((long)((BITPACKED_SWORD)(ob) >> BITPACKED_LONG_SHIFT))
+/* ival must satisfy BITPACKED_LONG_RANGE_CHECK() */
+#define BITPACKED_LONG_PACK(ival) \
+    ((PyObject*)(((BITPACKED_UWORD)(ival) << BITPACKED_LONG_SHIFT) | BITPACKED_TYPEID_LONG))
+#define BITPACKED_LONG_RANGE_CHECK(ival) \
+    (BITPACKED_LONG_MIN <= (ival) && (ival) <= BITPACKED_LONG_MAX)
 #else
+#define BITPACKED_LONG_BITS 0
 #define BITPACKED_LONG_CHECKEXACT(ob) 0
 #define BITPACKED_LONG_CHECK(ob) 0
 #define BITPACKED_LONG_VALUE(ob) (abort(), 0)
+#define BITPACKED_LONG_RANGE_CHECK(ival) 0
 #endif
 
 /* Long (arbitrary precision) integer object interface */
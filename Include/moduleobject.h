@@ -41,13 +41,14 @@ typedef struct PyModuleDef_Base {
   PyObject* (*m_init)(void);
   Py_ssize_t m_index;
   PyObject* m_copy;
-} PyModuleDef_Base;
+} BITPACKED_ALIGNED PyModuleDef_Base;
 
-#define PyModuleDef_HEAD_INIT { \
-    PyObject_HEAD_INIT(NULL)    \
-    NULL, /* m_init */          \
-    0,    /* m_index */         \
-    NULL, /* m_copy */          \
+#define PyModuleDef_HEAD_INIT {          \
+    { _PyObject_EXTRA_INIT               \
+    1, _PyObject_TYPE_INIT_NULL },       \
+    NULL, /* m_init */                   \
+    0,    /* m_index */                  \
+    NULL, /* m_copy */                   \
   }
 
 struct PyModuleDef_Slot;
@@ -22,6 +22,14 @@ typedef signed long long BITPACKED_SWORD;
 typedef unsigned long long BITPACKED_UWORD;
 #define bitpacked_static_assert(c) do{int n[(c)?1:-1]={0}; if(n[0]) break; }while(0)
 #define BITPACKED_DUMMY_REFCNT 8128
+#ifdef BITPACKED_COMPACT_HEADER
+/* Refcount and type of heap objects share one word: a 32bit refcount and
+ * a 32bit index into bitpacked_typetable. */
+typedef int BITPACKED_REFCNT;
+#define BITPACKED_TYPETABLE_SIZE (1 << 20)
+#else
+typedef Py_ssize_t BITPACKED_REFCNT;
+#endif
 #endif
 
 /* Object and type object interface */
@@ -101,9 +109,23 @@ whose size is determined when the object is allocated.
 /* PyObject_HEAD defines the initial segment of every PyObject. */
 #define PyObject_HEAD                   PyObject ob_base;
 
+/* In compact header mode a type index can not be computed at compile time.
+ * Index 0 always stands for PyType_Type, which is what nearly every
+ * statically initialized object is.  Other static objects have to set
+ * their type with Py_SET_TYPE() at startup.  Index 1 always stands for
+ * NULL, for static objects that must look typeless until initialized.
+ */
+#ifdef BITPACKED_COMPACT_HEADER
+#define _PyObject_TYPE_INIT(type) 0
+#define _PyObject_TYPE_INIT_NULL  1
+#else
+#define _PyObject_TYPE_INIT(type) type
+#define _PyObject_TYPE_INIT_NULL  NULL
+#endif
+
 #define PyObject_HEAD_INIT(type)        \
     { _PyObject_EXTRA_INIT              \
-    1, type },
+    1, _PyObject_TYPE_INIT(type) },
 
 #define PyVarObject_HEAD_INIT(type, size)       \
     { PyObject_HEAD_INIT(type) size },
@@ -125,8 +147,14 @@ whose size is determined when the object is allocated.
 typedef struct _object {
     _PyObject_HEAD_EXTRA
 #ifdef BITPACKED
-    Py_ssize_t ob_refcnt_bitpacked;
+#ifdef BITPACKED_COMPACT_HEADER
+    /* keep the pointer alignment of the usual header */
+    BITPACKED_REFCNT ob_refcnt_bitpacked Py_ALIGNED(8);
+    unsigned int ob_typeidx_bitpacked;
+#else
+    BITPACKED_REFCNT ob_refcnt_bitpacked;
     struct _typeobject *ob_type_bitpacked;
+#endif
 #else
     Py_ssize_t ob_refcnt;
     struct _typeobject *ob_type;
@@ -144,38 +172,87 @@ typedef struct {
 } PyVarObject;
 
 #ifdef BITPACKED
-#define BITPACKED_CHECK(ob) (!!((BITPACKED_UWORD)(ob) & 0x0006ULL))
+/* Every object is BITPACKED_ALIGNMENT aligned, which leaves three low bits
+ * of a pointer for tags: obmalloc's size classes are 16 bytes apart, larger
+ * blocks come from malloc(), and type objects, module definitions and the
+ * static singletons are declared BITPACKED_ALIGNED.  PyObject_Malloc() and
+ * PyType_Ready() refuse anything that is not aligned.
+ */
+#define BITPACKED_ALIGNMENT 16
+#define BITPACKED_ALIGNED Py_ALIGNED(BITPACKED_ALIGNMENT)
+#define BITPACKED_CHECK(ob) (!!((BITPACKED_UWORD)(ob) & 0x000eULL))
 #define BITPACKED_TYPEID(ob) ((BITPACKED_UWORD)(ob) & 0x001eULL)
 #define BITPACKED_TYPEID_LONG         ((BITPACKED_UWORD)0x0002U)
 #define BITPACKED_TYPEID_NONE         ((BITPACKED_UWORD)0x0004U)
 #define BITPACKED_TYPEID_NOTIMPL      ((BITPACKED_UWORD)0x0006U)
+#define BITPACKED_TYPEID_NOTUSED_08   ((BITPACKED_UWORD)0x0008U)
 #define BITPACKED_TYPEID_FLOAT        ((BITPACKED_UWORD)0x000AU)
 #define BITPACKED_TYPEID_RANGE        ((BITPACKED_UWORD)0x000CU)
-#define BITPACKED_TYPEID_NOTUSED_0E   ((BITPACKED_UWORD)0x000EU)
+#define BITPACKED_TYPEID_RANGE_WIDE   ((BITPACKED_UWORD)0x000EU)
 #define BITPACKED_TYPEID_BOOL         ((BITPACKED_UWORD)0x0012U)
-#define BITPACKED_TYPEID_NOTUSED_14   ((BITPACKED_UWORD)0x0014U)
-#define BITPACKED_TYPEID_NOTUSED_16   ((BITPACKED_UWORD)0x0016U)
+#define BITPACKED_TYPEID_DATE         ((BITPACKED_UWORD)0x0014U)
+#define BITPACKED_TYPEID_TIME         ((BITPACKED_UWORD)0x0016U)
+#define BITPACKED_TYPEID_DELTA        ((BITPACKED_UWORD)0x0018U)
 #define BITPACKED_TYPEID_FLOAT_RSV    ((BITPACKED_UWORD)0x001AU)
-#define BITPACKED_TYPEID_NOTUSED_1C   ((BITPACKED_UWORD)0x001CU)
-#define BITPACKED_TYPEID_NOTUSED_1E   ((BITPACKED_UWORD)0x001EU)
-extern struct _typeobject *const bitpacked_types[16];
+#define BITPACKED_TYPEID_FLOAT_WIDE   ((BITPACKED_UWORD)0x001CU)
+#define BITPACKED_TYPEID_FLOAT_WIDE_RSV ((BITPACKED_UWORD)0x001EU)
+extern struct _typeobject *bitpacked_types[16];
+/* The types of DATE, TIME and DELTA live in the _datetime module, which
+   registers them when it is imported. */
+PyAPI_FUNC(int) _PyBitpacked_RegisterTaggedType(BITPACKED_UWORD typeid,
+                                                struct _typeobject *tp);
+#ifdef BITPACKED_COMPACT_HEADER
+PyAPI_DATA(struct _typeobject *) bitpacked_typetable[BITPACKED_TYPETABLE_SIZE];
+#endif
 #if BITPACKED_NOREFCNT
 #if BITPACKED_NOERRDETECT
 #define Py_REFCNT(ob)  (((PyObject*)(ob))->ob_refcnt_bitpacked)
 #else
 #define Py_REFCNT(ob)  (*(BITPACKED_CHECK(ob)               \
-                        ?(abort(), (Py_ssize_t*)NULL)       \
+                        ?(abort(), (BITPACKED_REFCNT*)NULL) \
                         :&((PyObject*)(ob))->ob_refcnt_bitpacked))
 #endif
 #else
-extern Py_ssize_t bitpacked_refcnt;
+extern BITPACKED_REFCNT bitpacked_refcnt;
 #define Py_REFCNT(ob)  (*(BITPACKED_CHECK(ob)               \
-                        ?(Py_ssize_t*)(&bitpacked_refcnt)   \
+                        ?(BITPACKED_REFCNT*)(&bitpacked_refcnt) \
                         :&((PyObject*)(ob))->ob_refcnt_bitpacked))
 #endif
-#define Py_TYPE(ob)    (*(BITPACKED_CHECK(ob)               \
-                        ?(PyTypeObject**)(bitpacked_types+(BITPACKED_TYPEID(ob)>>1)) \
-                        :&((PyObject*)(ob))->ob_type_bitpacked))
+/* Py_TYPE() is branchless.  bitpacked_typeslots[] holds, for each type id,
+ * where its type is found: a static address for tagged values, the offset
+ * of the type field for pointers.  The object itself is added to the
+ * latter through a mask, so both cases are one table lookup and one load.
+ */
+extern char *const bitpacked_typeslots[16];
+#define BITPACKED_PTRMASK(u) ((BITPACKED_UWORD)0 - !BITPACKED_CHECK(u))
+#ifdef BITPACKED_COMPACT_HEADER
+/* Tagged values find the index of their type in bitpacked_typetable. */
+Py_LOCAL_INLINE(struct _typeobject *)
+_PyBitpacked_Type(const void *ob)
+{
+    BITPACKED_UWORD u = (BITPACKED_UWORD)ob;
+    return bitpacked_typetable[*(const unsigned int *)(
+        bitpacked_typeslots[BITPACKED_TYPEID(u)>>1] + (u & BITPACKED_PTRMASK(u)))];
+}
+#define Py_TYPE(ob)    (_PyBitpacked_Type(ob))
+#ifdef Py_LIMITED_API
+#define Py_SET_TYPE(ob, tp) \
+    (((PyObject*)(ob))->ob_typeidx_bitpacked = _PyBitpacked_RegisterType(tp))
+#else
+#define Py_SET_TYPE(ob, tp) \
+    (((PyObject*)(ob))->ob_typeidx_bitpacked = _PyBitpacked_TypeIndex(tp))
+#endif
+#else
+Py_LOCAL_INLINE(struct _typeobject **)
+_PyBitpacked_TypeSlot(const void *ob)
+{
+    BITPACKED_UWORD u = (BITPACKED_UWORD)ob;
+    return (struct _typeobject **)(
+        bitpacked_typeslots[BITPACKED_TYPEID(u)>>1] + (u & BITPACKED_PTRMASK(u)));
+}
+#define Py_TYPE(ob)    (*_PyBitpacked_TypeSlot(ob))
+#define Py_SET_TYPE(ob, tp) (Py_TYPE(ob) = (tp))
+#endif
 #if BITPACKED_NOERRDETECT
 #define Py_SIZE(ob)    (((PyVarObject*)(ob))->ob_size_bitpacked)
 #else
@@ -184,12 +261,57 @@ extern Py_ssize_t bitpacked_refcnt;
                          :&((PyVarObject*)(ob))->ob_size_bitpacked))
 #endif
 #else
+#define BITPACKED_ALIGNED
 #define BITPACKED_CHECK(ob) 0
 #define Py_REFCNT(ob)           (((PyObject*)(ob))->ob_refcnt)
 #define Py_TYPE(ob)             (((PyObject*)(ob))->ob_type)
+#define Py_SET_TYPE(ob, tp)     (Py_TYPE(ob) = (tp))
 #define Py_SIZE(ob)             (((PyVarObject*)(ob))->ob_size)
 #endif
 
+#ifdef BITPACKED_STATS
+/* Counters behind sys.bitpacked_stats() (--with-bitpacked-stats): tagged
+ * values made per type id, heap objects made because a value could not
+ * be tagged, and tagged ints turned into heap ints, per call site.
+ */
+enum {
+    BITPACKED_FALLBACK_LONG_RANGE,      /* int outside the tagged range */
+    BITPACKED_FALLBACK_FLOAT_NAN,       /* NaN is never tagged */
+    BITPACKED_FALLBACK_FLOAT_EXPONENT,  /* exponent outside the window */
+    BITPACKED_FALLBACK_RANGE_BOUNDS,    /* bounds or step too wide */
+    BITPACKED_FALLBACK_NREASONS
+};
+typedef struct _bitpacked_stat_site {
+    const char *func;
+    int line;
+    int registered;
+    Py_ssize_t count;
+    struct _bitpacked_stat_site *next;
+} bitpacked_stat_site;
+PyAPI_DATA(Py_ssize_t) bitpacked_stat_tagged[16];
+PyAPI_DATA(Py_ssize_t) bitpacked_stat_fallback[BITPACKED_FALLBACK_NREASONS];
+PyAPI_FUNC(void) _PyBitpacked_RegisterStatSite(bitpacked_stat_site *);
+#ifndef Py_LIMITED_API
+PyAPI_FUNC(PyObject *) _PyBitpacked_GetStats(void);
+PyAPI_FUNC(void) _PyBitpacked_ResetStats(void);
+#endif
+#define BITPACKED_STAT_TAGGED(typeid) \
+    ((void)bitpacked_stat_tagged[(typeid)>>1]++)
+#define BITPACKED_STAT_FALLBACK(reason) \
+    ((void)bitpacked_stat_fallback[BITPACKED_FALLBACK_##reason]++)
+#define BITPACKED_STAT_REBOX() do {                         \
+        static bitpacked_stat_site bitpacked_site =          \
+            {__func__, __LINE__, 0, 0, NULL};                \
+        if(!bitpacked_site.registered)                       \
+            _PyBitpacked_RegisterStatSite(&bitpacked_site);  \
+        bitpacked_site.count++;                              \
+    } while(0)
+#else
+#define BITPACKED_STAT_TAGGED(typeid) ((void)0)
+#define BITPACKED_STAT_FALLBACK(reason) ((void)0)
+#define BITPACKED_STAT_REBOX() do{}while(0)
+#endif
+
 /********************* String Literals ****************************************/
 /* This structure helps managing static strings. The basic usage goes like this:
    Instead of doing
@@ -493,6 +615,12 @@ typedef struct _typeobject {
 
     destructor tp_finalize;
 
+#ifdef BITPACKED_COMPACT_HEADER
+    /* index in bitpacked_typetable, 0 until registered.  Never explicitly
+       initialized. */
+    unsigned int tp_bitpacked_index;
+#endif
+
 #ifdef COUNT_ALLOCS
     /* these must be last and never explicitly initialized */
     Py_ssize_t tp_allocs;
@@ -501,7 +629,20 @@ typedef struct _typeobject {
     struct _typeobject *tp_prev;
     struct _typeobject *tp_next;
 #endif
-} PyTypeObject;
+} BITPACKED_ALIGNED PyTypeObject;
+#endif
+
+#ifdef BITPACKED_COMPACT_HEADER
+PyAPI_FUNC(unsigned int) _PyBitpacked_RegisterType(struct _typeobject *);
+PyAPI_FUNC(void) _PyBitpacked_UnregisterType(struct _typeobject *);
+#ifndef Py_LIMITED_API
+Py_LOCAL_INLINE(unsigned int)
+_PyBitpacked_TypeIndex(PyTypeObject *tp)
+{
+    return tp->tp_bitpacked_index ? tp->tp_bitpacked_index
+                                  : _PyBitpacked_RegisterType(tp);
+}
+#endif
 #endif
 
 typedef struct{
@@ -608,6 +749,7 @@ PyAPI_FUNC(int) _PyObject_SetAttrId(PyObject *, struct _Py_Identifier *, PyObjec
 PyAPI_FUNC(int) _PyObject_HasAttrId(PyObject *, struct _Py_Identifier *);
 #ifndef Py_LIMITED_API
 PyAPI_FUNC(PyObject **) _PyObject_GetDictPtr(PyObject *);
+PyAPI_FUNC(int) _PyObject_GetMethod(PyObject *, PyObject *, PyObject **);
 #endif
 PyAPI_FUNC(PyObject *) PyObject_SelfIter(PyObject *);
 #ifndef Py_LIMITED_API
@@ -29,6 +29,7 @@ extern "C" {
 #define BINARY_TRUE_DIVIDE       27
 #define INPLACE_FLOOR_DIVIDE     28
 #define INPLACE_TRUE_DIVIDE      29
+#define BINARY_ADD_TAGGED_INT    30
 #define GET_AITER                50
 #define GET_ANEXT                51
 #define BEFORE_ASYNC_WITH        52
@@ -122,6 +123,15 @@ extern "C" {
 #define BUILD_TUPLE_UNPACK      152
 #define BUILD_SET_UNPACK        153
 #define SETUP_ASYNC_WITH        154
+#define LOAD_METHOD             160
+#define CALL_METHOD             161
+#define LOAD_ATTR_INSTANCE_DICT 162
+#define LOAD_GLOBAL_CACHED      163
+#define COMPARE_OP_FLOAT        164
+#define LOAD_FAST__LOAD_FAST    165
+#define LOAD_FAST__LOAD_ATTR    166
+#define STORE_FAST__LOAD_FAST   167
+#define COMPARE_OP__POP_JUMP_IF_FALSE 168
 
 /* EXCEPT_HANDLER is a special, implicit block type which is created when
    entering an except handler. It is not an opcode but we define it here
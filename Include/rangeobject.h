@@ -21,6 +21,38 @@ PyAPI_DATA(PyTypeObject) PyLongRangeIter_Type;
 
 #define PyRange_Check(op) (Py_TYPE(op) == &PyRange_Type)
 
+#ifdef BITPACKED
+/* Layout of a bitpacked range object with short bounds.  The eval loop
+ * also iterates these in place: FOR_ITER pushes start and replaces the
+ * range on the stack with the one that remains (start + step, one shorter).
+ * Ranges with wider bounds use BITPACKED_TYPEID_RANGE_WIDE, whose layout
+ * is private to rangeobject.c.
+ */
+typedef union{
+    struct{
+#if PY_LITTLE_ENDIAN
+        char reserved;
+        signed char step;
+        short start;
+        short stop;
+        unsigned short length;
+#else
+        short start;
+        short stop;
+        unsigned short length;
+        signed char step;
+        char reserved;
+#endif
+    };
+    BITPACKED_UWORD uword;
+    PyObject* pyobj;
+    struct _rangeobject* rangeobj;
+} bitpacked_rangeobject;
+#define BITPACKED_RANGE_CHECKEXACT(ob) (BITPACKED_TYPEID(ob) == BITPACKED_TYPEID_RANGE)
+#else
+#define BITPACKED_RANGE_CHECKEXACT(ob) 0
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -66,6 +66,9 @@ typedef struct {
 #define PySet_GET_SIZE(so) (((PySetObject *)(so))->used)
 
 PyAPI_DATA(PyObject *) _PySet_Dummy;
+#ifdef BITPACKED_COMPACT_HEADER
+PyAPI_FUNC(void) _PySet_InitDummy(void);
+#endif
 
 PyAPI_FUNC(int) _PySet_NextEntry(PyObject *set, Py_ssize_t *pos, PyObject **key, Py_hash_t *hash);
 PyAPI_FUNC(int) _PySet_Update(PyObject *set, PyObject *iterable);
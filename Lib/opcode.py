@@ -214,4 +214,28 @@ def_op('BUILD_MAP_UNPACK_WITH_CALL', 151)
 def_op('BUILD_TUPLE_UNPACK', 152)
 def_op('BUILD_SET_UNPACK', 153)
 
+name_op('LOAD_METHOD', 160)     # Index in name list
+def_op('CALL_METHOD', 161)      # #args + (#kwargs << 8)
+hasnargs.append(161)
+
+# Specialized forms of the instructions above.  The compiler never emits
+# them; quickened code rewrites sites to them and back (see ceval.c).
+def_op('BINARY_ADD_TAGGED_INT', 30)
+name_op('LOAD_ATTR_INSTANCE_DICT', 162)     # Index in name list
+name_op('LOAD_GLOBAL_CACHED', 163)          # Index in name list
+def_op('COMPARE_OP_FLOAT', 164)             # Comparison operator
+hascompare.append(164)
+
+# Superinstructions.  The peephole optimizer puts them in place of the first
+# instruction of a frequent pair and leaves the second one where it was, so
+# the argument is that of the first (see peephole.c).
+def_op('LOAD_FAST__LOAD_FAST', 165)         # Local variable number
+haslocal.append(165)
+def_op('LOAD_FAST__LOAD_ATTR', 166)         # Local variable number
+haslocal.append(166)
+def_op('STORE_FAST__LOAD_FAST', 167)        # Local variable number
+haslocal.append(167)
+def_op('COMPARE_OP__POP_JUMP_IF_FALSE', 168)    # Comparison operator
+hascompare.append(168)
+
 del def_op, name_op, jrel_op, jabs_op
@@ -1468,6 +1468,9 @@ def python_is_optimized():
 
 _header = 'nP'
 _align = '0n'
+if 'c' in getattr(sys, 'abiflags', ''):
+    # --with-bitpacked-compact-header: 32-bit refcount and type index
+    _header = 'iI'
 if hasattr(sys, "gettotalrefcount"):
     _header = '2P' + _header
     _align = '0P'
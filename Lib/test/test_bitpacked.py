@@ -1,3 +1,5 @@
+import pickle
+import sys
 import unittest
 
 from sysconfig import get_config_vars
@@ -20,43 +22,239 @@ class BitPackedTestCase(unittest.TestCase):
         tid_dict = {k[len(tid_prefix):]: getattr(_testbitpacked, k) for k in dir(_testbitpacked) if k.startswith(tid_prefix)}
         typetbl = _testbitpacked.get_typetable()
         if BITPACKED:
-            self.assertEqual(len(tid_dict), 12)
+            self.assertEqual(len(tid_dict), 14)
             self.assertEqual(len(typetbl), 16)
-            self.assertEqual(set(tid_dict.values()), {n for n in range(0, 32, 2) if n % 8 != 0})
+            self.assertEqual(set(tid_dict.values()), {n for n in range(0, 32, 2) if n % 16 != 0})
             self.assertEqual(tid_dict['LONG'] ^ tid_dict['BOOL'], 0b00010000)
             self.assertEqual(tid_dict['FLOAT'] ^ tid_dict['FLOAT_RSV'], 0b00010000)
             self.assertLess(tid_dict['FLOAT'], tid_dict['FLOAT_RSV'])
+            self.assertEqual(tid_dict['FLOAT_WIDE'] ^ tid_dict['FLOAT_WIDE_RSV'], 0b00000010)
             self.assertEqual(len({tid_dict[k] & 0b00000110 for k
                                   in ['LONG', 'BOOL', 'FLOAT', 'FLOAT_RSV']}), 1)
-            self.assertTrue(all(typetbl[n] is None for n in range(0, 16, 4)))
+            self.assertTrue(all(typetbl[n] is None for n in range(0, 16, 4)
+                                if n != tid_dict['DELTA']//2))
             self.assertIs(typetbl[tid_dict['LONG']//2], int)
             self.assertIs(typetbl[tid_dict['BOOL']//2], bool)
             self.assertIs(typetbl[tid_dict['FLOAT']//2], float)
             self.assertIs(typetbl[tid_dict['FLOAT_RSV']//2], float)
+            self.assertIs(typetbl[tid_dict['FLOAT_WIDE']//2], float)
+            self.assertIs(typetbl[tid_dict['FLOAT_WIDE_RSV']//2], float)
             self.assertIs(typetbl[tid_dict['NONE']//2], type(None))
             self.assertIs(typetbl[tid_dict['NOTIMPL']//2], type(NotImplemented))
             self.assertIs(typetbl[tid_dict['RANGE']//2], range)
+            self.assertIs(typetbl[tid_dict['RANGE_WIDE']//2], range)
+            import _datetime
+            typetbl = _testbitpacked.get_typetable()
+            self.assertIs(typetbl[tid_dict['DATE']//2], _datetime.date)
+            self.assertIs(typetbl[tid_dict['TIME']//2], _datetime.time)
+            self.assertIs(typetbl[tid_dict['DELTA']//2], _datetime.timedelta)
         else:
             self.assertEqual(len(tid_dict), 0)
             self.assertIs(typetbl, None)
 
+    @unittest.skipUnless(BITPACKED, 'needs bitpacked mode')
+    def test_alignment(self):
+        import _testcapi
+        align = _testbitpacked.BITPACKED_ALIGNMENT
+        self.assertEqual(align, 16)
+        objs = [object(), type, int, _testcapi, _testcapi.instancemethod,
+                Ellipsis, 2**70, [], {}, set(), (1,), 'x', b'x',
+                bytes(600), bytearray(100000), [0] * 1000, lambda: None]
+        objs += [bytes(n) for n in range(64)]
+        objs += [bytearray(n) for n in range(0, 2000, 37)]
+        for obj in objs:
+            self.assertEqual(id(obj) % align, 0, repr(obj)[:30])
+
     def test_longobject(self):
         n = 20
 
         if BITPACKED:
             self.assertEqual(id(n) % 32, _testbitpacked.BITPACKED_TYPEID_LONG)
-            self.assertEqual(id(n), n << 32 | _testbitpacked.BITPACKED_TYPEID_LONG)
+            self.assertEqual(id(n), n << 5 | _testbitpacked.BITPACKED_TYPEID_LONG)
             self.assertIs(40 * 300, -600 * -20)
+            def check_bitpackedobj(x):
+                self.assertEqual(id(x) % 32, _testbitpacked.BITPACKED_TYPEID_LONG)
+            def check_conventional(x):
+                self.assertEqual(id(x) % 8, 0)
+            check_bitpackedobj(2**58 - 1)
+            check_bitpackedobj(-2**58)
+            check_conventional(2**58)
+            check_conventional(-2**58 - 1)
+            check_bitpackedobj(147500000012345678)
+            check_bitpackedobj(int('-288230376151711744'))
+            check_bitpackedobj((2**58 - 1) - 2**40)
+            check_bitpackedobj(2**60 - 2**59 - 2**58 - 1)
+            check_bitpackedobj(-(2**60 - 2**59 - 2**58))
+            self.assertIs(2**40 * 3, 3 * 2**40)
         else:
             self.assertEqual(id(n) % 8, 0)
             self.assertIsNot(40 * 300, -600 * -20)
 
+    def test_long_arith(self):
+        imax = 0x7fffffff
+        imin = -imax - 1
+        x, y = imax, 1
+        self.assertEqual(x + y, 2**31)
+        self.assertEqual(-x - y - y, -2**31 - 1)
+        self.assertEqual(x * x, 4611686014132420609)
+        self.assertEqual(imin * -1, 2**31)
+        z = imin
+        z -= 1
+        self.assertEqual(z, -2**31 - 1)
+        z = imax
+        z += 1
+        z *= 2
+        self.assertEqual(z, 2**32)
+        self.assertTrue(imin < imax)
+        self.assertFalse(imin >= imax)
+        self.assertIs(x == imax, True)
+        self.assertIs(x != imax, False)
+        if BITPACKED:
+            self.assertIs(x + y, 2**31)
+            self.assertEqual(id(x - y) % 32, _testbitpacked.BITPACKED_TYPEID_LONG)
+            self.assertIs(x - y, imax - 1)
+
+    def test_wide_long(self):
+        lmax = 2**58 - 1
+        lmin = -lmax - 1
+        for a, b in [(lmax, 1), (lmin, -1), (lmax, lmax), (lmin, lmin),
+                     (lmax, lmin), (2**40 + 7, 2**20 - 3), (-3**36, 5**20)]:
+            big_a, big_b = a + 2**70 - 2**70, b + 2**70 - 2**70
+            self.assertEqual(a + b, big_a + big_b)
+            self.assertEqual(a - b, big_a - big_b)
+            self.assertEqual(a * b, big_a * big_b)
+            self.assertEqual(a // b, big_a // big_b)
+            self.assertEqual(a % b, big_a % big_b)
+            self.assertEqual(divmod(a, b), divmod(big_a, big_b))
+            self.assertEqual(a / b, big_a / big_b)
+            self.assertEqual(a & b, big_a & big_b)
+            self.assertEqual(a | b, big_a | big_b)
+            self.assertEqual(a ^ b, big_a ^ big_b)
+            self.assertEqual(a < b, big_a < big_b)
+            self.assertEqual(a == b, big_a == big_b)
+        self.assertEqual(-lmin, 2**58)
+        self.assertEqual(abs(lmin), 2**58)
+        self.assertEqual(~lmin, lmax)
+        self.assertEqual(lmax << 1, 2**59 - 2)
+        self.assertEqual(lmin >> 70, -1)
+        self.assertEqual(lmax.bit_length(), 58)
+        self.assertEqual(hash(lmax), lmax)
+        self.assertEqual(hash(lmin), lmin)
+        self.assertEqual(str(lmin), '-288230376151711744')
+        self.assertEqual(lmax.to_bytes(8, 'little'), (2**58 - 1).to_bytes(8, 'little'))
+        self.assertEqual(float(lmax), 2.0**58)
+        self.assertTrue(2.0**58 > lmax)
+        self.assertFalse(2.0**58 == lmax)
+        self.assertEqual(2**53 + 1 == float(2**53 + 1), False)
+        import marshal
+        for n in [lmax, lmin, 2**31, -2**31 - 1, 2**40, 0]:
+            m = marshal.loads(marshal.dumps(n))
+            self.assertEqual(m, n)
+            if BITPACKED:
+                self.assertIs(m, n)
+
+    def test_long_number_slots(self):
+        lmax = 2**58 - 1
+        lmin = -lmax - 1
+        big = 2**70
+        for a, b, c in [(3, 5, 7), (-3, 5, 7), (3, 5, -7), (-3, 5, -7),
+                        (2, 57, lmax), (lmin, 3, lmax), (lmax, lmax, lmin),
+                        (10**9 + 7, 10**9, 998244353), (0, 0, 1), (5, 0, -1)]:
+            self.assertEqual(pow(a, b, c), pow(a + big * c, b, c))
+            self.assertEqual(pow(a, b % 40), (a * big) ** (b % 40) >> 70 * (b % 40))
+        self.assertEqual(pow(2, 62), 2**62)
+        self.assertEqual(pow(-2, 63), -2**63)
+        self.assertEqual(pow(3, 40), 12157665459056928801)
+        self.assertEqual(pow(2, -2), 0.25)
+        self.assertRaises(ValueError, pow, 2, 3, 0)
+        self.assertRaises(ValueError, pow, 2, -3, 5)
+        self.assertEqual(divmod(-big - 1, 97), (-12171047636261972201, 72))
+        self.assertEqual((-big) // -7, 168655945816773043346)
+        for x in [0, 1, -1, 127, 128, -128, -129, 255, 256, lmax, lmin]:
+            for n in [0, 1, 2, 8, 9]:
+                for signed in [False, True]:
+                    if not n:
+                        # (-1).to_bytes(0, ..., signed=True) is b''
+                        lo, hi = -signed, 1
+                    elif signed:
+                        lo, hi = -2**(8*n-1), 2**(8*n-1)
+                    else:
+                        lo, hi = 0, 2**(8*n)
+                    if lo <= x < hi:
+                        b = x.to_bytes(n, 'big', signed=signed)
+                        self.assertEqual(len(b), n)
+                        self.assertEqual(int.from_bytes(b, 'big', signed=signed), x if n else 0)
+                        self.assertEqual(x.to_bytes(n, 'little', signed=signed), b[::-1])
+                    else:
+                        self.assertRaises(OverflowError, x.to_bytes, n, 'big', signed=signed)
+        def hashing(x, n, k, mask):
+            acc = 0
+            for i in range(1000):
+                y = x + i
+                acc += y % n + (y >> k) + (y & mask) + y // n
+                acc += pow(y, 3, n) + (-y) + abs(y) + ~y + (y << 2)
+            return acc
+        hashing(12345678, 1009, 3, 0xff)
+        allocs = _testbitpacked.count_allocations(hashing, 12345678, 1009, 3, 0xff)
+        if BITPACKED:
+            self.assertEqual(allocs, 0)
+        else:
+            self.assertGreater(allocs, 0)
+
+    def test_int_keys(self):
+        class EqInt(int):
+            def __eq__(self, other):
+                return int(self) == other
+            __hash__ = int.__hash__
+        for keys in [list(range(-50, 50)), [i << 40 for i in range(100)],
+                     [i * 32 for i in range(100)]]:
+            d = dict.fromkeys(keys, 'v')
+            s = set(keys)
+            for k in keys:
+                self.assertIn(k, d)
+                self.assertIn(k, s)
+                self.assertIn(k + 2**70 - 2**70, d)
+                self.assertIn(float(k), s)
+            self.assertNotIn(2**58, d)
+            self.assertNotIn(2**58, s)
+            for k in keys[::2]:
+                del d[k]
+                s.remove(k)
+            self.assertEqual(sorted(d), keys[1::2])
+            self.assertEqual(sorted(s), keys[1::2])
+            d[keys[0]] = 'w'
+            s.add(keys[0])
+            self.assertEqual(d[keys[0]], 'w')
+            self.assertIn(keys[0], s)
+        d = {1: 'a', 2: 'b'}
+        self.assertEqual(d[True], 'a')
+        self.assertEqual(d[1.0], 'a')
+        self.assertEqual(d[EqInt(2)], 'b')
+        d['x'] = 'c'
+        d[3] = 'd'
+        self.assertEqual(d, {1: 'a', 2: 'b', 'x': 'c', 3: 'd'})
+        s = {1, 2}
+        self.assertIn(True, s)
+        self.assertIn(EqInt(2), s)
+        s.add(1.0)
+        s.add(True)
+        self.assertEqual(len(s), 2)
+        s = {EqInt(5), 7}
+        self.assertIn(5, s)
+        self.assertIn(7, s)
+        d = {}
+        self.assertNotIn(1, d)
+        d['a'] = 1
+        d['b'] = 2
+        self.assertEqual(d, {'a': 1, 'b': 2})
+        self.assertEqual(dict(**{'a': 1}), {'a': 1})
+
     def test_boolobject(self):
         if BITPACKED:
             self.assertEqual(id(1) ^ id(True), 0x0010)
             self.assertEqual(id(0) ^ id(False), 0x0010)
             self.assertEqual(id(0) ^ id(0.0), 0x0008)
-            self.assertEqual(id(True), 1 << 32 | _testbitpacked.BITPACKED_TYPEID_BOOL)
+            self.assertEqual(id(True), 1 << 5 | _testbitpacked.BITPACKED_TYPEID_BOOL)
             self.assertEqual(id(False), _testbitpacked.BITPACKED_TYPEID_BOOL)
         else:
             self.assertEqual(id(True) % 8, 0)
@@ -73,24 +271,37 @@ class BitPackedTestCase(unittest.TestCase):
             self.assertIs(4.0 * 3.0, -6.0 * -2.0)
             def check_bitpackedobj(x):
                 self.assertEqual(id(x) % 16, _testbitpacked.BITPACKED_TYPEID_FLOAT)
+            def check_wide(x):
+                self.assertIn(id(x) % 32, [_testbitpacked.BITPACKED_TYPEID_FLOAT_WIDE,
+                                           _testbitpacked.BITPACKED_TYPEID_FLOAT_WIDE_RSV])
             def check_conventional(x):
                 self.assertEqual(id(x) % 8, 0)
             check_bitpackedobj(float('-inf'))
             check_bitpackedobj(-8.371198e+298)
             check_conventional(-8.371142e+298)
-            check_conventional(-8.589973e+9)
+            check_conventional(-2.0**97)
+            check_wide(-1.5845632502852866e+29)
+            check_wide(-8.589973e+9)
             check_bitpackedobj(-8.589915e+9)
             check_bitpackedobj(-4.656634e-10)
-            check_conventional(-4.656602e-10)
+            check_wide(-4.656602e-10)
+            check_wide(-2.0**-95)
+            check_conventional(-2.5243548967072375e-29)
             check_conventional(-4.778331e-299)
             check_bitpackedobj(-4.778299e-299)
             check_bitpackedobj(0.0)
             check_bitpackedobj(+4.778299e-299)
             check_conventional(+4.778331e-299)
-            check_conventional(+4.656602e-10)
+            check_conventional(+2.5243548967072375e-29)
+            check_wide(+2.0**-95)
+            check_wide(1e-20)
+            check_wide(+4.656602e-10)
             check_bitpackedobj(+4.656634e-10)
             check_bitpackedobj(+8.589915e+9)
-            check_conventional(+8.589973e+9)
+            check_wide(+8.589973e+9)
+            check_wide(6.02214076e23)
+            check_wide(+1.5845632502852866e+29)
+            check_conventional(+2.0**97)
             check_conventional(+8.371142e+298)
             check_bitpackedobj(+8.371198e+298)
             check_bitpackedobj(float('+inf'))
@@ -99,6 +310,318 @@ class BitPackedTestCase(unittest.TestCase):
             self.assertEqual(id(n) % 8, 0)
             self.assertIsNot(4.0 * 3.0, -6.0 * -2.0)
 
+    def test_float_roundtrip(self):
+        import struct
+        tagged = 0
+        for exp in range(0x7ff):
+            for mant in [0, 1, 2, 3, 1 << 51, 0x5555555555555, (1 << 52) - 1]:
+                for sign in [0, 1]:
+                    bits = sign << 63 | exp << 52 | mant
+                    x, = struct.unpack('<d', bits.to_bytes(8, 'little'))
+                    y = -(-x)
+                    self.assertEqual(int.from_bytes(struct.pack('<d', y), 'little'), bits)
+                    self.assertEqual(y.hex(), x.hex())
+                    self.assertEqual(hash(y), hash(x))
+                    tagged += id(y) % 8 != 0
+        # all but NaN in 0x7ff; exponents 0-31, 928-1119 and 2016-2046
+        self.assertEqual(tagged, (32 + 192 + 31) * 7 * 2 if BITPACKED else 0)
+
+    def test_float_arith(self):
+        import operator, struct
+        def bits(x):
+            return struct.pack('<d', x)
+        vals = [0.0, -0.0, 1.5, -2.25, 1e-40, 3e30, 1e300, float('inf'), 7, -3, 2**53 + 1]
+        for a in vals:
+            for b in vals:
+                if isinstance(a, int) and isinstance(b, int):
+                    continue
+                fa, fb = float(a), float(b)
+                for op in [operator.add, operator.sub, operator.mul]:
+                    self.assertEqual(bits(op(a, b)), bits(op(fa, fb)))
+                self.assertEqual(bits(a + b), bits(fa + fb))
+                self.assertEqual(bits(a - b), bits(fa - fb))
+                self.assertEqual(bits(a * b), bits(fa * fb))
+                z = a
+                z *= b
+                self.assertEqual(bits(z), bits(fa * fb))
+                if fb:
+                    self.assertEqual(bits(a / b), bits(fa / fb))
+                else:
+                    self.assertRaises(ZeroDivisionError, operator.truediv, a, b)
+                self.assertIs(a < b, fa < fb)
+                self.assertIs(a == b, fa == fb)
+        # ints beyond 2**53 still compare exactly with floats
+        self.assertIs(2**53 + 1 == 2.0**53, False)
+        self.assertIs(2**53 + 1 > 2.0**53, True)
+        self.assertIs(2.0**53 < 2**53 + 1, True)
+        self.assertIs(2**53 == 2.0**53, True)
+        self.assertIs(float('nan') != 1, True)
+        self.assertIs(float('nan') == float('nan'), False)
+        self.assertIs(1.5 >= 1, True)
+        def dot(xs, ys):
+            acc = 0.0
+            for i in range(len(xs)):
+                acc += xs[i] * ys[i] - xs[i] / 3
+            return acc
+        xs = [i / 7 for i in range(100)]
+        ys = [(i % 11) * 1.25 for i in range(100)]
+        dot(xs, ys)
+        allocs = _testbitpacked.count_allocations(dot, xs, ys)
+        if BITPACKED:
+            self.assertEqual(allocs, 0)
+        else:
+            self.assertGreater(allocs, 0)
+
+    def test_sort(self):
+        import random
+        rnd = random.Random(13)
+        lmax = 2**58 - 1
+        ints = [rnd.randrange(-lmax - 1, lmax + 1) for i in range(2000)]
+        ints += [rnd.randrange(-50, 50) for i in range(2000)]
+        floats = [rnd.uniform(-1e6, 1e6) for i in range(2000)]
+        floats += [0.0, -0.0, float('inf'), float('-inf'), 1e-300, 5e-324] * 10
+        for data in [ints, floats, ints[:3000:3] + floats[::3],
+                     ints + [2**70], floats + [float('nan')], [1, 1.5] * 5]:
+            for reverse in [False, True]:
+                # a 1-tuple key takes the generic comparison
+                expected = sorted(data, key=lambda x: (x,), reverse=reverse)
+                got = sorted(data, reverse=reverse)
+                self.assertEqual(list(map(repr, got)), list(map(repr, expected)))
+                pairs = list(enumerate(data))
+                expected = sorted(pairs, key=lambda p: (p[1],), reverse=reverse)
+                got = sorted(pairs, key=lambda p: p[1], reverse=reverse)
+                self.assertEqual(got, expected)
+        # -0.0 == 0.0 keeps its place
+        zeros = [0.0, -0.0, -0.0, 0.0, -1.0] * 3
+        self.assertEqual(list(map(repr, sorted(zeros))),
+                         ['-1.0'] * 3 + ['0.0', '-0.0', '-0.0', '0.0'] * 3)
+
+    def test_reductions(self):
+        class L(list):
+            # not an exact list: takes the generic loops
+            pass
+        lmax = 2**58 - 1
+        cases = [[], [0], [lmax] * 40, [-lmax - 1] * 17 + [3], list(range(-50, 50)),
+                 [1.5, 2, -0.0, 0.0, 1e-300, 7], [0.0, -0.0, 0, False, None] * 5,
+                 [0] * 20 + [1], [1] * 20 + [0.0], [2**70] + [1] * 20,
+                 [1] * 19 + [2**70, 1, 0.5], [0.1] * 30 + [1] * 10 + [2**60],
+                 [1, 2, True, 3], [1, 2, '', 3], [1.5, 2.5, float('nan'), 0.5],
+                 [0.0, -0.0], [-0.0, 0.0], [3, 1, 2] * 7, [2.0, 1, 2, 1.0]]
+        for items in cases:
+            for seq in [items, tuple(items)]:
+                ref = L(items)
+                for start in [0, 0.0, 2**60, -1.5, lmax]:
+                    try:
+                        expected = sum(ref, start)
+                    except TypeError:
+                        self.assertRaises(TypeError, sum, seq, start)
+                    else:
+                        self.assertEqual(repr(sum(seq, start)), repr(expected))
+                self.assertIs(any(seq), any(ref))
+                self.assertIs(all(seq), all(ref))
+                for f in [min, max]:
+                    try:
+                        expected = f(ref)
+                    except (TypeError, ValueError) as e:
+                        self.assertRaises(type(e), f, seq)
+                    else:
+                        self.assertEqual(repr(f(seq)), repr(expected))
+                        self.assertIs(type(f(seq)), type(expected))
+        self.assertEqual(repr(min(0.0, -0.0)), '0.0')
+        self.assertEqual(repr(max(-0.0, 0.0)), '-0.0')
+        self.assertEqual(min(5, 3, 9), 3)
+        self.assertEqual(max([], default=7), 7)
+        # the generic loop picks up after the tagged items
+        log = []
+        class B:
+            def __bool__(self):
+                log.append(self)
+                return False
+            def __radd__(self, other):
+                log.append(other)
+                return other
+        b = B()
+        self.assertIs(all([1, 2.5, True, b, 0]), False)
+        self.assertEqual(log, [b])
+        self.assertEqual(sum([1, 2, 3, b, 4]), 10)
+        self.assertEqual(log, [b, 6])
+        self.assertEqual(sum([1.5, 2, b, 4]), 7.5)
+        self.assertEqual(log, [b, 6, 3.5])
+
+    def test_marshal(self):
+        import marshal, struct
+        lmax = 2**58 - 1
+        values = [[1, 2, 3, 4], (0, -1, 127, -128, 5), list(range(-300, 300)),
+                  (lmax, -lmax - 1, 0, 1), [2**40] * 6, [-2**40, 1, 2, 3, 4, 5],
+                  [1.5, -0.0, 1e-300, 1e300, float('inf')] * 2, (0.1,) * 10,
+                  [1, 2, 3, 2**70], [1, 2, 3.5, 4], [None, True, 1, 1.5] * 3,
+                  ([1, 2, 3, 4], [1, 2, 3, 4]), [], (1,)]
+        for v in values:
+            for version in range(6):
+                data = marshal.dumps(v, version)
+                self.assertEqual(repr(marshal.loads(data)), repr(v))
+            self.assertLessEqual(len(marshal.dumps(v, 5)), len(marshal.dumps(v, 4)))
+        shared = [1, 2, 3, 4]
+        v = marshal.loads(marshal.dumps((shared, shared), 5))
+        self.assertIs(v[0], v[1])
+        if BITPACKED:
+            # tagged values are written again, not as references
+            self.assertEqual(marshal.dumps([2.5, 2.5]), b'[\x02\x00\x00\x00' +
+                             (b'g' + struct.pack('<d', 2.5)) * 2)
+            self.assertEqual(marshal.dumps(list(range(100)), 5),
+                             b'q[\x01d\x00\x00\x00' + bytes(range(100)))
+        # every build reads the version 5 records
+        self.assertEqual(marshal.loads(b'q(\x02\x03\x00\x00\x00\x01\x00\xff\xff\x00\x80'),
+                         (1, -1, -32768))
+        self.assertEqual(marshal.loads(b'd[\x01\x00\x00\x00' + struct.pack('<d', 0.5)),
+                         [0.5])
+        for bad in [b'q{\x01\x01\x00\x00\x00\x01', b'q(\x03\x01\x00\x00\x00\x01',
+                    b'q(\x01\xff\xff\xff\xff']:
+            self.assertRaises(ValueError, marshal.loads, bad)
+        self.assertRaises(EOFError, marshal.loads, b'q(\x02\x02\x00\x00\x00\x01\x00')
+
+    def test_pickle(self):
+        import io
+        values = [0, 255, 256, 65535, 65536, -1, 2**31 - 1, -2**31, 2**31,
+                  -2**31 - 1, 2**39, -2**39, -2**39 - 1, 2**58 - 1, -2**58,
+                  0.0, -0.0, 1.5, float('inf'), 1e300, None, True, False]
+        for v in [values, tuple(values), values * 3000, [values, 'x', 2**70],
+                  (1, 2, 3), (7,), [2.5]]:
+            for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+                # same opcodes and frames as the Python implementation
+                data = pickle.dumps(v, proto)
+                self.assertEqual(data, pickle._dumps(v, proto))
+                self.assertEqual(pickle.loads(data), v)
+                # runs of numbers split across reads of a file
+                f = io.BufferedReader(io.BytesIO(data), buffer_size=7)
+                self.assertEqual(pickle.load(f), v)
+        # persistent_id() is called for every item
+        seen = []
+        class Pickler(pickle.Pickler):
+            def persistent_id(self, obj):
+                seen.append(obj)
+        Pickler(io.BytesIO(), 2).dump([1, 2.5, None])
+        self.assertEqual(seen, [[1, 2.5, None], 1, 2.5, None])
+
+    def test_json(self):
+        import json
+        values = [0, 7, -1, 2**58 - 1, -2**58, 2**58, 10**18 - 1, -10**17 + 1,
+                  0.0, -0.0, 0.1, 1.5, 1e16, 1e300, 5e-324, 2.5e-310,
+                  float('inf'), -float('inf')]
+        for v in values:
+            s = json.dumps(v)
+            self.assertEqual(s, {float('inf'): 'Infinity',
+                                 -float('inf'): '-Infinity'}.get(v, repr(v)))
+            w = json.loads(s)
+            self.assertEqual(type(w), type(v))
+            self.assertEqual(repr(w), repr(v))
+        self.assertEqual(json.dumps(values, separators=(',', ':')),
+                         '[%s]' % ','.join(json.dumps(v) for v in values))
+        self.assertEqual(json.loads('[-0, 1e999, 1E+2, 1234567890123456789]'),
+                         [0, float('inf'), 100.0, 1234567890123456789])
+        self.assertRaises(ValueError, json.dumps, [1.5, float('inf')],
+                          allow_nan=False)
+
+    def test_gc_untrack(self):
+        import gc
+        import weakref
+        scalars = [1, 2**40, 0.5, None, True]
+        nested = [1, []]
+        gc.collect()
+        self.assertEqual(gc.is_tracked(scalars), not BITPACKED)
+        self.assertTrue(gc.is_tracked(nested))
+        self.assertTrue(gc.is_tracked([]))
+        scalars.append(3.25)
+        scalars[0] = 7
+        scalars.extend((8, None))
+        self.assertEqual(gc.is_tracked(scalars), not BITPACKED)
+        scalars.append([])
+        self.assertTrue(gc.is_tracked(scalars))
+        for mutate in (lambda l: l.__setitem__(0, {}),
+                       lambda l: l.insert(0, {}),
+                       lambda l: l.extend([{}]),
+                       lambda l: l.__setitem__(slice(0, 1), [{}]),
+                       lambda l: l.__setitem__(slice(None, None, 2), [{}])):
+            l = [1, 0.5]
+            gc.collect()
+            mutate(l)
+            self.assertTrue(gc.is_tracked(l))
+        # a cycle through a list that was untracked is still collected
+        l = [1, 2]
+        gc.collect()
+        class C:
+            pass
+        c = C()
+        c.l = l
+        l.append(c)
+        wr = weakref.ref(c)
+        del l, c
+        gc.collect()
+        self.assertIsNone(wr())
+
+    def test_compact_header(self):
+        from sys import getsizeof
+        if mode & _testbitpacked.MODE_COMPACTHEADER:
+            self.assertEqual(getsizeof(object()), 8)
+        else:
+            self.assertEqual(getsizeof(object()), 16)
+        class A:
+            pass
+        class B(A):
+            pass
+        objs = [A(), B(), Ellipsis, 1 << 70, 'spam', b'eggs', [], {}, set(), (1, 2)]
+        self.assertEqual([type(o) for o in objs],
+                         [A, B, type(...), int, str, bytes, list, dict, set, tuple])
+        self.assertIs(type(A), type)
+        self.assertIs(type(type), type)
+        objs[0].__class__ = B
+        self.assertIs(type(objs[0]), B)
+        del A, B, objs
+        import gc
+        gc.collect()
+        # indices of freed classes are reused
+        for i in range(1000):
+            C = type('C', (), {})
+            self.assertIs(type(C()), C)
+
+    def test_type_dispatch(self):
+        values = [1, True, 2.5, -1e300, None, NotImplemented, range(3),
+                  range(10**6), 1 << 70, 'spam', [], {}, object()]
+        types = [int, bool, float, float, type(None), type(NotImplemented),
+                 range, range, int, str, list, dict, object]
+        self.assertEqual([type(v) for v in values], types)
+        self.assertEqual([v.__class__ for v in values], types)
+        t = _testbitpacked.bench_type_dispatch(values * 10, 10)
+        if BITPACKED:
+            self.assertEqual(set(t), {'Py_TYPE', 'branch'})
+        else:
+            self.assertEqual(set(t), {'Py_TYPE'})
+        self.assertTrue(all(v >= 0.0 for v in t.values()))
+
+    @unittest.skipUnless(mode & _testbitpacked.MODE_STATS,
+                         'requires --with-bitpacked-stats')
+    def test_stats(self):
+        import sys
+        sys.bitpacked_stats_reset()
+        values = [int(s) for s in ['7', '-3', str(1 << 70)]]
+        values += [float(s) for s in ['2.5', 'nan']]
+        values += [range(int('5')), range(int('10') ** 12)]
+        big = values[0] << 62
+        stats = sys.bitpacked_stats()
+        self.assertEqual(set(stats), {'tagged', 'fallback', 'rebox'})
+        tagged, fallback = stats['tagged'], stats['fallback']
+        self.assertGreaterEqual(tagged['LONG'], 2)
+        self.assertGreaterEqual(tagged['FLOAT'], 1)
+        self.assertGreaterEqual(tagged['RANGE'], 1)
+        self.assertGreaterEqual(fallback['long_range'], 2)
+        self.assertGreaterEqual(fallback['float_nan'], 1)
+        self.assertGreaterEqual(fallback['range_bounds'], 1)
+        self.assertGreaterEqual(sum(stats['rebox'].values()), 1)
+        sys.bitpacked_stats_reset()
+        stats = sys.bitpacked_stats()
+        self.assertEqual(stats['fallback']['float_nan'], 0)
+        self.assertEqual(set(stats['rebox'].values()), {0})
+
     def test_refcnt(self):
         from sys import getrefcount
         a = [1234, 567.8, None, True, False, range(20), NotImplemented]
@@ -131,6 +654,468 @@ class BitPackedTestCase(unittest.TestCase):
             self.assertEqual(id(r1) % 8, 0)
             self.assertEqual(id(r2) % 8, 0)
 
+    def test_wide_rangeobject(self):
+        cases = [(100000,), (2**31 - 1,), (0, 2**20, 256), (-2**21, 2**31 - 1, 2**15),
+                 (2**21 - 1, -2**31, -1), (40000, 5, -4), (5, 40000, -4)]
+        for args in cases:
+            r = range(*args)
+            if BITPACKED:
+                self.assertEqual(id(r) % 16, _testbitpacked.BITPACKED_TYPEID_RANGE_WIDE)
+            self.assertEqual(list(r[:5]), [r.start + i * r.step for i in range(min(5, len(r)))])
+            self.assertEqual(pickle.loads(pickle.dumps(r)), r)
+            self.assertEqual(range(*r.__reduce__()[1]), r)
+        r = range(0, 2**20, 256)
+        self.assertEqual(len(r), 4096)
+        self.assertEqual(r[-1], 2**20 - 256)
+        self.assertIn(4096, r)
+        self.assertNotIn(4097, r)
+        self.assertEqual(r.index(2**19), 2048)
+        self.assertEqual(list(reversed(r))[:2], [2**20 - 256, 2**20 - 512])
+        self.assertEqual(r[::-1][:2], range(2**20 - 256, 2**20 - 768, -256))
+        self.assertEqual(r[100:200], range(25600, 51200, 256))
+        self.assertEqual(hash(r), hash(range(0, 2**40, 256)[:4096]))
+        self.assertEqual(repr(range(100000)), 'range(0, 100000)')
+        self.assertEqual(repr(range(40000, 5, -4)), 'range(40000, 5, -4)')
+        self.assertEqual(range(0, 2**31)[::2**62], range(0, 2**31, 2**62))
+        if BITPACKED:
+            self.assertIs(range(100000)[10:20], range(10, 20))
+            self.assertIs(range(0, 2**20, 256)[::2], range(0, 2**20, 512))
+            self.assertEqual(id(range(0, 100000, 3)) % 8, 0)
+            self.assertEqual(id(range(2**31)) % 8, 0)
+
+    def test_range_iteration(self):
+        cases = [(0,), (10,), (-5,), (3, 17), (17, 3), (17, 3, -1), (-20, 20, 7),
+                 (20, -20, -7), (0, 100, 127), (100, 0, -128),
+                 (-32768, 32767, 127), (32767, -32768, -128),
+                 (32760, 32767), (-32768, -32760), (32767, 32760, -1)]
+        for args in cases:
+            expected = list(iter(range(*args)))
+            got = []
+            for i in range(*args):
+                got.append(i)
+            self.assertEqual(got, expected)
+            self.assertEqual([i for i in range(*args)], expected)
+            self.assertEqual(list(i for i in range(*args)), expected)
+            self.assertEqual([j for _ in [0] for j in range(*args)], expected)
+        got = []
+        for i in range(10):
+            if i == 5:
+                break
+            for j in range(i):
+                if j == 2:
+                    continue
+                got.append((i, j))
+        self.assertEqual(got, [(1, 0), (2, 0), (2, 1), (3, 0), (3, 1),
+                               (4, 0), (4, 1), (4, 3)])
+        def gen():
+            for i in range(3):
+                yield i
+        g = gen()
+        self.assertEqual(next(g), 0)
+        import gc
+        gc.collect()
+        self.assertEqual(list(g), [1, 2])
+        r = range(5)
+        for i in r:
+            pass
+        self.assertEqual(list(r), [0, 1, 2, 3, 4])
+        self.assertEqual(i, 4)
+
+    def test_datetime(self):
+        from datetime import date, time, timedelta, timezone
+        class subdate(date):
+            pass
+        d, t, td = date(2024, 2, 29), time(23, 59, 59, 999999), timedelta(-3, 5, 7)
+        if BITPACKED:
+            self.assertEqual(id(d) % 32, _testbitpacked.BITPACKED_TYPEID_DATE)
+            self.assertEqual(id(t) % 32, _testbitpacked.BITPACKED_TYPEID_TIME)
+            self.assertEqual(id(td) % 32, _testbitpacked.BITPACKED_TYPEID_DELTA)
+            self.assertEqual(id(timedelta(2**21 - 1)) % 32,
+                             _testbitpacked.BITPACKED_TYPEID_DELTA)
+            self.assertEqual(id(timedelta(-2**21)) % 32,
+                             _testbitpacked.BITPACKED_TYPEID_DELTA)
+            for boxed in [subdate(2024, 2, 29), time(1, tzinfo=timezone.utc),
+                          timedelta(2**21), timedelta(-2**21 - 1)]:
+                self.assertEqual(id(boxed) % 16, 0)
+        self.assertIs(type(d), date)
+        self.assertEqual((td.days, td.seconds, td.microseconds), (-3, 5, 7))
+        self.assertEqual(timedelta(-2**21, -1).days, -2**21 - 1)
+        self.assertLess(timedelta(-2**21), timedelta(-2**21 + 1, -1))
+        self.assertLess(timedelta(-1, 86399), timedelta(0))
+        self.assertLess(timedelta(2**21 - 1), timedelta(2**21))
+        self.assertEqual(d + td, date(2024, 2, 26))
+        self.assertEqual(d - date(2023, 2, 28), timedelta(366))
+        self.assertEqual(d, subdate(2024, 2, 29))
+        self.assertEqual(hash(d), hash(subdate(2024, 2, 29)))
+        self.assertLess(d, subdate(2024, 3, 1))
+        self.assertLess(date(2023, 12, 31), d)
+        self.assertLess(time(9), time(10))
+        self.assertEqual(hash(t), hash(time(23, 59, 59, 999999)))
+        self.assertEqual(hash(td), hash(timedelta(-3, 5, 7)))
+        self.assertEqual(time(1, tzinfo=timezone.utc), time(1, tzinfo=timezone.utc))
+        with self.assertRaises(TypeError):
+            time(1) < time(1, tzinfo=timezone.utc)
+        self.assertEqual(d.strftime('%Y-%m-%d %a'), '2024-02-29 Thu')
+        self.assertEqual(t.isoformat(), '23:59:59.999999')
+        self.assertEqual(str(td), '-3 days, 0:00:05.000007')
+        self.assertIsNone(t.tzinfo)
+        for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+            self.assertEqual(pickle.loads(pickle.dumps([d, t, td], proto)),
+                             [d, t, td])
+
+    def test_load_global_cache(self):
+        import builtins
+        code = compile('def f():\n    return len(x), x\n', 'cache', 'exec')
+        g = {'x': 'ab'}
+        exec(code, g)
+        f = g['f']
+        self.assertEqual(f(), (2, 'ab'))
+        self.assertEqual(f(), (2, 'ab'))
+        g['x'] = 'abc'
+        self.assertEqual(f(), (3, 'abc'))
+        g['len'] = lambda v: -1
+        self.assertEqual(f(), (-1, 'abc'))
+        del g['len']
+        self.assertEqual(f(), (3, 'abc'))
+        g.update(x=[1])
+        self.assertEqual(f(), (1, [1]))
+        g.pop('x')
+        self.assertRaises(NameError, f)
+        g.setdefault('x', 'z')
+        self.assertEqual(f(), (1, 'z'))
+        builtins.x = 'builtin'
+        try:
+            del g['x']
+            self.assertEqual(f(), (7, 'builtin'))
+            g2 = {}
+            exec(code, g2)
+            self.assertEqual(g2['f'](), (7, 'builtin'))
+            builtins.x = 'changed'
+            self.assertEqual(g2['f'](), (7, 'changed'))
+        finally:
+            del builtins.x
+        self.assertRaises(NameError, g2['f'])
+        # rebinding a global from the callee while the caller loads it
+        g3 = {}
+        exec('n = 0\n'
+             'def bump():\n    global n\n    n += 1\n    return n\n'
+             'def loop():\n    return [n + bump() for _ in range(3)]\n', g3)
+        self.assertEqual(g3['loop'](), [1, 3, 5])
+
+    def test_method_call(self):
+        import dis
+        class A:
+            def m(self, a=0, b=0):
+                return (self, a, b)
+            def __getattr__(self, name):
+                return lambda *args: (name,) + args
+        a = A()
+        ops = [i.opname for i in dis.get_instructions(lambda: a.m(1, b=2))]
+        self.assertIn('LOAD_METHOD', ops)
+        self.assertIn('CALL_METHOD', ops)
+        self.assertEqual(a.m(), (a, 0, 0))
+        self.assertEqual(a.m(1, b=2), (a, 1, 2))
+        self.assertEqual(a.other(1, 2), ('other', 1, 2))
+        a.m = lambda *args: args
+        self.assertEqual(a.m(3), (3,))
+        del a.m
+        self.assertEqual(a.m(*[4], **{'b': 5}), (a, 4, 5))
+        self.assertEqual(A.m(a, 6), (a, 6, 0))
+        self.assertEqual([1, 2].index(2), 1)
+        self.assertEqual((7).to_bytes(1, 'big'), b'\x07')
+        self.assertEqual(super(A, a).__repr__()[:1], '<')
+        # Methods of builtin types, called without binding them
+        l = [1]
+        l.append(2)
+        self.assertEqual(l.pop(), 2)
+        self.assertEqual(l.count(1), 1)
+        self.assertEqual({'k': 8}.get('k'), 8)
+        self.assertEqual((5).bit_length(), 3)
+        with self.assertRaises(TypeError):
+            l.append()
+        with self.assertRaises(TypeError):
+            l.pop(0, 1)
+        with self.assertRaises(TypeError):
+            l.append(x=1)
+        class L(list):
+            pass
+        l = L()
+        l.append = lambda x: 'shadowed'
+        self.assertEqual(l.append(1), 'shadowed')
+        self.assertEqual(l, [])
+        calls = []
+        def profile(frame, event, arg):
+            if event == 'c_call':
+                calls.append(arg.__name__)
+        sys.setprofile(profile)
+        try:
+            l.extend([1])
+            l.clear()
+        finally:
+            sys.setprofile(None)
+        self.assertEqual(calls[:2], ['extend', 'clear'])
+        with self.assertRaises(AttributeError):
+            object().missing()
+        with self.assertRaises(TypeError):
+            a.m(1, 2, 3)
+        # 255 arguments plus self do not fit CALL_METHOD's argument count
+        n = 254
+        class B:
+            def m2(self, *args):
+                return len(args)
+        for k in (n, n + 1):
+            src = 'a.m2(%s)' % ', '.join(['0'] * k)
+            self.assertEqual(eval(src, {'a': B()}), k)
+
+    def test_fastcall(self):
+        d = {'a': 1}
+        self.assertEqual(d.get('a'), 1)
+        self.assertEqual(d.get('b', 2), 2)
+        self.assertIsNone(d.get('b'))
+        self.assertEqual(dict.get(d, 'a'), 1)
+        get = d.get
+        self.assertEqual(get(*['b', 3]), 3)
+        self.assertEqual(d.setdefault('c', 4), 4)
+        self.assertEqual(d.pop('c'), 4)
+        self.assertEqual(d.pop('c', 5), 5)
+        with self.assertRaises(KeyError):
+            d.pop('c')
+        with self.assertRaises(TypeError):
+            d.get()
+        with self.assertRaises(TypeError):
+            get('a', 1, 2)
+        with self.assertRaises(TypeError):
+            d.get('a', default=1)
+        with self.assertRaises(TypeError):
+            get(key='a')
+        # Argument Clinic functions with positional-only parameters
+        self.assertTrue(isinstance(1, int))
+        self.assertEqual(divmod(7, 2), (3, 1))
+        self.assertEqual(format(1.25, '.1f'), '1.2')
+        self.assertEqual(format(*[3]), '3')
+        with self.assertRaises(TypeError):
+            isinstance(1)
+        with self.assertRaises(TypeError):
+            format(1, 2)
+        with self.assertRaises(TypeError):
+            divmod(7, y=2)
+        calls = []
+        def profile(frame, event, arg):
+            if event == 'c_call':
+                calls.append(arg.__name__)
+        sys.setprofile(profile)
+        try:
+            isinstance(1, int)
+            d.get('a')
+        finally:
+            sys.setprofile(None)
+        self.assertEqual(calls[:2], ['isinstance', 'get'])
+
+    def test_quickening(self):
+        def hits(name):
+            return sys._getquickenstats()[name][0]
+        def misses(name):
+            return sys._getquickenstats()[name][1]
+        class P:
+            def __init__(self, x):
+                self.x = x
+        def attr(p):
+            return p.x
+        co_code = attr.__code__.co_code
+        before = hits('LOAD_ATTR_INSTANCE_DICT')
+        ps = [P(i) for i in range(40)]
+        self.assertEqual([attr(p) for p in ps], list(range(40)))
+        self.assertGreater(hits('LOAD_ATTR_INSTANCE_DICT'), before)
+        self.assertEqual(attr.__code__.co_code, co_code)
+        # a property added to the class takes precedence again
+        before = misses('LOAD_ATTR_INSTANCE_DICT')
+        P.x = property(lambda self: 'property')
+        self.assertEqual(attr(ps[0]), 'property')
+        self.assertGreater(misses('LOAD_ATTR_INSTANCE_DICT'), before)
+        del P.x
+        self.assertEqual([attr(p) for p in ps], list(range(40)))
+        class S:
+            __slots__ = ('x',)
+        s = S()
+        s.x = 'slot'
+        class G:
+            def __getattr__(self, name):
+                return 'getattr'
+        self.assertEqual(attr(s), 'slot')
+        self.assertEqual(attr(G()), 'getattr')
+        self.assertEqual(attr(ps[2]), 2)
+        try:
+            attr(P.__new__(P))
+        except AttributeError as e:
+            self.assertEqual(e.__traceback__.tb_next.tb_lineno,
+                             attr.__code__.co_firstlineno + 1)
+        else:
+            self.fail('AttributeError not raised')
+
+        g = {}
+        exec('G = 1\ndef load():\n    return G\n', g)
+        before = hits('LOAD_GLOBAL_CACHED')
+        self.assertEqual([g['load']() for _ in range(40)], [1] * 40)
+        self.assertGreater(hits('LOAD_GLOBAL_CACHED'), before)
+        g['G'] = 2
+        self.assertEqual(g['load'](), 2)
+        del g['G']
+        self.assertRaises(NameError, g['load'])
+
+        compares = {}
+        for op in ('<', '<=', '==', '!=', '>', '>='):
+            exec('def compare(a, b):\n    return a %s b\n' % op, compares)
+            compare = compares['compare']
+            before = hits('COMPARE_OP_FLOAT')
+            for i in range(40):
+                a = i * 0.25
+                self.assertEqual(compare(a, 5.0), eval('a %s 5.0' % op))
+            self.assertGreater(hits('COMPARE_OP_FLOAT'), before)
+            nan = float('nan')
+            self.assertEqual(compare(nan, nan), op == '!=')
+            self.assertEqual(compare(2, 2.0), op in ('<=', '==', '>='))
+            self.assertEqual(compare('a', 'a'), op in ('<=', '==', '>='))
+        with self.assertRaises(TypeError):
+            compare(1.0, 'a')
+
+        def add(a, b):
+            return a + b
+        before = hits('BINARY_ADD_TAGGED_INT')
+        self.assertEqual([add(i, 1) for i in range(40)], list(range(1, 41)))
+        if BITPACKED:
+            self.assertGreater(hits('BINARY_ADD_TAGGED_INT'), before)
+        self.assertEqual(add(2 ** 62, 2 ** 62), 2 ** 63)
+        self.assertEqual(add('a', 'b'), 'ab')
+        self.assertEqual(add(1, 0.5), 1.5)
+        self.assertEqual(add(3, 4), 7)
+
+        # a loop quickens the frame it runs in, and a suspended generator
+        # resumes in the quickened code
+        def total(ps):
+            t = 0
+            for p in ps:
+                t = t + p.x
+            return t
+        self.assertEqual(total(ps), sum(range(40)))
+        def gen(ps):
+            for p in ps:
+                yield p.x < 20.5
+        g1 = gen([P(float(i)) for i in range(40)])
+        self.assertEqual([next(g1) for _ in range(3)], [True] * 3)
+        self.assertEqual(list(gen([P(1.0)] * 40)), [True] * 40)
+        self.assertEqual(sum(g1), 18)
+
+    def test_superinstructions(self):
+        import dis
+        def opnames(f):
+            return [i.opname for i in dis.get_instructions(f)]
+        class P:
+            def __init__(self, x):
+                self.x = x
+        def pairs(a, b):
+            c = a.x; return a if a.x < b.x else c
+        ops = opnames(pairs)
+        for op in ('LOAD_FAST__LOAD_ATTR', 'STORE_FAST__LOAD_FAST',
+                   'COMPARE_OP__POP_JUMP_IF_FALSE'):
+            self.assertIn(op, ops)
+        # the second instruction is still there
+        i = ops.index('COMPARE_OP__POP_JUMP_IF_FALSE')
+        self.assertEqual(ops[i + 1], 'POP_JUMP_IF_FALSE')
+        p1, p2 = P(1), P(2)
+        self.assertIs(pairs(p1, p2), p1)
+        self.assertEqual(pairs(p2, p1), 2)
+        self.assertEqual(pairs(P(1.5), P(0.5)), 1.5)
+        self.assertEqual(pairs(P(float('nan')), P(1.0)) != 0, True)
+        with self.assertRaises(TypeError):
+            pairs(P('a'), P(1))
+        class Truthy:
+            def __lt__(self, other):
+                return []
+        self.assertEqual(pairs(P(Truthy()), P(1)).__class__, Truthy)
+
+        def swap(a, b):
+            return b, a
+        self.assertIn('LOAD_FAST__LOAD_FAST', opnames(swap))
+        self.assertEqual(swap(1, 2), (2, 1))
+        # a local that is unbound in the first or the second place
+        def unbound(first):
+            if first:
+                b = 2
+            else:
+                a = 1
+            return None, a, b
+        self.assertIn('LOAD_FAST__LOAD_FAST', opnames(unbound))
+        for first, name in ((True, "'a'"), (False, "'b'")):
+            try:
+                unbound(first)
+            except UnboundLocalError as e:
+                self.assertIn(name, str(e))
+                self.assertEqual(e.__traceback__.tb_next.tb_lineno,
+                                 unbound.__code__.co_firstlineno + 5)
+            else:
+                self.fail('UnboundLocalError not raised')
+
+        # jumps to the second instruction of a pair
+        def either(a, b):
+            return (a or b).x
+        self.assertIn('LOAD_FAST__LOAD_ATTR', opnames(either))
+        self.assertEqual(either(p1, None), 1)
+        self.assertEqual(either(None, p2), 2)
+        # a pair across lines still reports the line of the second
+        def lines(a, c):
+            b = a
+            return c.x
+        self.assertIn('STORE_FAST__LOAD_FAST', opnames(lines))
+        line = lines.__code__.co_firstlineno
+        try:
+            lines(1, None)
+        except AttributeError as e:
+            self.assertEqual(e.__traceback__.tb_next.tb_lineno, line + 2)
+        else:
+            self.fail('AttributeError not raised')
+        events = []
+        def trace(frame, event, arg):
+            if frame.f_code in (pairs.__code__, lines.__code__):
+                events.append((event, frame.f_lineno))
+            return trace
+        sys.settrace(trace)
+        try:
+            pairs(p1, p2)
+            lines(1, p2)
+        finally:
+            sys.settrace(None)
+        pline = pairs.__code__.co_firstlineno
+        self.assertEqual(events, [('call', pline), ('line', pline + 1),
+                                  ('return', pline + 1),
+                                  ('call', line), ('line', line + 1),
+                                  ('line', line + 2), ('return', line + 2)])
+
+        def matches(e):
+            try:
+                raise e
+            except ValueError:
+                return 'value'
+            except Exception:
+                return 'other'
+        self.assertEqual(matches(ValueError()), 'value')
+        self.assertEqual(matches(KeyError()), 'other')
+        def concat(s, n):
+            for i in range(n):
+                s = s + 'x'; t = s
+            return t
+        self.assertEqual(concat('', 5), 'xxxxx')
+        # quickened LOAD_ATTR behind LOAD_FAST__LOAD_ATTR
+        def attr(p):
+            return p.x
+        self.assertIn('LOAD_FAST__LOAD_ATTR', opnames(attr))
+        before = sys._getquickenstats()['LOAD_ATTR_INSTANCE_DICT'][0]
+        self.assertEqual([attr(p1) for _ in range(40)], [1] * 40)
+        self.assertGreater(sys._getquickenstats()['LOAD_ATTR_INSTANCE_DICT'][0],
+                           before)
+        P.x = property(lambda self: 'property')
+        self.assertEqual(attr(p1), 'property')
+        del P.x
+
 
 if __name__ == "__main__":
     unittest.main()
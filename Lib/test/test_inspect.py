@@ -1,6 +1,5 @@
 import builtins
 import collections
-import datetime
 import functools
 import importlib
 import inspect
@@ -128,9 +127,10 @@ class TestPredicates(IsTestBase):
             self.istest(inspect.iscoroutinefunction, 'coroutine_function_example')
 
         if hasattr(types, 'MemberDescriptorType'):
-            self.istest(inspect.ismemberdescriptor, 'datetime.timedelta.days')
+            # timedelta.days is a getset descriptor in bitpacked builds
+            self.istest(inspect.ismemberdescriptor, 'types.FunctionType.__globals__')
         else:
-            self.assertFalse(inspect.ismemberdescriptor(datetime.timedelta.days))
+            self.assertFalse(inspect.ismemberdescriptor(types.FunctionType.__globals__))
 
     def test_iscoroutine(self):
         gen_coro = gen_coroutine_function_example(1)
@@ -374,8 +374,11 @@ class InstancingTestCase(unittest.TestCase, HelperMixin):
         self.helper3(self.intobj, simple=True)
 
     def testFloat(self):
+        from sysconfig import get_config_vars
         self.helper(self.floatobj)
-        self.helper3(self.floatobj)
+        # tagged floats are never shared, so version 3 adds no references
+        self.helper3(self.floatobj,
+                     simple=bool(get_config_vars().get('BITPACKED')))
 
     def testStr(self):
         self.helper(self.strobj)
@@ -25,7 +25,7 @@ class TestSundryScripts(unittest.TestCase):
     # scripts that use windows-only modules
     windows_only = ['win_add2path']
     # blacklisted for other reasons
-    other = ['analyze_dxp']
+    other = ['analyze_dxp', 'dxpairs']
 
     skiplist = blacklist + whitelist + windows_only + other
 
@@ -60,13 +60,13 @@ class datetime.datetime "PyDateTime_DateTime *" "&PyDateTime_DateTimeType"
 /* Date accessors for date and datetime. */
 #define SET_YEAR(o, v)          (((o)->data[0] = ((v) & 0xff00) >> 8), \
                  ((o)->data[1] = ((v) & 0x00ff)))
-#define SET_MONTH(o, v)         (PyDateTime_GET_MONTH(o) = (v))
-#define SET_DAY(o, v)           (PyDateTime_GET_DAY(o) = (v))
+#define SET_MONTH(o, v)         ((o)->data[2] = (v))
+#define SET_DAY(o, v)           ((o)->data[3] = (v))
 
 /* Date/Time accessors for datetime. */
-#define DATE_SET_HOUR(o, v)     (PyDateTime_DATE_GET_HOUR(o) = (v))
-#define DATE_SET_MINUTE(o, v)   (PyDateTime_DATE_GET_MINUTE(o) = (v))
-#define DATE_SET_SECOND(o, v)   (PyDateTime_DATE_GET_SECOND(o) = (v))
+#define DATE_SET_HOUR(o, v)     ((o)->data[4] = (v))
+#define DATE_SET_MINUTE(o, v)   ((o)->data[5] = (v))
+#define DATE_SET_SECOND(o, v)   ((o)->data[6] = (v))
 #define DATE_SET_MICROSECOND(o, v)      \
     (((o)->data[7] = ((v) & 0xff0000) >> 16), \
      ((o)->data[8] = ((v) & 0x00ff00) >> 8), \
@@ -77,27 +77,28 @@ class datetime.datetime "PyDateTime_DateTime *" "&PyDateTime_DateTimeType"
 #define TIME_GET_MINUTE         PyDateTime_TIME_GET_MINUTE
 #define TIME_GET_SECOND         PyDateTime_TIME_GET_SECOND
 #define TIME_GET_MICROSECOND    PyDateTime_TIME_GET_MICROSECOND
-#define TIME_SET_HOUR(o, v)     (PyDateTime_TIME_GET_HOUR(o) = (v))
-#define TIME_SET_MINUTE(o, v)   (PyDateTime_TIME_GET_MINUTE(o) = (v))
-#define TIME_SET_SECOND(o, v)   (PyDateTime_TIME_GET_SECOND(o) = (v))
+#define TIME_SET_HOUR(o, v)     ((o)->data[0] = (v))
+#define TIME_SET_MINUTE(o, v)   ((o)->data[1] = (v))
+#define TIME_SET_SECOND(o, v)   ((o)->data[2] = (v))
 #define TIME_SET_MICROSECOND(o, v)      \
     (((o)->data[3] = ((v) & 0xff0000) >> 16), \
      ((o)->data[4] = ((v) & 0x00ff00) >> 8), \
      ((o)->data[5] = ((v) & 0x0000ff)))
 
 /* Delta accessors for timedelta. */
-#define GET_TD_DAYS(o)          (((PyDateTime_Delta *)(o))->days)
-#define GET_TD_SECONDS(o)       (((PyDateTime_Delta *)(o))->seconds)
-#define GET_TD_MICROSECONDS(o)  (((PyDateTime_Delta *)(o))->microseconds)
+#define GET_TD_DAYS             PyDateTime_DELTA_GET_DAYS
+#define GET_TD_SECONDS          PyDateTime_DELTA_GET_SECONDS
+#define GET_TD_MICROSECONDS     PyDateTime_DELTA_GET_MICROSECONDS
 
 #define SET_TD_DAYS(o, v)       ((o)->days = (v))
 #define SET_TD_SECONDS(o, v)    ((o)->seconds = (v))
 #define SET_TD_MICROSECONDS(o, v) ((o)->microseconds = (v))
 
 /* p is a pointer to a time or a datetime object; HASTZINFO(p) returns
- * p->hastzinfo.
+ * p->hastzinfo.  Tagged times never have a tzinfo.
  */
-#define HASTZINFO(p) (((_PyDateTime_BaseTZInfo *)(p))->hastzinfo)
+#define HASTZINFO(p) (!BITPACKED_CHECK(p) && \
+                      ((_PyDateTime_BaseTZInfo *)(p))->hastzinfo)
 #define GET_TIME_TZINFO(p) (HASTZINFO(p) ? \
                             ((PyDateTime_Time *)(p))->tzinfo : Py_None)
 #define GET_DT_TZINFO(p) (HASTZINFO(p) ? \
@@ -116,6 +117,33 @@ static PyTypeObject PyDateTime_TimeType;
 static PyTypeObject PyDateTime_TZInfoType;
 static PyTypeObject PyDateTime_TimeZoneType;
 
+#ifdef BITPACKED
+/* Exact dates, naive times and timedeltas of -2**21 <= days < 2**21 are
+ * made as tagged values; see datetime.h for the layout.  Subclasses,
+ * times with a tzinfo and longer timedeltas are still allocated.
+ */
+#define DELTA_TAGGED_DAYS_MIN   (-(1 << 21))
+#define DELTA_TAGGED_DAYS_MAX   ((1 << 21) - 1)
+#define DATE_PACK(y, m, d)                                      \
+    ((PyObject *)((BITPACKED_UWORD)(y) << 14 |                  \
+                  (BITPACKED_UWORD)(m) << 10 |                  \
+                  (BITPACKED_UWORD)(d) << 5 | BITPACKED_TYPEID_DATE))
+#define TIME_PACK(hh, mm, ss, us)                               \
+    ((PyObject *)((BITPACKED_UWORD)(hh) << 37 |                 \
+                  (BITPACKED_UWORD)(mm) << 31 |                 \
+                  (BITPACKED_UWORD)(ss) << 25 |                 \
+                  (BITPACKED_UWORD)(us) << 5 | BITPACKED_TYPEID_TIME))
+#define DELTA_PACK(d, s, us)                                    \
+    ((PyObject *)((BITPACKED_UWORD)(BITPACKED_SWORD)(d) << 42 | \
+                  (BITPACKED_UWORD)(s) << 25 |                  \
+                  (BITPACKED_UWORD)(us) << 5 | BITPACKED_TYPEID_DELTA))
+
+/* Compare two tagged values of the same type: -1, 0 or 1. */
+#define TAGGED_CMP(a, b) \
+    (((BITPACKED_SWORD)(a) > (BITPACKED_SWORD)(b)) - \
+     ((BITPACKED_SWORD)(a) < (BITPACKED_SWORD)(b)))
+#endif
+
 _Py_IDENTIFIER(as_integer_ratio);
 _Py_IDENTIFIER(fromutc);
 _Py_IDENTIFIER(isoformat);
@@ -663,6 +691,12 @@ new_date_ex(int year, int month, int day, PyTypeObject *type)
 {
     PyDateTime_Date *self;
 
+#ifdef BITPACKED
+    if (type == &PyDateTime_DateType) {
+        BITPACKED_STAT_TAGGED(BITPACKED_TYPEID_DATE);
+        return DATE_PACK(year, month, day);
+    }
+#endif
     self = (PyDateTime_Date *) (type->tp_alloc(type, 0));
     if (self != NULL)
         set_date_fields(self, year, month, day);
@@ -708,6 +742,12 @@ new_time_ex(int hour, int minute, int second, int usecond,
     PyDateTime_Time *self;
     char aware = tzinfo != Py_None;
 
+#ifdef BITPACKED
+    if (!aware && type == &PyDateTime_TimeType) {
+        BITPACKED_STAT_TAGGED(BITPACKED_TYPEID_TIME);
+        return TIME_PACK(hour, minute, second, usecond);
+    }
+#endif
     self = (PyDateTime_Time *) (type->tp_alloc(type, aware));
     if (self != NULL) {
         self->hastzinfo = aware;
@@ -747,6 +787,13 @@ new_delta_ex(int days, int seconds, int microseconds, int normalize,
     if (check_delta_day_range(days) < 0)
         return NULL;
 
+#ifdef BITPACKED
+    if (type == &PyDateTime_DeltaType &&
+        DELTA_TAGGED_DAYS_MIN <= days && days <= DELTA_TAGGED_DAYS_MAX) {
+        BITPACKED_STAT_TAGGED(BITPACKED_TYPEID_DELTA);
+        return DELTA_PACK(days, seconds, microseconds);
+    }
+#endif
     self = (PyDateTime_Delta *) (type->tp_alloc(type, 0));
     if (self != NULL) {
         self->hashcode = -1;
@@ -1806,7 +1853,13 @@ delta_subtract(PyObject *left, PyObject *right)
 static int
 delta_cmp(PyObject *self, PyObject *other)
 {
-    int diff = GET_TD_DAYS(self) - GET_TD_DAYS(other);
+    int diff;
+
+#ifdef BITPACKED
+    if (BITPACKED_CHECK(self) && BITPACKED_CHECK(other))
+        return TAGGED_CMP(self, other);
+#endif
+    diff = GET_TD_DAYS(self) - GET_TD_DAYS(other);
     if (diff == 0) {
         diff = GET_TD_SECONDS(self) - GET_TD_SECONDS(other);
         if (diff == 0)
@@ -1833,6 +1886,17 @@ static PyObject *delta_getstate(PyDateTime_Delta *self);
 static Py_hash_t
 delta_hash(PyDateTime_Delta *self)
 {
+    if (BITPACKED_CHECK(self)) {
+        /* Nowhere to cache the hash; it must still match the
+           allocated form of the same value. */
+        Py_hash_t hash = -1;
+        PyObject *temp = delta_getstate(self);
+        if (temp != NULL) {
+            hash = PyObject_Hash(temp);
+            Py_DECREF(temp);
+        }
+        return hash;
+    }
     if (self->hashcode == -1) {
         PyObject *temp = delta_getstate(self);
         if (temp != NULL) {
@@ -2284,6 +2348,38 @@ delta_reduce(PyDateTime_Delta* self)
 
 #define OFFSET(field)  offsetof(PyDateTime_Delta, field)
 
+#ifdef BITPACKED
+/* Tagged timedeltas have no struct to read members from. */
+static PyObject *
+delta_days(PyDateTime_Delta *self, void *unused)
+{
+    return PyLong_FromLong(GET_TD_DAYS(self));
+}
+
+static PyObject *
+delta_seconds(PyDateTime_Delta *self, void *unused)
+{
+    return PyLong_FromLong(GET_TD_SECONDS(self));
+}
+
+static PyObject *
+delta_microseconds(PyDateTime_Delta *self, void *unused)
+{
+    return PyLong_FromLong(GET_TD_MICROSECONDS(self));
+}
+
+static PyGetSetDef delta_getset[] = {
+    {"days",         (getter)delta_days, NULL,
+     PyDoc_STR("Number of days.")},
+
+    {"seconds",      (getter)delta_seconds, NULL,
+     PyDoc_STR("Number of seconds (>= 0 and less than 1 day).")},
+
+    {"microseconds", (getter)delta_microseconds, NULL,
+     PyDoc_STR("Number of microseconds (>= 0 and less than 1 second).")},
+    {NULL}
+};
+#else
 static PyMemberDef delta_members[] = {
 
     {"days",         T_INT, OFFSET(days),         READONLY,
@@ -2296,6 +2392,7 @@ static PyMemberDef delta_members[] = {
      PyDoc_STR("Number of microseconds (>= 0 and less than 1 second).")},
     {NULL}
 };
+#endif
 
 static PyMethodDef delta_methods[] = {
     {"total_seconds", (PyCFunction)delta_total_seconds, METH_NOARGS,
@@ -2375,8 +2472,13 @@ static PyTypeObject PyDateTime_DeltaType = {
     0,                                                  /* tp_iter */
     0,                                                  /* tp_iternext */
     delta_methods,                                      /* tp_methods */
+#ifdef BITPACKED
+    0,                                                  /* tp_members */
+    delta_getset,                                       /* tp_getset */
+#else
     delta_members,                                      /* tp_members */
     0,                                                  /* tp_getset */
+#endif
     0,                                                  /* tp_base */
     0,                                                  /* tp_dict */
     0,                                                  /* tp_descr_get */
@@ -2440,6 +2542,17 @@ date_new(PyTypeObject *type, PyObject *args, PyObject *kw)
     {
         PyDateTime_Date *me;
 
+#ifdef BITPACKED
+        if (type == &PyDateTime_DateType) {
+            unsigned char *pdata = (unsigned char *)PyBytes_AS_STRING(state);
+            int y = (pdata[0] << 8) | pdata[1];
+
+            /* The state is not range checked; fields too wide to be
+               tagged keep the allocated form. */
+            if (y < (1 << 14) && pdata[3] < 32)
+                return new_date_ex(y, pdata[2], pdata[3], type);
+        }
+#endif
         me = (PyDateTime_Date *) (type->tp_alloc(type, 0));
         if (me != NULL) {
             char *pdata = PyBytes_AS_STRING(state);
@@ -2732,13 +2845,39 @@ date_isocalendar(PyDateTime_Date *self)
 
 /* Miscellaneous methods. */
 
+/* Return the data bytes of a date or datetime; a tagged date has them
+ * filled into buf, which must hold _PyDateTime_DATE_DATASIZE bytes.
+ */
+static unsigned char *
+date_data(PyObject *self, unsigned char *buf)
+{
+#ifdef BITPACKED
+    if (BITPACKED_CHECK(self)) {
+        int y = GET_YEAR(self);
+        buf[0] = (unsigned char)(y >> 8);
+        buf[1] = (unsigned char)y;
+        buf[2] = (unsigned char)GET_MONTH(self);
+        buf[3] = (unsigned char)GET_DAY(self);
+        return buf;
+    }
+#endif
+    return ((PyDateTime_Date *)self)->data;
+}
+
 static PyObject *
 date_richcompare(PyObject *self, PyObject *other, int op)
 {
     if (PyDate_Check(other)) {
-        int diff = memcmp(((PyDateTime_Date *)self)->data,
-                          ((PyDateTime_Date *)other)->data,
-                          _PyDateTime_DATE_DATASIZE);
+        unsigned char buf1[_PyDateTime_DATE_DATASIZE];
+        unsigned char buf2[_PyDateTime_DATE_DATASIZE];
+        int diff;
+
+#ifdef BITPACKED
+        if (BITPACKED_CHECK(self) && BITPACKED_CHECK(other))
+            return diff_to_bool(TAGGED_CMP(self, other), op);
+#endif
+        diff = memcmp(date_data(self, buf1), date_data(other, buf2),
+                      _PyDateTime_DATE_DATASIZE);
         return diff_to_bool(diff, op);
     }
     else
@@ -2786,6 +2925,11 @@ static PyObject *date_getstate(PyDateTime_Date *self);
 static Py_hash_t
 date_hash(PyDateTime_Date *self)
 {
+    if (BITPACKED_CHECK(self)) {
+        unsigned char buf[_PyDateTime_DATE_DATASIZE];
+        return generic_hash(date_data((PyObject *)self, buf),
+                            _PyDateTime_DATE_DATASIZE);
+    }
     if (self->hashcode == -1)
         self->hashcode = generic_hash(
             (unsigned char *)self->data, _PyDateTime_DATE_DATASIZE);
@@ -2815,8 +2959,9 @@ static PyObject *
 date_getstate(PyDateTime_Date *self)
 {
     PyObject* field;
-    field = PyBytes_FromStringAndSize((char*)self->data,
-                                       _PyDateTime_DATE_DATASIZE);
+    unsigned char buf[_PyDateTime_DATE_DATASIZE];
+    field = PyBytes_FromStringAndSize(
+        (char*)date_data((PyObject *)self, buf), _PyDateTime_DATE_DATASIZE);
     return Py_BuildValue("(N)", field);
 }
 
@@ -3512,6 +3657,16 @@ time_new(PyTypeObject *type, PyObject *args, PyObject *kw)
             }
         }
         aware = (char)(tzinfo != Py_None);
+#ifdef BITPACKED
+        if (!aware && type == &PyDateTime_TimeType) {
+            unsigned char *pdata = (unsigned char *)PyBytes_AS_STRING(state);
+
+            if (pdata[1] < 64 && pdata[2] < 64 && pdata[3] < 16)
+                return new_time_ex(pdata[0], pdata[1], pdata[2],
+                                   (pdata[3] << 16) | (pdata[4] << 8) |
+                                   pdata[5], Py_None, type);
+        }
+#endif
         me = (PyDateTime_Time *) (type->tp_alloc(type, aware));
         if (me != NULL) {
             char *pdata = PyBytes_AS_STRING(state);
@@ -3673,19 +3828,45 @@ time_strftime(PyDateTime_Time *self, PyObject *args, PyObject *kw)
  * Miscellaneous methods.
  */
 
+/* Return the data bytes of a time; a tagged time has them filled into
+ * buf, which must hold _PyDateTime_TIME_DATASIZE bytes.
+ */
+static unsigned char *
+time_data(PyObject *self, unsigned char *buf)
+{
+#ifdef BITPACKED
+    if (BITPACKED_CHECK(self)) {
+        int us = TIME_GET_MICROSECOND(self);
+        buf[0] = (unsigned char)TIME_GET_HOUR(self);
+        buf[1] = (unsigned char)TIME_GET_MINUTE(self);
+        buf[2] = (unsigned char)TIME_GET_SECOND(self);
+        buf[3] = (unsigned char)(us >> 16);
+        buf[4] = (unsigned char)(us >> 8);
+        buf[5] = (unsigned char)us;
+        return buf;
+    }
+#endif
+    return ((PyDateTime_Time *)self)->data;
+}
+
 static PyObject *
 time_richcompare(PyObject *self, PyObject *other, int op)
 {
     PyObject *result = NULL;
     PyObject *offset1, *offset2;
+    unsigned char buf1[_PyDateTime_TIME_DATASIZE];
+    unsigned char buf2[_PyDateTime_TIME_DATASIZE];
     int diff;
 
     if (! PyTime_Check(other))
         Py_RETURN_NOTIMPLEMENTED;
 
+#ifdef BITPACKED
+    if (BITPACKED_CHECK(self) && BITPACKED_CHECK(other))
+        return diff_to_bool(TAGGED_CMP(self, other), op);
+#endif
     if (GET_TIME_TZINFO(self) == GET_TIME_TZINFO(other)) {
-        diff = memcmp(((PyDateTime_Time *)self)->data,
-                      ((PyDateTime_Time *)other)->data,
+        diff = memcmp(time_data(self, buf1), time_data(other, buf2),
                       _PyDateTime_TIME_DATASIZE);
         return diff_to_bool(diff, op);
     }
@@ -3702,8 +3883,7 @@ time_richcompare(PyObject *self, PyObject *other, int op)
     if ((offset1 == offset2) ||
         (PyDelta_Check(offset1) && PyDelta_Check(offset2) &&
          delta_cmp(offset1, offset2) == 0)) {
-        diff = memcmp(((PyDateTime_Time *)self)->data,
-                      ((PyDateTime_Time *)other)->data,
+        diff = memcmp(time_data(self, buf1), time_data(other, buf2),
                       _PyDateTime_TIME_DATASIZE);
         result = diff_to_bool(diff, op);
     }
@@ -3749,6 +3929,11 @@ time_richcompare(PyObject *self, PyObject *other, int op)
 static Py_hash_t
 time_hash(PyDateTime_Time *self)
 {
+    if (BITPACKED_CHECK(self)) {
+        unsigned char buf[_PyDateTime_TIME_DATASIZE];
+        return generic_hash(time_data((PyObject *)self, buf),
+                            _PyDateTime_TIME_DATASIZE);
+    }
     if (self->hashcode == -1) {
         PyObject *offset;
 
@@ -3823,9 +4008,10 @@ time_getstate(PyDateTime_Time *self)
 {
     PyObject *basestate;
     PyObject *result = NULL;
+    unsigned char buf[_PyDateTime_TIME_DATASIZE];
 
-    basestate =  PyBytes_FromStringAndSize((char *)self->data,
-                                            _PyDateTime_TIME_DATASIZE);
+    basestate =  PyBytes_FromStringAndSize(
+        (char *)time_data((PyObject *)self, buf), _PyDateTime_TIME_DATASIZE);
     if (basestate != NULL) {
         if (! HASTZINFO(self) || self->tzinfo == Py_None)
             result = PyTuple_Pack(1, basestate);
@@ -5242,6 +5428,15 @@ PyInit__datetime(void)
         return NULL;
     if (PyType_Ready(&PyDateTime_TimeZoneType) < 0)
         return NULL;
+#ifdef BITPACKED
+    if (_PyBitpacked_RegisterTaggedType(BITPACKED_TYPEID_DATE,
+                                        &PyDateTime_DateType) < 0 ||
+        _PyBitpacked_RegisterTaggedType(BITPACKED_TYPEID_TIME,
+                                        &PyDateTime_TimeType) < 0 ||
+        _PyBitpacked_RegisterTaggedType(BITPACKED_TYPEID_DELTA,
+                                        &PyDateTime_DeltaType) < 0)
+        return NULL;
+#endif
 
     /* timedelta values */
     d = PyDateTime_DeltaType.tp_dict;
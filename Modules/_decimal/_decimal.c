@@ -2124,13 +2124,8 @@ dec_from_long(PyTypeObject *type, const PyObject *v,
     }
 
     if(BITPACKED_CHECK(v)) {
-        long n = BITPACKED_LONG_VALUE(v);
-        if(n >= 0) {
-            _dec_settriple(dec, MPD_POS, n, 0);
-        }else{
-            _dec_settriple(dec, MPD_NEG, -n, 0);
-        }
-        mpd_qfinalize(MPD(dec), ctx, status);
+        /* the payload may exceed 32 bits, so _dec_settriple() is not enough */
+        mpd_qset_ssize(MPD(dec), BITPACKED_LONG_VALUE(v), ctx, status);
         return dec;
     }
 
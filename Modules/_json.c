@@ -1,6 +1,5 @@
 #include "Python.h"
 #include "structmember.h"
-#include "accu.h"
 
 #ifdef __GNUC__
 #define UNUSED __attribute__((__unused__))
@@ -104,11 +103,11 @@ encoder_dealloc(PyObject *self);
 static int
 encoder_clear(PyObject *self);
 static int
-encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc, PyObject *seq, Py_ssize_t indent_level);
+encoder_listencode_list(PyEncoderObject *s, _PyUnicodeWriter *writer, PyObject *seq, Py_ssize_t indent_level);
 static int
-encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc, PyObject *obj, Py_ssize_t indent_level);
+encoder_listencode_obj(PyEncoderObject *s, _PyUnicodeWriter *writer, PyObject *obj, Py_ssize_t indent_level);
 static int
-encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc, PyObject *dct, Py_ssize_t indent_level);
+encoder_listencode_dict(PyEncoderObject *s, _PyUnicodeWriter *writer, PyObject *dct, Py_ssize_t indent_level);
 static PyObject *
 _encoded_const(PyObject *obj);
 static void
@@ -1028,9 +1027,38 @@ _match_number_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t start, Py_
     else {
         Py_ssize_t i, n;
         char *buf;
+        n = idx - start;
+#ifdef BITPACKED
+        /* Ints of up to 18 characters (which fit in a C long) and short
+           floats are converted without a bytes copy, and come out as
+           tagged values when they fit */
+        if (n <= 18 && !is_float) {
+            long val = 0;
+            i = start;
+            if (PyUnicode_READ(kind, str, i) == '-')
+                i++;
+            for (; i < idx; i++)
+                val = val * 10 + (PyUnicode_READ(kind, str, i) - '0');
+            *next_idx_ptr = idx;
+            if (PyUnicode_READ(kind, str, start) == '-')
+                val = -val;
+            return PyLong_FromLong(val);
+        }
+        if (n < 32 && is_float) {
+            char fbuf[32];
+            double x;
+            for (i = 0; i < n; i++)
+                fbuf[i] = (char) PyUnicode_READ(kind, str, i + start);
+            fbuf[n] = '\0';
+            x = PyOS_string_to_double(fbuf, NULL, NULL);
+            if (x == -1.0 && PyErr_Occurred())
+                return NULL;
+            *next_idx_ptr = idx;
+            return PyFloat_FromDouble(x);
+        }
+#endif
         /* Straight conversion to ASCII, to avoid costly conversion of
            decimal unicode digits (which cannot appear here) */
-        n = idx - start;
         numstr = PyBytes_FromStringAndSize(NULL, n);
         if (numstr == NULL)
             return NULL;
@@ -1392,20 +1420,25 @@ encoder_call(PyObject *self, PyObject *args, PyObject *kwds)
     PyObject *obj;
     Py_ssize_t indent_level;
     PyEncoderObject *s;
-    _PyAccu acc;
+    _PyUnicodeWriter writer;
+    PyObject *result;
 
     assert(PyEncoder_Check(self));
     s = (PyEncoderObject *)self;
     if (!PyArg_ParseTupleAndKeywords(args, kwds, "On:_iterencode", kwlist,
         &obj, &indent_level))
         return NULL;
-    if (_PyAccu_Init(&acc))
-        return NULL;
-    if (encoder_listencode_obj(s, &acc, obj, indent_level)) {
-        _PyAccu_Destroy(&acc);
+    _PyUnicodeWriter_Init(&writer);
+    writer.overallocate = 1;
+    if (encoder_listencode_obj(s, &writer, obj, indent_level)) {
+        _PyUnicodeWriter_Dealloc(&writer);
         return NULL;
     }
-    return _PyAccu_FinishAsList(&acc);
+    result = _PyUnicodeWriter_Finish(&writer);
+    if (result == NULL)
+        return NULL;
+    /* json.encoder joins the chunks it gets; the whole output is one */
+    return Py_BuildValue("(N)", result);
 }
 
 static PyObject *
@@ -1479,58 +1512,117 @@ encoder_encode_string(PyEncoderObject *s, PyObject *obj)
 }
 
 static int
-_steal_accumulate(_PyAccu *acc, PyObject *stolen)
+_steal_accumulate(_PyUnicodeWriter *writer, PyObject *stolen)
 {
-    /* Append stolen and then decrement its reference count */
-    int rval = _PyAccu_Accumulate(acc, stolen);
+    /* Write stolen and then decrement its reference count */
+    int rval = _PyUnicodeWriter_WriteStr(writer, stolen);
     Py_DECREF(stolen);
     return rval;
 }
 
+#ifdef BITPACKED
+/* Write a tagged int or float straight into the writer, with the digits
+   that int.__str__() and float.__repr__() would give, but without making
+   a str object for each number. */
 static int
-encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
+bitpacked_encode_number(PyEncoderObject *s, _PyUnicodeWriter *writer,
+                        PyObject *obj)
+{
+    if (BITPACKED_LONG_CHECKEXACT(obj)) {
+        /* 59 bits need at most 18 digits and a sign */
+        char buf[20];
+        char *p = buf + sizeof(buf);
+        long val = BITPACKED_LONG_VALUE(obj);
+        unsigned long u = val < 0 ? 0UL - (unsigned long)val
+                                  : (unsigned long)val;
+        do {
+            *--p = (char)('0' + u % 10);
+            u /= 10;
+        } while (u != 0);
+        if (val < 0)
+            *--p = '-';
+        return _PyUnicodeWriter_WriteASCIIString(writer, p,
+                                                 buf + sizeof(buf) - p);
+    }
+    else {
+        double x = _PyBitpacked_FloatValue(obj);
+        char *buf;
+        int rval;
+
+        if (!Py_IS_FINITE(x)) {
+            /* tagged floats are never NaN */
+            if (!s->allow_nan) {
+                PyErr_SetString(
+                        PyExc_ValueError,
+                        "Out of range float values are not JSON compliant"
+                        );
+                return -1;
+            }
+            if (x > 0)
+                return _PyUnicodeWriter_WriteASCIIString(writer,
+                                                         "Infinity", 8);
+            return _PyUnicodeWriter_WriteASCIIString(writer, "-Infinity", 9);
+        }
+        buf = PyOS_double_to_string(x, 'r', 0, Py_DTSF_ADD_DOT_0, NULL);
+        if (buf == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        rval = _PyUnicodeWriter_WriteASCIIString(writer, buf, strlen(buf));
+        PyMem_Free(buf);
+        return rval;
+    }
+}
+#endif
+
+static int
+encoder_listencode_obj(PyEncoderObject *s, _PyUnicodeWriter *writer,
                        PyObject *obj, Py_ssize_t indent_level)
 {
     /* Encode Python object obj to a JSON term */
     PyObject *newobj;
     int rv;
 
+#ifdef BITPACKED
+    if (BITPACKED_LONG_CHECKEXACT(obj) || BITPACKED_FLOAT_CHECK(obj))
+        return bitpacked_encode_number(s, writer, obj);
+#endif
     if (obj == Py_None || obj == Py_True || obj == Py_False) {
         PyObject *cstr = _encoded_const(obj);
         if (cstr == NULL)
             return -1;
-        return _steal_accumulate(acc, cstr);
+        return _steal_accumulate(writer, cstr);
     }
     else if (PyUnicode_Check(obj))
     {
         PyObject *encoded = encoder_encode_string(s, obj);
         if (encoded == NULL)
             return -1;
-        return _steal_accumulate(acc, encoded);
+        return _steal_accumulate(writer, encoded);
     }
     else if (PyLong_Check(obj)) {
         PyObject *encoded = PyLong_Type.tp_str(obj);
         if (encoded == NULL)
             return -1;
-        return _steal_accumulate(acc, encoded);
+        return _steal_accumulate(writer, encoded);
     }
     else if (PyFloat_Check(obj)) {
         PyObject *encoded = encoder_encode_float(s, obj);
         if (encoded == NULL)
             return -1;
-        return _steal_accumulate(acc, encoded);
+        return _steal_accumulate(writer, encoded);
     }
     else if (PyList_Check(obj) || PyTuple_Check(obj)) {
         if (Py_EnterRecursiveCall(" while encoding a JSON object"))
             return -1;
-        rv = encoder_listencode_list(s, acc, obj, indent_level);
+        rv = encoder_listencode_list(s, writer, obj, indent_level);
         Py_LeaveRecursiveCall();
         return rv;
     }
     else if (PyDict_Check(obj)) {
         if (Py_EnterRecursiveCall(" while encoding a JSON object"))
             return -1;
-        rv = encoder_listencode_dict(s, acc, obj, indent_level);
+        rv = encoder_listencode_dict(s, writer, obj, indent_level);
         Py_LeaveRecursiveCall();
         return rv;
     }
@@ -1561,7 +1653,7 @@ encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
 
         if (Py_EnterRecursiveCall(" while encoding a JSON object"))
             return -1;
-        rv = encoder_listencode_obj(s, acc, newobj, indent_level);
+        rv = encoder_listencode_obj(s, writer, newobj, indent_level);
         Py_LeaveRecursiveCall();
 
         Py_DECREF(newobj);
@@ -1581,7 +1673,7 @@ encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
 }
 
 static int
-encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
+encoder_listencode_dict(PyEncoderObject *s, _PyUnicodeWriter *writer,
                         PyObject *dct, Py_ssize_t indent_level)
 {
     /* Encode Python dict dct a JSON term */
@@ -1605,7 +1697,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
             return -1;
     }
     if (Py_SIZE(dct) == 0)
-        return _PyAccu_Accumulate(acc, empty_dict);
+        return _PyUnicodeWriter_WriteStr(writer, empty_dict);
 
     if (s->markers != Py_None) {
         int has_key;
@@ -1623,7 +1715,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         }
     }
 
-    if (_PyAccu_Accumulate(acc, open_dict))
+    if (_PyUnicodeWriter_WriteStr(writer, open_dict))
         goto bail;
 
     if (s->indent != Py_None) {
@@ -1690,7 +1782,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         }
 
         if (idx) {
-            if (_PyAccu_Accumulate(acc, s->item_separator))
+            if (_PyUnicodeWriter_WriteStr(writer, s->item_separator))
                 goto bail;
         }
 
@@ -1698,16 +1790,16 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         Py_CLEAR(kstr);
         if (encoded == NULL)
             goto bail;
-        if (_PyAccu_Accumulate(acc, encoded)) {
+        if (_PyUnicodeWriter_WriteStr(writer, encoded)) {
             Py_DECREF(encoded);
             goto bail;
         }
         Py_DECREF(encoded);
-        if (_PyAccu_Accumulate(acc, s->key_separator))
+        if (_PyUnicodeWriter_WriteStr(writer, s->key_separator))
             goto bail;
 
         value = PyTuple_GET_ITEM(item, 1);
-        if (encoder_listencode_obj(s, acc, value, indent_level))
+        if (encoder_listencode_obj(s, writer, value, indent_level))
             goto bail;
         idx += 1;
         Py_DECREF(item);
@@ -1727,7 +1819,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
 
         yield '\n' + (' ' * (_indent * _current_indent_level))
     }*/
-    if (_PyAccu_Accumulate(acc, close_dict))
+    if (_PyUnicodeWriter_WriteStr(writer, close_dict))
         goto bail;
     return 0;
 
@@ -1741,7 +1833,7 @@ bail:
 
 
 static int
-encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
+encoder_listencode_list(PyEncoderObject *s, _PyUnicodeWriter *writer,
                         PyObject *seq, Py_ssize_t indent_level)
 {
     /* Encode Python list seq to a JSON term */
@@ -1765,7 +1857,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
         return -1;
     if (PySequence_Fast_GET_SIZE(s_fast) == 0) {
         Py_DECREF(s_fast);
-        return _PyAccu_Accumulate(acc, empty_array);
+        return _PyUnicodeWriter_WriteStr(writer, empty_array);
     }
 
     if (s->markers != Py_None) {
@@ -1784,7 +1876,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
         }
     }
 
-    if (_PyAccu_Accumulate(acc, open_array))
+    if (_PyUnicodeWriter_WriteStr(writer, open_array))
         goto bail;
     if (s->indent != Py_None) {
         /* TODO: DOES NOT RUN */
@@ -1798,10 +1890,10 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
     for (i = 0; i < PySequence_Fast_GET_SIZE(s_fast); i++) {
         PyObject *obj = PySequence_Fast_GET_ITEM(s_fast, i);
         if (i) {
-            if (_PyAccu_Accumulate(acc, s->item_separator))
+            if (_PyUnicodeWriter_WriteStr(writer, s->item_separator))
                 goto bail;
         }
-        if (encoder_listencode_obj(s, acc, obj, indent_level))
+        if (encoder_listencode_obj(s, writer, obj, indent_level))
             goto bail;
     }
     if (ident != NULL) {
@@ -1816,7 +1908,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
 
         yield '\n' + (' ' * (_indent * _current_indent_level))
     }*/
-    if (_PyAccu_Accumulate(acc, close_array))
+    if (_PyUnicodeWriter_WriteStr(writer, close_array))
         goto bail;
     Py_DECREF(s_fast);
     return 0;
@@ -2000,6 +2000,134 @@ done:
     return 0;
 }
 
+#ifdef BITPACKED
+/* Longest opcode written by bitpacked_save_atom(): LONG1 with its size
+   byte and 8 bytes of data. */
+#define BITPACKED_PICKLE_ATOM_MAX 10
+/* Bytes collected by bitpacked_save_run() before they are written out */
+#define BITPACKED_PICKLE_BUFSIZE 2048
+
+/* Write the opcode that save_long(), save_float(), save_none() or
+   save_bool() would produce for the tagged value obj into pdata, without
+   going through a heap int or double object.  Returns the length of the
+   opcode, 0 if obj is not tagged or needs a text opcode of protocol 0 or
+   1, and -1 on error.  Like the other atoms, tagged values are never
+   memoized. */
+static Py_ssize_t
+bitpacked_save_atom(PicklerObject *self, PyObject *obj, char *pdata)
+{
+    if (BITPACKED_LONG_CHECKEXACT(obj) && self->bin) {
+        long val = BITPACKED_LONG_VALUE(obj);
+        Py_ssize_t i, len;
+
+        if (val >= 0 && val <= 0xff) {
+            pdata[0] = BININT1;
+            pdata[1] = (unsigned char)val;
+            return 2;
+        }
+        if (val >= 0 && val <= 0xffff) {
+            pdata[0] = BININT2;
+            pdata[1] = (unsigned char)(val & 0xff);
+            pdata[2] = (unsigned char)((val >> 8) & 0xff);
+            return 3;
+        }
+        if (val <= 0x7fffffffL && val >= (-0x7fffffffL - 1)) {
+            pdata[0] = BININT;
+            for (i = 0; i < 4; i++)
+                pdata[i + 1] = (unsigned char)((val >> (8 * i)) & 0xff);
+            return 5;
+        }
+        if (self->proto < 2)
+            return 0;
+        /* The fewest bytes of two's complement that hold val, as
+           save_long() computes them for LONG1. */
+        for (len = 5; len < 8; len++) {
+            long limit = 1L << (8 * len - 1);
+            if (val >= -limit && val < limit)
+                break;
+        }
+        pdata[0] = LONG1;
+        pdata[1] = (unsigned char)len;
+        for (i = 0; i < len; i++)
+            pdata[i + 2] = (unsigned char)((val >> (8 * i)) & 0xff);
+        return len + 2;
+    }
+    if (BITPACKED_FLOAT_CHECK(obj) && self->bin) {
+        pdata[0] = BINFLOAT;
+        if (_PyFloat_Pack8(_PyBitpacked_FloatValue(obj),
+                           (unsigned char *)&pdata[1], 0) < 0)
+            return -1;
+        return 9;
+    }
+    if (obj == Py_None) {
+        pdata[0] = NONE;
+        return 1;
+    }
+    if ((obj == Py_True || obj == Py_False) && self->proto >= 2) {
+        pdata[0] = (obj == Py_True) ? NEWTRUE : NEWFALSE;
+        return 1;
+    }
+    return 0;
+}
+
+/* Number of bytes that can still go into the current frame before
+   _Pickler_OpcodeBoundary() would commit it. */
+static Py_ssize_t
+bitpacked_frame_room(PicklerObject *self)
+{
+    if (!self->framing)
+        return PY_SSIZE_T_MAX;
+    if (self->frame_start == -1)
+        return FRAME_SIZE_TARGET;
+    return FRAME_SIZE_TARGET -
+        (self->output_len - self->frame_start - FRAME_HEADER_SIZE);
+}
+
+/* Pickle the leading tagged values of items[0:n] in bulk: their opcodes are
+   collected in a local buffer and handed to _Pickler_Write() a few
+   kilobytes at a time, instead of one save() call per item.  Frames are
+   committed at the same items as save() would commit them, so the output
+   is the same.  Returns the number of items written, which stops at the
+   first item that is not a tagged atom, or -1 on error. */
+static Py_ssize_t
+bitpacked_save_run(PicklerObject *self, PyObject **items, Py_ssize_t n)
+{
+    char buf[BITPACKED_PICKLE_BUFSIZE];
+    Py_ssize_t i, len = 0, size, room;
+
+    /* persistent_id() has to see every object */
+    if (self->pers_func != NULL)
+        return 0;
+
+    room = bitpacked_frame_room(self);
+    for (i = 0; i < n; i++) {
+        if (len >= room) {
+            if (len > 0 && _Pickler_Write(self, buf, len) < 0)
+                return -1;
+            len = 0;
+            if (_Pickler_OpcodeBoundary(self) < 0)
+                return -1;
+            room = bitpacked_frame_room(self);
+        }
+        else if (len > BITPACKED_PICKLE_BUFSIZE - BITPACKED_PICKLE_ATOM_MAX) {
+            if (_Pickler_Write(self, buf, len) < 0)
+                return -1;
+            len = 0;
+            room = bitpacked_frame_room(self);
+        }
+        size = bitpacked_save_atom(self, items[i], buf + len);
+        if (size < 0)
+            return -1;
+        if (size == 0)
+            break;
+        len += size;
+    }
+    if (len > 0 && _Pickler_Write(self, buf, len) < 0)
+        return -1;
+    return i;
+}
+#endif
+
 static int
 save_bytes(PicklerObject *self, PyObject *obj)
 {
@@ -2271,7 +2399,20 @@ store_tuple_elements(PicklerObject *self, PyObject *t, Py_ssize_t len)
     assert(PyTuple_Size(t) == len);
 
     for (i = 0; i < len; i++) {
-        PyObject *element = PyTuple_GET_ITEM(t, i);
+        PyObject *element;
+
+#ifdef BITPACKED
+        {
+            Py_ssize_t run = bitpacked_save_run(
+                self, &PyTuple_GET_ITEM(t, i), len - i);
+            if (run < 0)
+                return -1;
+            i += run;
+            if (i == len)
+                break;
+        }
+#endif
+        element = PyTuple_GET_ITEM(t, i);
 
         if (element == NULL)
             return -1;
@@ -2540,6 +2681,20 @@ batch_list_exact(PicklerObject *self, PyObject *obj)
         if (_Pickler_Write(self, &mark_op, 1) < 0)
             return -1;
         while (total < PyList_GET_SIZE(obj)) {
+#ifdef BITPACKED
+            Py_ssize_t run = bitpacked_save_run(
+                self, &PyList_GET_ITEM(obj, total),
+                Py_MIN(BATCHSIZE - this_batch,
+                       PyList_GET_SIZE(obj) - total));
+            if (run < 0)
+                return -1;
+            total += run;
+            this_batch += run;
+            if (this_batch == BATCHSIZE)
+                break;
+            if (total == PyList_GET_SIZE(obj))
+                break;
+#endif
             item = PyList_GET_ITEM(obj, total);
             if (save(self, item, 0) < 0)
                 return -1;
@@ -3738,6 +3893,16 @@ save(PicklerObject *self, PyObject *obj, int pers_save)
 
     /* Atom types; these aren't memoized, so don't check the memo. */
 
+#ifdef BITPACKED
+    if (BITPACKED_CHECK(obj)) {
+        char pdata[BITPACKED_PICKLE_ATOM_MAX];
+        Py_ssize_t len = bitpacked_save_atom(self, obj, pdata);
+        if (len < 0 || (len > 0 && _Pickler_Write(self, pdata, len) < 0))
+            goto error;
+        if (len > 0)
+            goto done;
+    }
+#endif
     if (obj == Py_None) {
         status = save_none(self, obj);
         goto done;
@@ -4654,6 +4819,65 @@ calc_binint(char *bytes, int nbytes)
     return x;
 }
 
+#ifdef BITPACKED
+/* After a BININT, BININT1, BININT2 or BINFLOAT, push the values of the
+ * binary int and float opcodes that directly follow it in the input
+ * buffer, without a trip through the dispatch loop of load() for each.
+ * Lists and tuples of tagged numbers are pickled as such runs.  Stops at
+ * any other opcode, or at one whose argument is not buffered yet, and
+ * load() goes on from there.
+ */
+static int
+load_bitpacked_run(UnpicklerObject *self)
+{
+    PyObject *value;
+    char *s;
+    double x;
+    Py_ssize_t size;
+
+    while (self->next_read_idx < self->input_len) {
+        s = self->input_buffer + self->next_read_idx;
+        size = self->input_len - self->next_read_idx;
+        switch ((enum opcode)s[0]) {
+        case BININT1:
+            if (size < 2)
+                return 0;
+            value = PyLong_FromLong(calc_binint(s + 1, 1));
+            size = 2;
+            break;
+        case BININT2:
+            if (size < 3)
+                return 0;
+            value = PyLong_FromLong(calc_binint(s + 1, 2));
+            size = 3;
+            break;
+        case BININT:
+            if (size < 5)
+                return 0;
+            value = PyLong_FromLong(calc_binint(s + 1, 4));
+            size = 5;
+            break;
+        case BINFLOAT:
+            if (size < 9)
+                return 0;
+            x = _PyFloat_Unpack8((unsigned char *)s + 1, 0);
+            if (x == -1.0 && PyErr_Occurred())
+                return -1;
+            value = PyFloat_FromDouble(x);
+            size = 9;
+            break;
+        default:
+            return 0;
+        }
+        if (value == NULL)
+            return -1;
+        self->next_read_idx += size;
+        PDATA_PUSH(self->stack, value, -1);
+    }
+    return 0;
+}
+#endif
+
 static int
 load_binintx(UnpicklerObject *self, char *s, int size)
 {
@@ -4666,7 +4890,11 @@ load_binintx(UnpicklerObject *self, char *s, int size)
         return -1;
 
     PDATA_PUSH(self->stack, value, -1);
+#ifdef BITPACKED
+    return load_bitpacked_run(self);
+#else
     return 0;
+#endif
 }
 
 static int
@@ -4814,7 +5042,11 @@ load_binfloat(UnpicklerObject *self)
         return -1;
 
     PDATA_PUSH(self->stack, value, -1);
+#ifdef BITPACKED
+    return load_bitpacked_run(self);
+#else
     return 0;
+#endif
 }
 
 static int
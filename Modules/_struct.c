@@ -2273,7 +2273,7 @@ PyInit__struct(void)
     if (m == NULL)
         return NULL;
 
-    Py_TYPE(&PyStructType) = &PyType_Type;
+    Py_SET_TYPE(&PyStructType, &PyType_Type);
     if (PyType_Ready(&PyStructType) < 0)
         return NULL;
 
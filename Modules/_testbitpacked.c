@@ -11,6 +11,8 @@
 #define MODE_PYDEBUG 8L
 #define MODE_PYTRACEREFS 16L
 #define MODE_PYREFDEBUG 32L
+#define MODE_COMPACTHEADER 64L
+#define MODE_STATS 128L
 
 
 static PyObject *
@@ -25,6 +27,12 @@ get_mode(PyObject *self)
 #if BITPACKED_NOERRDETECT
     mode |= MODE_NOERRDETECT;
 #endif
+#ifdef BITPACKED_COMPACT_HEADER
+    mode |= MODE_COMPACTHEADER;
+#endif
+#ifdef BITPACKED_STATS
+    mode |= MODE_STATS;
+#endif
 #endif
 #ifdef Py_DEBUG
     mode |= MODE_PYDEBUG;
@@ -53,6 +61,8 @@ print_bitpacked_configuration(PyObject *self)
     fprintf(fp, "BitPacked Mode: %s\n", MODE_CHECK(MODE_BITPACKED));
     fprintf(fp, "BitPacked No-RefCount Mode: %s\n", MODE_CHECK(MODE_NOREFCNT));
     fprintf(fp, "BitPacked No-Error-Detection Mode: %s\n", MODE_CHECK(MODE_NOERRDETECT));
+    fprintf(fp, "BitPacked Compact-Header Mode: %s\n", MODE_CHECK(MODE_COMPACTHEADER));
+    fprintf(fp, "BitPacked Statistics Mode: %s\n", MODE_CHECK(MODE_STATS));
     fprintf(fp, "Python Debug Mode: %s\n", MODE_CHECK(MODE_PYDEBUG));
     fprintf(fp, "Python Trace-Refs Mode: %s\n", MODE_CHECK(MODE_PYTRACEREFS));
     fprintf(fp, "Python Refs-Debug Mode: %s\n", MODE_CHECK(MODE_PYREFDEBUG));
@@ -139,7 +149,141 @@ test_macro_sideeffect(PyObject *self)
     return ret;
 }
 
+/* Micro-benchmark of type dispatch: reads the type (and its tp_flags) of
+ * every item of a list, `loops` times.  Returns a dict of elapsed seconds
+ * for Py_TYPE() and, in bitpacked mode, for the branching formulation
+ * that Py_TYPE() used before ("branch").  Run it in both builds with the
+ * same list to see what bitpacked mode costs on type dispatch.
+ */
+#ifdef BITPACKED
+#ifdef BITPACKED_COMPACT_HEADER
+#define BRANCH_TYPE(ob) (BITPACKED_CHECK(ob)                        \
+                         ?bitpacked_types[BITPACKED_TYPEID(ob)>>1]  \
+                         :bitpacked_typetable[(ob)->ob_typeidx_bitpacked])
+#else
+#define BRANCH_TYPE(ob) (BITPACKED_CHECK(ob)                        \
+                         ?bitpacked_types[BITPACKED_TYPEID(ob)>>1]  \
+                         :(ob)->ob_type_bitpacked)
+#endif
+#endif
+
+#define BENCH_TYPE_DISPATCH(TYPE, result) do {                  \
+        unsigned long acc = 0;                                  \
+        _PyTime_t t0 = _PyTime_GetMonotonicClock();             \
+        for(n = 0; n < loops; ++n) {                            \
+            for(i = 0; i < size; ++i) {                         \
+                PyObject *ob = items[i];                        \
+                acc += TYPE(ob)->tp_flags;                      \
+            }                                                   \
+        }                                                       \
+        sink += acc;                                            \
+        result = _PyTime_AsSecondsDouble(                       \
+            _PyTime_GetMonotonicClock() - t0);                  \
+    } while(0)
+
+static PyObject *
+bench_type_dispatch(PyObject *self, PyObject *args)
+{
+    PyObject *list, *res, *tmp;
+    PyObject **items;
+    Py_ssize_t loops, n, i, size;
+    volatile unsigned long sink = 0;
+    double elapsed;
+
+    if(!PyArg_ParseTuple(args, "O!n:bench_type_dispatch",
+                         &PyList_Type, &list, &loops))
+        return NULL;
+    /* the list is not mutated below, so its items stay valid */
+    items = ((PyListObject *)list)->ob_item;
+    size = PyList_GET_SIZE(list);
+
+    res = PyDict_New();
+    if(!res) return NULL;
+
+    BENCH_TYPE_DISPATCH(Py_TYPE, elapsed);
+    tmp = PyFloat_FromDouble(elapsed);
+    if(!tmp || PyDict_SetItemString(res, "Py_TYPE", tmp) < 0) goto error;
+    Py_DECREF(tmp);
+#ifdef BITPACKED
+    BENCH_TYPE_DISPATCH(BRANCH_TYPE, elapsed);
+    tmp = PyFloat_FromDouble(elapsed);
+    if(!tmp || PyDict_SetItemString(res, "branch", tmp) < 0) goto error;
+    Py_DECREF(tmp);
+#endif
+    return res;
+
+  error:
+    Py_XDECREF(tmp);
+    Py_DECREF(res);
+    return NULL;
+}
+
+/* Number of object allocations made while calling func(*args).  The
+ * object allocator is wrapped for the duration of the call, so this counts
+ * every PyObject_Malloc() and friends, including temporaries that are
+ * freed again before the call returns.
+ */
+static Py_ssize_t alloc_count;
+static PyMemAllocatorEx alloc_orig;
+
+static void *
+counting_malloc(void *ctx, size_t size)
+{
+    alloc_count++;
+    return alloc_orig.malloc(alloc_orig.ctx, size);
+}
+
+static void *
+counting_calloc(void *ctx, size_t nelem, size_t elsize)
+{
+    alloc_count++;
+    return alloc_orig.calloc(alloc_orig.ctx, nelem, elsize);
+}
+
+static void *
+counting_realloc(void *ctx, void *ptr, size_t new_size)
+{
+    alloc_count++;
+    return alloc_orig.realloc(alloc_orig.ctx, ptr, new_size);
+}
+
+static void
+counting_free(void *ctx, void *ptr)
+{
+    alloc_orig.free(alloc_orig.ctx, ptr);
+}
+
+static PyObject *
+count_allocations(PyObject *self, PyObject *args)
+{
+    PyMemAllocatorEx counting = {NULL, counting_malloc, counting_calloc,
+                                 counting_realloc, counting_free};
+    PyObject *func, *callargs, *res;
+
+    if(PyTuple_GET_SIZE(args) < 1) {
+        PyErr_SetString(PyExc_TypeError,
+                        "count_allocations() needs a callable");
+        return NULL;
+    }
+    func = PyTuple_GET_ITEM(args, 0);
+    callargs = PyTuple_GetSlice(args, 1, PyTuple_GET_SIZE(args));
+    if(!callargs) return NULL;
+
+    alloc_count = 0;
+    PyMem_GetAllocator(PYMEM_DOMAIN_OBJ, &alloc_orig);
+    PyMem_SetAllocator(PYMEM_DOMAIN_OBJ, &counting);
+    res = PyObject_Call(func, callargs, NULL);
+    PyMem_SetAllocator(PYMEM_DOMAIN_OBJ, &alloc_orig);
+
+    Py_DECREF(callargs);
+    if(!res) return NULL;
+    Py_DECREF(res);
+    return PyLong_FromSsize_t(alloc_count);
+}
+
 static struct PyMethodDef _testbitpacked_functions[] = {
+    {"bench_type_dispatch", (PyCFunction)bench_type_dispatch, METH_VARARGS, NULL},
+    {"count_allocations", (PyCFunction)count_allocations, METH_VARARGS, NULL},
     {"test_macro_sideeffect", (PyCFunction)test_macro_sideeffect, METH_NOARGS, NULL},
     {"get_mode", (PyCFunction)get_mode, METH_NOARGS, NULL},
     {"get_typetable", (PyCFunction)get_typetable, METH_NOARGS, NULL},
@@ -174,20 +318,25 @@ PyInit__testbitpacked(void)
     PyModule_AddIntMacro(m, MODE_PYDEBUG);
     PyModule_AddIntMacro(m, MODE_PYTRACEREFS);
     PyModule_AddIntMacro(m, MODE_PYREFDEBUG);
+    PyModule_AddIntMacro(m, MODE_COMPACTHEADER);
+    PyModule_AddIntMacro(m, MODE_STATS);
 #ifdef BITPACKED
     PyModule_AddIntMacro(m, BITPACKED_DUMMY_REFCNT);
+    PyModule_AddIntMacro(m, BITPACKED_ALIGNMENT);
     PyModule_AddIntMacro(m, BITPACKED_TYPEID_LONG);
     PyModule_AddIntMacro(m, BITPACKED_TYPEID_NONE);
     PyModule_AddIntMacro(m, BITPACKED_TYPEID_NOTIMPL);
+    PyModule_AddIntMacro(m, BITPACKED_TYPEID_NOTUSED_08);
     PyModule_AddIntMacro(m, BITPACKED_TYPEID_FLOAT);
     PyModule_AddIntMacro(m, BITPACKED_TYPEID_RANGE);
-    PyModule_AddIntMacro(m, BITPACKED_TYPEID_NOTUSED_0E);
+    PyModule_AddIntMacro(m, BITPACKED_TYPEID_RANGE_WIDE);
     PyModule_AddIntMacro(m, BITPACKED_TYPEID_BOOL);
-    PyModule_AddIntMacro(m, BITPACKED_TYPEID_NOTUSED_14);
-    PyModule_AddIntMacro(m, BITPACKED_TYPEID_NOTUSED_16);
+    PyModule_AddIntMacro(m, BITPACKED_TYPEID_DATE);
+    PyModule_AddIntMacro(m, BITPACKED_TYPEID_TIME);
+    PyModule_AddIntMacro(m, BITPACKED_TYPEID_DELTA);
     PyModule_AddIntMacro(m, BITPACKED_TYPEID_FLOAT_RSV);
-    PyModule_AddIntMacro(m, BITPACKED_TYPEID_NOTUSED_1C);
-    PyModule_AddIntMacro(m, BITPACKED_TYPEID_NOTUSED_1E);
+    PyModule_AddIntMacro(m, BITPACKED_TYPEID_FLOAT_WIDE);
+    PyModule_AddIntMacro(m, BITPACKED_TYPEID_FLOAT_WIDE_RSV);
 #endif
 
     return m;
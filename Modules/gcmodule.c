@@ -370,6 +370,10 @@ static int
 visit_decref(PyObject *op, void *data)
 {
     assert(op != NULL);
+    /* tagged words have no GC header and can never be part of a cycle;
+       rejecting them here skips the type lookup of PyObject_IS_GC() */
+    if (BITPACKED_CHECK(op))
+        return 0;
     if (PyObject_IS_GC(op)) {
         PyGC_Head *gc = AS_GC(op);
         /* We're only interested in gc_refs for objects in the
@@ -405,6 +409,8 @@ subtract_refs(PyGC_Head *containers)
 static int
 visit_reachable(PyObject *op, PyGC_Head *reachable)
 {
+    if (BITPACKED_CHECK(op))
+        return 0;
     if (PyObject_IS_GC(op)) {
         PyGC_Head *gc = AS_GC(op);
         const Py_ssize_t gc_refs = _PyGCHead_REFS(gc);
@@ -506,9 +512,10 @@ move_unreachable(PyGC_Head *young, PyGC_Head *unreachable)
     }
 }
 
-/* Try to untrack all currently tracked dictionaries */
+/* Try to untrack all currently tracked dictionaries, and in bit-packed
+   builds also lists */
 static void
-untrack_dicts(PyGC_Head *head)
+untrack_dicts_and_lists(PyGC_Head *head)
 {
     PyGC_Head *next, *gc = head->gc.gc_next;
     while (gc != head) {
@@ -516,6 +523,10 @@ untrack_dicts(PyGC_Head *head)
         next = gc->gc.gc_next;
         if (PyDict_CheckExact(op))
             _PyDict_MaybeUntrack(op);
+#ifdef BITPACKED
+        else if (PyList_CheckExact(op))
+            _PyList_MaybeUntrack(op);
+#endif
         gc = next;
     }
 }
@@ -967,9 +978,9 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
         gc_list_merge(young, old);
     }
     else {
-        /* We only untrack dicts in full collections, to avoid quadratic
-           dict build-up. See issue #14775. */
-        untrack_dicts(young);
+        /* We only untrack dicts (and lists) in full collections, to
+           avoid quadratic dict build-up. See issue #14775. */
+        untrack_dicts_and_lists(young);
         long_lived_pending = 0;
         long_lived_total = gc_list_size(young);
     }
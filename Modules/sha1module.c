@@ -548,7 +548,7 @@ PyInit__sha1(void)
 {
     PyObject *m;
 
-    Py_TYPE(&SHA1type) = &PyType_Type;
+    Py_SET_TYPE(&SHA1type, &PyType_Type);
     if (PyType_Ready(&SHA1type) < 0)
         return NULL;
 
@@ -786,10 +786,10 @@ PyInit__sha512(void)
 {
     PyObject *m;
 
-    Py_TYPE(&SHA384type) = &PyType_Type;
+    Py_SET_TYPE(&SHA384type, &PyType_Type);
     if (PyType_Ready(&SHA384type) < 0)
         return NULL;
-    Py_TYPE(&SHA512type) = &PyType_Type;
+    Py_SET_TYPE(&SHA512type, &PyType_Type);
     if (PyType_Ready(&SHA512type) < 0)
         return NULL;
 
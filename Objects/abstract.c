@@ -885,10 +885,24 @@ BINARY_FUNC(PyNumber_Rshift, nb_rshift, ">>")
 BINARY_FUNC(PyNumber_Subtract, nb_subtract, "-")
 BINARY_FUNC(PyNumber_Divmod, nb_divmod, "divmod()")
 
+#ifdef BITPACKED
+/* Bitpacked float operands (one of them may be a bitpacked int) skip the
+ * slot lookup and float_add()/float_mul()'s CONVERT_TO_DOUBLE dispatch.
+ */
+#define BITPACKED_FLOAT_BINOP(v, OP, w) \
+    if (BITPACKED_FLOAT_OPERANDS(v, w)) \
+        return PyFloat_FromDouble(_PyBitpacked_NumberValue(v) OP \
+                                  _PyBitpacked_NumberValue(w))
+#else
+#define BITPACKED_FLOAT_BINOP(v, OP, w)
+#endif
+
 PyObject *
 PyNumber_Add(PyObject *v, PyObject *w)
 {
-    PyObject *result = binary_op1(v, w, NB_SLOT(nb_add));
+    PyObject *result;
+    BITPACKED_FLOAT_BINOP(v, +, w);
+    result = binary_op1(v, w, NB_SLOT(nb_add));
     if (result == Py_NotImplemented) {
         PySequenceMethods *m = Py_TYPE(v)->tp_as_sequence;
         Py_DECREF(result);
@@ -919,7 +933,9 @@ sequence_repeat(ssizeargfunc repeatfunc, PyObject *seq, PyObject *n)
 PyObject *
 PyNumber_Multiply(PyObject *v, PyObject *w)
 {
-    PyObject *result = binary_op1(v, w, NB_SLOT(nb_multiply));
+    PyObject *result;
+    BITPACKED_FLOAT_BINOP(v, *, w);
+    result = binary_op1(v, w, NB_SLOT(nb_multiply));
     if (result == Py_NotImplemented) {
         PySequenceMethods *mv = Py_TYPE(v)->tp_as_sequence;
         PySequenceMethods *mw = Py_TYPE(w)->tp_as_sequence;
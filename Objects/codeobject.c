@@ -152,6 +152,10 @@ PyCode_New(int argcount, int kwonlyargcount,
     co->co_lnotab = lnotab;
     co->co_zombieframe = NULL;
     co->co_weakreflist = NULL;
+    co->co_globalcache = NULL;
+    co->co_warmth = 0;
+    co->co_quickened = NULL;
+    co->co_attrcache = NULL;
     return co;
 }
 
@@ -374,6 +378,12 @@ code_dealloc(PyCodeObject *co)
         PyMem_FREE(co->co_cell2arg);
     if (co->co_zombieframe != NULL)
         PyObject_GC_Del(co->co_zombieframe);
+    if (co->co_globalcache != NULL)
+        PyMem_FREE(co->co_globalcache);
+    if (co->co_quickened != NULL)
+        PyMem_FREE(co->co_quickened);
+    if (co->co_attrcache != NULL)
+        PyMem_FREE(co->co_attrcache);
     if (co->co_weakreflist != NULL)
         PyObject_ClearWeakRefs((PyObject*)co);
     PyObject_DEL(co);
@@ -387,6 +397,12 @@ code_sizeof(PyCodeObject *co, void *unused)
     res = _PyObject_SIZE(Py_TYPE(co));
     if (co->co_cell2arg != NULL && co->co_cellvars != NULL)
         res += PyTuple_GET_SIZE(co->co_cellvars) * sizeof(unsigned char);
+    if (co->co_globalcache != NULL)
+        res += PyTuple_GET_SIZE(co->co_names) * sizeof(_PyCodeGlobalCache);
+    if (co->co_quickened != NULL)
+        res += PyBytes_GET_SIZE(co->co_code);
+    if (co->co_attrcache != NULL)
+        res += PyTuple_GET_SIZE(co->co_names) * sizeof(_PyCodeAttrCache);
     return PyLong_FromSsize_t(res);
 }
 
@@ -206,6 +206,10 @@ lookdict_unicode_nodummy(PyDictObject *mp, PyObject *key,
                          Py_hash_t hash, PyObject ***value_addr);
 static PyDictKeyEntry *lookdict_split(PyDictObject *mp, PyObject *key,
                                       Py_hash_t hash, PyObject ***value_addr);
+#ifdef BITPACKED
+static PyDictKeyEntry *lookdict_bitpacked(PyDictObject *mp, PyObject *key,
+                                          Py_hash_t hash, PyObject ***value_addr);
+#endif
 
 static int dictresize(PyDictObject *mp, Py_ssize_t minused);
 
@@ -216,6 +220,12 @@ static int dictresize(PyDictObject *mp, Py_ssize_t minused);
 static PyDictObject *free_list[PyDict_MAXFREELIST];
 static int numfree = 0;
 
+/* Source of ma_version_tag.  A new version is taken before the mapping
+   changes, so that code run by a Py_DECREF() of an old value already sees
+   it.  At one change per nanosecond it wraps after 584 years. */
+static PY_UINT64_T pydict_global_version = 0;
+#define DICT_NEXT_VERSION() (++pydict_global_version)
+
 #include "clinic/dictobject.c.h"
 
 int
@@ -253,6 +263,11 @@ PyDict_Fini(void)
 #define DK_DECREF(dk) if (DK_DEBUG_DECREF (--(dk)->dk_refcnt) == 0) free_keys_object(dk)
 #define DK_SIZE(dk) ((dk)->dk_size)
 #define DK_MASK(dk) (((dk)->dk_size)-1)
+#ifdef BITPACKED
+#define DK_IS_BITPACKED(dk) ((dk)->dk_lookup == lookdict_bitpacked)
+#else
+#define DK_IS_BITPACKED(dk) 0
+#endif
 #define IS_POWER_OF_2(x) (((x) & (x-1)) == 0)
 
 /* USABLE_FRACTION is the maximum dictionary load.
@@ -383,6 +398,7 @@ new_dict(PyDictKeysObject *keys, PyObject **values)
     mp->ma_keys = keys;
     mp->ma_values = values;
     mp->ma_used = 0;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     return (PyObject *)mp;
 }
 
@@ -435,7 +451,9 @@ lookdict_unicode() below is specialized to string keys, comparison of which can
 never raise an exception; that function can never return NULL.
 lookdict_unicode_nodummy is further specialized for string keys that cannot be
 the <dummy> value.
-For both, when the key isn't found a PyDictEntry* is returned
+In bitpacked mode, lookdict_bitpacked() is specialized to bitpacked int keys;
+equal values are the same machine word, so it compares words only.
+For all of them, when the key isn't found a PyDictEntry* is returned
 where the key would have been found, *value_addr points to the matching value
 slot.
 */
@@ -547,6 +565,12 @@ lookdict_unicode(PyDictObject *mp, PyObject *key,
        unicodes is to override __eq__, and for speed we don't cater to
        that here. */
     if (!PyUnicode_CheckExact(key)) {
+#ifdef BITPACKED
+        if (BITPACKED_LONG_CHECKEXACT(key) && mp->ma_used == 0) {
+            mp->ma_keys->dk_lookup = lookdict_bitpacked;
+            return lookdict_bitpacked(mp, key, hash, value_addr);
+        }
+#endif
         mp->ma_keys->dk_lookup = lookdict;
         return lookdict(mp, key, hash, value_addr);
     }
@@ -611,6 +635,12 @@ lookdict_unicode_nodummy(PyDictObject *mp, PyObject *key,
        unicodes is to override __eq__, and for speed we don't cater to
        that here. */
     if (!PyUnicode_CheckExact(key)) {
+#ifdef BITPACKED
+        if (BITPACKED_LONG_CHECKEXACT(key) && mp->ma_used == 0) {
+            mp->ma_keys->dk_lookup = lookdict_bitpacked;
+            return lookdict_bitpacked(mp, key, hash, value_addr);
+        }
+#endif
         mp->ma_keys->dk_lookup = lookdict;
         return lookdict(mp, key, hash, value_addr);
     }
@@ -636,6 +666,61 @@ lookdict_unicode_nodummy(PyDictObject *mp, PyObject *key,
     return 0;
 }
 
+#ifdef BITPACKED
+/* Specialized version for bitpacked-int-only keys.  The table switches to
+ * it while it is empty and leaves it for lookdict() as soon as any other
+ * key shows up.  A bitpacked int is equal only to the very same word, so
+ * no comparison ever calls back into Python and NULL is never returned. */
+static PyDictKeyEntry *
+lookdict_bitpacked(PyDictObject *mp, PyObject *key,
+                   Py_hash_t hash, PyObject ***value_addr)
+{
+    size_t i;
+    size_t perturb;
+    PyDictKeyEntry *freeslot;
+    size_t mask = DK_MASK(mp->ma_keys);
+    PyDictKeyEntry *ep0 = &mp->ma_keys->dk_entries[0];
+    PyDictKeyEntry *ep;
+
+    if (!BITPACKED_LONG_CHECKEXACT(key)) {
+        if (PyUnicode_CheckExact(key) && mp->ma_used == 0) {
+            mp->ma_keys->dk_lookup = lookdict_unicode;
+            return lookdict_unicode(mp, key, hash, value_addr);
+        }
+        mp->ma_keys->dk_lookup = lookdict;
+        return lookdict(mp, key, hash, value_addr);
+    }
+    i = (size_t)hash & mask;
+    ep = &ep0[i];
+    if (ep->me_key == NULL || ep->me_key == key) {
+        *value_addr = &ep->me_value;
+        return ep;
+    }
+    freeslot = (ep->me_key == dummy) ? ep : NULL;
+    for (perturb = hash; ; perturb >>= PERTURB_SHIFT) {
+        i = (i << 2) + i + perturb + 1;
+        ep = &ep0[i & mask];
+        if (ep->me_key == NULL) {
+            if (freeslot == NULL) {
+                *value_addr = &ep->me_value;
+                return ep;
+            } else {
+                *value_addr = &freeslot->me_value;
+                return freeslot;
+            }
+        }
+        if (ep->me_key == key) {
+            *value_addr = &ep->me_value;
+            return ep;
+        }
+        if (ep->me_key == dummy && freeslot == NULL)
+            freeslot = ep;
+    }
+    assert(0);          /* NOT REACHED */
+    return 0;
+}
+#endif
+
 /* Version of lookdict for split tables.
  * All split tables and only split tables use this lookup function.
  * Split tables only contain unicode keys and no dummy keys,
@@ -687,7 +772,8 @@ _PyDict_HasOnlyStringKeys(PyObject *dict)
     PyObject *key, *value;
     assert(PyDict_Check(dict));
     /* Shortcut */
-    if (((PyDictObject *)dict)->ma_keys->dk_lookup != lookdict)
+    if (((PyDictObject *)dict)->ma_keys->dk_lookup != lookdict &&
+        !DK_IS_BITPACKED(((PyDictObject *)dict)->ma_keys))
         return 1;
     while (PyDict_Next(dict, &pos, &key, &value))
         if (!PyUnicode_Check(key))
@@ -755,7 +841,7 @@ find_empty_slot(PyDictObject *mp, PyObject *key, Py_hash_t hash,
     PyDictKeyEntry *ep;
 
     assert(key != NULL);
-    if (!PyUnicode_CheckExact(key))
+    if (!PyUnicode_CheckExact(key) && !DK_IS_BITPACKED(mp->ma_keys))
         mp->ma_keys->dk_lookup = lookdict;
     i = hash & mask;
     ep = &ep0[i];
@@ -799,9 +885,11 @@ insertdict(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject *value)
     if (ep == NULL) {
         return -1;
     }
-    assert(PyUnicode_CheckExact(key) || mp->ma_keys->dk_lookup == lookdict);
+    assert(PyUnicode_CheckExact(key) || mp->ma_keys->dk_lookup == lookdict ||
+           DK_IS_BITPACKED(mp->ma_keys));
     Py_INCREF(value);
     MAINTAIN_TRACKING(mp, key, value);
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     old_value = *value_addr;
     if (old_value != NULL) {
         assert(ep->me_key != NULL && ep->me_key != dummy);
@@ -867,7 +955,8 @@ insertdict_clean(PyDictObject *mp, PyObject *key, Py_hash_t hash,
     assert(value != NULL);
     assert(key != NULL);
     assert(key != dummy);
-    assert(PyUnicode_CheckExact(key) || k->dk_lookup == lookdict);
+    assert(PyUnicode_CheckExact(key) || k->dk_lookup == lookdict ||
+           DK_IS_BITPACKED(k));
     i = hash & mask;
     ep = &ep0[i];
     for (perturb = hash; ep->me_key != NULL; perturb >>= PERTURB_SHIFT) {
@@ -915,8 +1004,8 @@ dictresize(PyDictObject *mp, Py_ssize_t minused)
         mp->ma_keys = oldkeys;
         return -1;
     }
-    if (oldkeys->dk_lookup == lookdict)
-        mp->ma_keys->dk_lookup = lookdict;
+    if (oldkeys->dk_lookup == lookdict || DK_IS_BITPACKED(oldkeys))
+        mp->ma_keys->dk_lookup = oldkeys->dk_lookup;
     oldsize = DK_SIZE(oldkeys);
     mp->ma_values = NULL;
     /* If empty then nothing to copy so just return */
@@ -984,7 +1073,8 @@ make_keys_shared(PyObject *op)
         PyDictKeyEntry *ep0;
         PyObject **values;
         assert(mp->ma_keys->dk_refcnt == 1);
-        if (mp->ma_keys->dk_lookup == lookdict) {
+        if (mp->ma_keys->dk_lookup == lookdict ||
+            DK_IS_BITPACKED(mp->ma_keys)) {
             return NULL;
         }
         else if (mp->ma_keys->dk_lookup == lookdict_unicode) {
@@ -1278,6 +1368,7 @@ PyDict_DelItem(PyObject *op, PyObject *key)
     old_value = *value_addr;
     *value_addr = NULL;
     mp->ma_used--;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     if (!_PyDict_HasSplitTable(mp)) {
         ENSURE_ALLOWS_DELETIONS(mp);
         old_key = ep->me_key;
@@ -1314,6 +1405,7 @@ _PyDict_DelItem_KnownHash(PyObject *op, PyObject *key, Py_hash_t hash)
     old_value = *value_addr;
     *value_addr = NULL;
     mp->ma_used--;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     if (!_PyDict_HasSplitTable(mp)) {
         ENSURE_ALLOWS_DELETIONS(mp);
         old_key = ep->me_key;
@@ -1345,6 +1437,7 @@ PyDict_Clear(PyObject *op)
     mp->ma_keys = Py_EMPTY_KEYS;
     mp->ma_values = empty_values;
     mp->ma_used = 0;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     /* ...then clear the keys and values */
     if (oldvalues != NULL) {
         n = DK_SIZE(oldkeys);
@@ -1480,6 +1573,7 @@ _PyDict_Pop(PyDictObject *mp, PyObject *key, PyObject *deflt)
     }
     *value_addr = NULL;
     mp->ma_used--;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     if (!_PyDict_HasSplitTable(mp)) {
         ENSURE_ALLOWS_DELETIONS(mp);
         old_key = ep->me_key;
@@ -2345,7 +2439,7 @@ dict___contains__(PyDictObject *self, PyObject *key)
 }
 
 static PyObject *
-dict_get(PyDictObject *mp, PyObject *args)
+dict_get(PyDictObject *mp, PyObject **args, Py_ssize_t nargs)
 {
     PyObject *key;
     PyObject *failobj = Py_None;
@@ -2354,7 +2448,7 @@ dict_get(PyDictObject *mp, PyObject *args)
     PyDictKeyEntry *ep;
     PyObject **value_addr;
 
-    if (!PyArg_UnpackTuple(args, "get", 1, 2, &key, &failobj))
+    if (!_PyArg_UnpackStack(args, nargs, "get", 1, 2, &key, &failobj))
         return NULL;
 
     if (!PyUnicode_CheckExact(key) ||
@@ -2412,17 +2506,19 @@ PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *defaultobj)
         val = defaultobj;
         mp->ma_keys->dk_usable--;
         mp->ma_used++;
+        mp->ma_version_tag = DICT_NEXT_VERSION();
     }
     return val;
 }
 
 static PyObject *
-dict_setdefault(PyDictObject *mp, PyObject *args)
+dict_setdefault(PyDictObject *mp, PyObject **args, Py_ssize_t nargs)
 {
     PyObject *key, *val;
     PyObject *defaultobj = Py_None;
 
-    if (!PyArg_UnpackTuple(args, "setdefault", 1, 2, &key, &defaultobj))
+    if (!_PyArg_UnpackStack(args, nargs, "setdefault", 1, 2,
+                            &key, &defaultobj))
         return NULL;
 
     val = PyDict_SetDefault((PyObject *)mp, key, defaultobj);
@@ -2438,11 +2534,11 @@ dict_clear(PyDictObject *mp)
 }
 
 static PyObject *
-dict_pop(PyDictObject *mp, PyObject *args)
+dict_pop(PyDictObject *mp, PyObject **args, Py_ssize_t nargs)
 {
     PyObject *key, *deflt = NULL;
 
-    if(!PyArg_UnpackTuple(args, "pop", 1, 2, &key, &deflt))
+    if(!_PyArg_UnpackStack(args, nargs, "pop", 1, 2, &key, &deflt))
         return NULL;
 
     return _PyDict_Pop(mp, key, deflt);
@@ -2511,6 +2607,7 @@ dict_popitem(PyDictObject *mp)
     ep->me_key = dummy;
     ep->me_value = NULL;
     mp->ma_used--;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     assert(mp->ma_keys->dk_entries[0].me_value == NULL);
     mp->ma_keys->dk_entries[0].me_hash = i + 1;  /* next place to start */
     return res;
@@ -2629,11 +2726,11 @@ static PyMethodDef mapp_methods[] = {
      getitem__doc__},
     {"__sizeof__",      (PyCFunction)dict_sizeof,       METH_NOARGS,
      sizeof__doc__},
-    {"get",         (PyCFunction)dict_get,          METH_VARARGS,
+    {"get",         (PyCFunction)dict_get,          METH_FASTCALL,
      get__doc__},
-    {"setdefault",  (PyCFunction)dict_setdefault,   METH_VARARGS,
+    {"setdefault",  (PyCFunction)dict_setdefault,   METH_FASTCALL,
      setdefault_doc__},
-    {"pop",         (PyCFunction)dict_pop,          METH_VARARGS,
+    {"pop",         (PyCFunction)dict_pop,          METH_FASTCALL,
      pop__doc__},
     {"popitem",         (PyCFunction)dict_popitem,      METH_NOARGS,
      popitem__doc__},
@@ -2715,6 +2812,7 @@ dict_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         _PyObject_GC_UNTRACK(d);
 
     d->ma_used = 0;
+    d->ma_version_tag = DICT_NEXT_VERSION();
     d->ma_keys = new_keys_object(PyDict_MINSIZE_COMBINED);
     if (d->ma_keys == NULL) {
         Py_DECREF(self);
@@ -3929,8 +4027,16 @@ static PyTypeObject PyDictDummy_Type = {
     Py_TPFLAGS_DEFAULT, /*tp_flags */
 };
 
-static PyObject _dummy_struct = {
+static PyObject _dummy_struct BITPACKED_ALIGNED = {
   _PyObject_EXTRA_INIT
-  2, &PyDictDummy_Type
+  2, _PyObject_TYPE_INIT(&PyDictDummy_Type)
 };
 
+#ifdef BITPACKED_COMPACT_HEADER
+void
+_PyDict_InitDummy(void)
+{
+    Py_SET_TYPE(&_dummy_struct, &PyDictDummy_Type);
+}
+#endif
+
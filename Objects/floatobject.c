@@ -12,9 +12,18 @@
 
 /* Special free list
    free_list is a singly-linked list of available PyFloatObjects, linked
-   via abuse of their ob_type members.
+   via abuse of their ob_type members (of ob_fval when the header only has
+   room for a type index).
 */
 
+#ifdef BITPACKED_COMPACT_HEADER
+#define FREE_LIST_NEXT(op) (*(PyFloatObject **)&(op)->ob_fval)
+#define SET_FREE_LIST_NEXT(op, next) (FREE_LIST_NEXT(op) = (next))
+#else
+#define FREE_LIST_NEXT(op) ((PyFloatObject *) Py_TYPE(op))
+#define SET_FREE_LIST_NEXT(op, next) (Py_TYPE(op) = (struct _typeobject *)(next))
+#endif
+
 #ifndef PyFloat_MAXFREELIST
 #define PyFloat_MAXFREELIST    100
 #endif
@@ -30,11 +39,40 @@ static PyFloatObject *free_list = NULL;
 #define BP_03FFFF  0x03FFFFFFFFFFFFFFULL
 #define BP_000000  0x0000000000000000ULL
 #define BP_SHIFT  4
+
+/* BITPACKED_TYPEID_FLOAT_WIDE covers the 64 binades on either side of the
+ * exponent window of BITPACKED_TYPEID_FLOAT: 2**-95 <= abs(x) < 2**-31
+ * and 2**33 <= abs(x) < 2**97.  Bits are sign(63), exponent - 928 with
+ * the gap closed (62-56), mantissa without its lowest bit (55-5) and the
+ * lowest mantissa bit (1), which makes the tag FLOAT_WIDE_RSV.
+ */
+#define BP_WIDE_EXPMIN  928
+#define BP_WIDE_EXPGAP  0x40
+#define BP_800000       0x8000000000000000ULL
+#define BP_WIDE_MANT    0x00FFFFFFFFFFFFE0ULL
+
+typedef union {
+    double d;
+    BITPACKED_UWORD u;
+} bitpacked_double_bits;
+
+Py_LOCAL_INLINE(int)
+bitpacked_float_pack_wide(BITPACKED_UWORD x, PyObject **op)
+{
+    BITPACKED_UWORD d = ((x >> 52) & 0x7FF) - BP_WIDE_EXPMIN;
+    if(d >= 3 * BP_WIDE_EXPGAP)
+        return 0;
+    /* exponents in the middle third are tagged as BITPACKED_TYPEID_FLOAT */
+    assert(!(d & BP_WIDE_EXPGAP));
+    d -= (d >> 1) & BP_WIDE_EXPGAP;
+    *op = (PyObject*)((x & BP_800000) | (d << 56)
+        | ((x << BP_SHIFT) & BP_WIDE_MANT) | ((x & 1) << 1)
+        | BITPACKED_TYPEID_FLOAT_WIDE);
+    return 1;
+}
+
 double _bitpacked_float_as_double(void *op){
-    BITPACKED_UWORD x = (BITPACKED_UWORD)op;
-    x = (x & BP_C00000) | ((x & BP_200000) ? BP_3C0000 : BP_000000)
-        | ((x>>BP_SHIFT) & BP_03FFFF);
-    return *((double*)(&x));
+    return _PyBitpacked_FloatValue(op);
 }
 #endif
 
@@ -128,17 +166,31 @@ PyFloat_FromDouble(double fval)
 {
     PyFloatObject *op;
 #ifdef BITPACKED
-    BITPACKED_UWORD x = *((BITPACKED_UWORD*)(&fval));
+    bitpacked_double_bits bits = {fval};
+    BITPACKED_UWORD x = bits.u;
+    PyObject *tagged;
     if(!isnan(fval) && (((x & BP_3E0000) == BP_3E0000)||((x & BP_3E0000) == BP_000000))){
-        PyObject *op = (PyObject*)((x & BP_C00000)
+        tagged = (PyObject*)((x & BP_C00000)
             | ((x<<BP_SHIFT) & BP_3FFFF0) | BITPACKED_TYPEID_FLOAT);
-        Py_INCREF(op);
-        return op;
-    }
+        BITPACKED_STAT_TAGGED(BITPACKED_TYPEID(tagged));
+        Py_INCREF(tagged);
+        return tagged;
+    }
+    if(bitpacked_float_pack_wide(x, &tagged)){
+        BITPACKED_STAT_TAGGED(BITPACKED_TYPEID(tagged));
+        Py_INCREF(tagged);
+        return tagged;
+    }
+#ifdef BITPACKED_STATS
+    if(isnan(fval))
+        BITPACKED_STAT_FALLBACK(FLOAT_NAN);
+    else
+        BITPACKED_STAT_FALLBACK(FLOAT_EXPONENT);
+#endif
 #endif
     op = free_list;
     if (op != NULL) {
-        free_list = (PyFloatObject *) Py_TYPE(op);
+        free_list = FREE_LIST_NEXT(op);
         numfree--;
     } else {
         op = (PyFloatObject*) PyObject_MALLOC(sizeof(PyFloatObject));
@@ -231,7 +283,7 @@ float_dealloc(PyFloatObject *op)
             return;
         }
         numfree++;
-        Py_TYPE(op) = (struct _typeobject *)free_list;
+        SET_FREE_LIST_NEXT(op, free_list);
         free_list = op;
     }
     else
@@ -356,7 +408,9 @@ float_richcompare(PyObject *v, PyObject *w, int op)
      */
     if (PyFloat_Check(w))
         j = PyFloat_AS_DOUBLE(w);
-    else if (BITPACKED_LONG_CHECK(w))
+    else if (BITPACKED_LONG_CHECK(w) &&
+             Py_ABS(BITPACKED_LONG_VALUE(w)) <= (1L << 48))
+        /* exact in a double, see the nbits <= 48 case below */
         j = (double)BITPACKED_LONG_VALUE(w);
     else if (!Py_IS_FINITE(i)) {
         if (PyLong_Check(w))
@@ -1970,7 +2024,7 @@ PyFloat_ClearFreeList(void)
     PyFloatObject *f = free_list, *next;
     int i = numfree;
     while (f) {
-        next = (PyFloatObject*) Py_TYPE(f);
+        next = FREE_LIST_NEXT(f);
         PyObject_FREE(f);
         f = next;
     }
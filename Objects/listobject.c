@@ -9,6 +9,32 @@
 #include <sys/types.h>          /* For size_t */
 #endif
 
+#ifdef BITPACKED
+/* Full collections untrack lists whose items can never be part of a
+ * reference cycle (see _PyList_MaybeUntrack()), as they do for dicts.
+ * Storing an item that may be tracked has to track the list again.
+ */
+#define MAINTAIN_TRACKING(op, value) \
+    do { \
+        if (!_PyObject_GC_IS_TRACKED(op) && (value) != NULL && \
+            _PyObject_GC_MAY_BE_TRACKED(value)) \
+            _PyObject_GC_TRACK(op); \
+    } while (0)
+
+/* Track the list again if any of its items may be tracked */
+static void
+list_maintain_tracking(PyListObject *a)
+{
+    Py_ssize_t i;
+
+    for (i = 0; i < Py_SIZE(a) && !_PyObject_GC_IS_TRACKED(a); i++)
+        MAINTAIN_TRACKING(a, a->ob_item[i]);
+}
+#else
+#define MAINTAIN_TRACKING(op, value)
+#define list_maintain_tracking(a)
+#endif
+
 /* Ensure ob_item has room for at least newsize elements, and set
  * ob_size to newsize.  If newsize > ob_size on entry, the content
  * of the new slots at exit is undefined heap trash; it's the caller's
@@ -232,6 +258,7 @@ PyList_SetItem(PyObject *op, Py_ssize_t i,
     p = ((PyListObject *)op) -> ob_item + i;
     olditem = *p;
     *p = newitem;
+    MAINTAIN_TRACKING(op, newitem);
     Py_XDECREF(olditem);
     return 0;
 }
@@ -266,6 +293,7 @@ ins1(PyListObject *self, Py_ssize_t where, PyObject *v)
         items[i+1] = items[i];
     Py_INCREF(v);
     items[where] = v;
+    MAINTAIN_TRACKING(self, v);
     return 0;
 }
 
@@ -296,6 +324,7 @@ app1(PyListObject *self, PyObject *v)
 
     Py_INCREF(v);
     PyList_SET_ITEM(self, n, v);
+    MAINTAIN_TRACKING(self, v);
     return 0;
 }
 
@@ -666,6 +695,7 @@ list_ass_slice(PyListObject *a, Py_ssize_t ilow, Py_ssize_t ihigh, PyObject *v)
         PyObject *w = vitem[k];
         Py_XINCREF(w);
         item[ilow] = w;
+        MAINTAIN_TRACKING(a, w);
     }
     for (k = norig - 1; k >= 0; --k)
         Py_XDECREF(recycle[k]);
@@ -741,6 +771,7 @@ list_ass_item(PyListObject *a, Py_ssize_t i, PyObject *v)
     Py_INCREF(v);
     old_value = a->ob_item[i];
     a->ob_item[i] = v;
+    MAINTAIN_TRACKING(a, v);
     Py_DECREF(old_value);
     return 0;
 }
@@ -820,6 +851,7 @@ listextend(PyListObject *self, PyObject *b)
             PyObject *o = src[i];
             Py_INCREF(o);
             dest[i] = o;
+            MAINTAIN_TRACKING(self, o);
         }
         Py_DECREF(b);
         Py_RETURN_NONE;
@@ -866,6 +898,7 @@ listextend(PyListObject *self, PyObject *b)
             /* steals ref */
             PyList_SET_ITEM(self, Py_SIZE(self), item);
             ++Py_SIZE(self);
+            MAINTAIN_TRACKING(self, item);
         }
         else {
             int status = app1(self, item);
@@ -1031,11 +1064,119 @@ sortslice_advance(sortslice *slice, Py_ssize_t n)
         slice->values += n;
 }
 
-/* Comparison function: PyObject_RichCompareBool with Py_LT.
+/* The maximum number of entries in a MergeState's pending-runs stack.
+ * This is enough to sort arrays of size up to about
+ *     32 * phi ** MAX_MERGE_PENDING
+ * where phi ~= 1.618.  85 is ridiculouslylarge enough, good for an array
+ * with 2**64 elements.
+ */
+#define MAX_MERGE_PENDING 85
+
+/* When we get into galloping mode, we stay there until both runs win less
+ * often than MIN_GALLOP consecutive times.  See listsort.txt for more info.
+ */
+#define MIN_GALLOP 7
+
+/* Avoid malloc for small temp arrays. */
+#define MERGESTATE_TEMP_SIZE 256
+
+/* One MergeState exists on the stack per invocation of mergesort.  It's just
+ * a convenient way to pass state around among the helper functions.
+ */
+struct s_slice {
+    sortslice base;
+    Py_ssize_t len;
+};
+
+typedef struct s_MergeState {
+    /* This controls when we get *into* galloping mode.  It's initialized
+     * to MIN_GALLOP.  merge_lo and merge_hi tend to nudge it higher for
+     * random data, and lower for highly structured data.
+     */
+    Py_ssize_t min_gallop;
+
+    /* 'a' is temp storage to help with merges.  It contains room for
+     * alloced entries.
+     */
+    sortslice a;        /* may point to temparray below */
+    Py_ssize_t alloced;
+
+    /* A stack of n pending runs yet to be merged.  Run #i starts at
+     * address base[i] and extends for len[i] elements.  It's always
+     * true (so long as the indices are in bounds) that
+     *
+     *     pending[i].base + pending[i].len == pending[i+1].base
+     *
+     * so we could cut the storage for this, but it's a minor amount,
+     * and keeping all the info explicit simplifies the code.
+     */
+    int n;
+    struct s_slice pending[MAX_MERGE_PENDING];
+
+    /* This is the function we will use to compare two keys, even when none
+     * of our special cases apply and we have to use the generic
+     * PyObject_RichCompareBool().  See listsort().
+     */
+    int (*key_compare)(PyObject *, PyObject *);
+
+    /* 'a' points to this when possible, rather than muck with malloc. */
+    PyObject *temparray[MERGESTATE_TEMP_SIZE];
+} MergeState;
+
+/* Comparison function: ms->key_compare, which is generic_key_compare()
+ * unless listsort() found a cheaper one for the keys at hand.
  * Returns -1 on error, 1 if x < y, 0 if x >= y.
  */
 
-#define ISLT(X, Y) (PyObject_RichCompareBool(X, Y, Py_LT))
+#define ISLT(X, Y) (*(ms->key_compare))(X, Y)
+
+/* PyObject_RichCompareBool with Py_LT. */
+static int
+generic_key_compare(PyObject *v, PyObject *w)
+{
+    return PyObject_RichCompareBool(v, w, Py_LT);
+}
+
+#ifdef BITPACKED
+/* Keys which are all tagged ints, or all tagged floats, are ordered by the
+ * word alone, so these cannot fail and never call back into Python code.
+ * A tagged int is its value shifted left over the type id; NaN is never
+ * tagged, so the double comparison is a total order here as it is in
+ * float_richcompare().
+ */
+static int
+bitpacked_long_key_compare(PyObject *v, PyObject *w)
+{
+    assert(BITPACKED_LONG_CHECKEXACT(v) && BITPACKED_LONG_CHECKEXACT(w));
+    return (BITPACKED_SWORD)v < (BITPACKED_SWORD)w;
+}
+
+static int
+bitpacked_float_key_compare(PyObject *v, PyObject *w)
+{
+    assert(BITPACKED_FLOAT_CHECK(v) && BITPACKED_FLOAT_CHECK(w));
+    return _PyBitpacked_FloatValue(v) < _PyBitpacked_FloatValue(w);
+}
+
+/* Pick ms->key_compare for listsort() by scanning its n keys once. */
+static void
+bitpacked_select_key_compare(MergeState *ms, PyObject **keys, Py_ssize_t n)
+{
+    Py_ssize_t i;
+    if (BITPACKED_LONG_CHECKEXACT(keys[0])) {
+        for (i = 1; i < n; i++)
+            if (!BITPACKED_LONG_CHECKEXACT(keys[i]))
+                return;
+        ms->key_compare = bitpacked_long_key_compare;
+    }
+    else if (BITPACKED_FLOAT_CHECK(keys[0])) {
+        for (i = 1; i < n; i++)
+            if (!BITPACKED_FLOAT_CHECK(keys[i]))
+                return;
+        ms->key_compare = bitpacked_float_key_compare;
+    }
+}
+#endif
 
 /* Compare X to Y via "<".  Goto "fail" if the comparison raises an
    error.  Else "k" is set to true iff X<Y, and an "if (k)" block is
@@ -1056,7 +1197,7 @@ sortslice_advance(sortslice *slice, Py_ssize_t n)
    the input (nothing is lost or duplicated).
 */
 static int
-binarysort(sortslice lo, PyObject **hi, PyObject **start)
+binarysort(MergeState *ms, sortslice lo, PyObject **hi, PyObject **start)
 {
     Py_ssize_t k;
     PyObject **l, **p, **r;
@@ -1130,7 +1271,7 @@ elements to get out of order).
 Returns -1 in case of error.
 */
 static Py_ssize_t
-count_run(PyObject **lo, PyObject **hi, int *descending)
+count_run(MergeState *ms, PyObject **lo, PyObject **hi, int *descending)
 {
     Py_ssize_t k;
     Py_ssize_t n;
@@ -1185,7 +1326,8 @@ key, and the last n-k should follow key.
 Returns -1 on error.  See listsort.txt for info on the method.
 */
 static Py_ssize_t
-gallop_left(PyObject *key, PyObject **a, Py_ssize_t n, Py_ssize_t hint)
+gallop_left(MergeState *ms, PyObject *key, PyObject **a, Py_ssize_t n,
+            Py_ssize_t hint)
 {
     Py_ssize_t ofs;
     Py_ssize_t lastofs;
@@ -1276,7 +1418,8 @@ we're sticking to "<" comparisons that it's much harder to follow if
 written as one routine with yet another "left or right?" flag.
 */
 static Py_ssize_t
-gallop_right(PyObject *key, PyObject **a, Py_ssize_t n, Py_ssize_t hint)
+gallop_right(MergeState *ms, PyObject *key, PyObject **a, Py_ssize_t n,
+             Py_ssize_t hint)
 {
     Py_ssize_t ofs;
     Py_ssize_t lastofs;
@@ -1352,59 +1495,6 @@ fail:
     return -1;
 }
 
-/* The maximum number of entries in a MergeState's pending-runs stack.
- * This is enough to sort arrays of size up to about
- *     32 * phi ** MAX_MERGE_PENDING
- * where phi ~= 1.618.  85 is ridiculouslylarge enough, good for an array
- * with 2**64 elements.
- */
-#define MAX_MERGE_PENDING 85
-
-/* When we get into galloping mode, we stay there until both runs win less
- * often than MIN_GALLOP consecutive times.  See listsort.txt for more info.
- */
-#define MIN_GALLOP 7
-
-/* Avoid malloc for small temp arrays. */
-#define MERGESTATE_TEMP_SIZE 256
-
-/* One MergeState exists on the stack per invocation of mergesort.  It's just
- * a convenient way to pass state around among the helper functions.
- */
-struct s_slice {
-    sortslice base;
-    Py_ssize_t len;
-};
-
-typedef struct s_MergeState {
-    /* This controls when we get *into* galloping mode.  It's initialized
-     * to MIN_GALLOP.  merge_lo and merge_hi tend to nudge it higher for
-     * random data, and lower for highly structured data.
-     */
-    Py_ssize_t min_gallop;
-
-    /* 'a' is temp storage to help with merges.  It contains room for
-     * alloced entries.
-     */
-    sortslice a;        /* may point to temparray below */
-    Py_ssize_t alloced;
-
-    /* A stack of n pending runs yet to be merged.  Run #i starts at
-     * address base[i] and extends for len[i] elements.  It's always
-     * true (so long as the indices are in bounds) that
-     *
-     *     pending[i].base + pending[i].len == pending[i+1].base
-     *
-     * so we could cut the storage for this, but it's a minor amount,
-     * and keeping all the info explicit simplifies the code.
-     */
-    int n;
-    struct s_slice pending[MAX_MERGE_PENDING];
-
-    /* 'a' points to this when possible, rather than muck with malloc. */
-    PyObject *temparray[MERGESTATE_TEMP_SIZE];
-} MergeState;
-
 /* Conceptually a MergeState's constructor. */
 static void
 merge_init(MergeState *ms, Py_ssize_t list_size, int has_keyfunc)
@@ -1432,6 +1522,7 @@ merge_init(MergeState *ms, Py_ssize_t list_size, int has_keyfunc)
     ms->a.keys = ms->temparray;
     ms->n = 0;
     ms->min_gallop = MIN_GALLOP;
+    ms->key_compare = generic_key_compare;
 }
 
 /* Free all the temp memory owned by the MergeState.  This must be called
@@ -1557,7 +1648,7 @@ merge_lo(MergeState *ms, sortslice ssa, Py_ssize_t na,
             assert(na > 1 && nb > 0);
             min_gallop -= min_gallop > 1;
             ms->min_gallop = min_gallop;
-            k = gallop_right(ssb.keys[0], ssa.keys, na, 0);
+            k = gallop_right(ms, ssb.keys[0], ssa.keys, na, 0);
             acount = k;
             if (k) {
                 if (k < 0)
@@ -1580,7 +1671,7 @@ merge_lo(MergeState *ms, sortslice ssa, Py_ssize_t na,
             if (nb == 0)
                 goto Succeed;
 
-            k = gallop_left(ssa.keys[0], ssb.keys, nb, 0);
+            k = gallop_left(ms, ssa.keys[0], ssb.keys, nb, 0);
             bcount = k;
             if (k) {
                 if (k < 0)
@@ -1695,7 +1786,7 @@ merge_hi(MergeState *ms, sortslice ssa, Py_ssize_t na,
             assert(na > 0 && nb > 1);
             min_gallop -= min_gallop > 1;
             ms->min_gallop = min_gallop;
-            k = gallop_right(ssb.keys[0], basea.keys, na, na-1);
+            k = gallop_right(ms, ssb.keys[0], basea.keys, na, na-1);
             if (k < 0)
                 goto Fail;
             k = na - k;
@@ -1713,7 +1804,7 @@ merge_hi(MergeState *ms, sortslice ssa, Py_ssize_t na,
             if (nb == 1)
                 goto CopyA;
 
-            k = gallop_left(ssa.keys[0], baseb.keys, nb, nb-1);
+            k = gallop_left(ms, ssa.keys[0], baseb.keys, nb, nb-1);
             if (k < 0)
                 goto Fail;
             k = nb - k;
@@ -1790,7 +1881,7 @@ merge_at(MergeState *ms, Py_ssize_t i)
     /* Where does b start in a?  Elements in a before that can be
      * ignored (already in place).
      */
-    k = gallop_right(*ssb.keys, ssa.keys, na, 0);
+    k = gallop_right(ms, *ssb.keys, ssa.keys, na, 0);
     if (k < 0)
         return -1;
     sortslice_advance(&ssa, k);
@@ -1801,7 +1892,7 @@ merge_at(MergeState *ms, Py_ssize_t i)
     /* Where does a end in b?  Elements in b after that can be
      * ignored (already in place).
      */
-    nb = gallop_left(ssa.keys[na-1], ssb.keys, nb, nb-1);
+    nb = gallop_left(ms, ssa.keys[na-1], ssb.keys, nb, nb-1);
     if (nb <= 0)
         return nb;
 
@@ -1989,6 +2080,11 @@ listsort(PyListObject *self, PyObject *args, PyObject *kwds)
     if (nremaining < 2)
         goto succeed;
 
+#ifdef BITPACKED
+    /* Homogeneous tagged keys compare without PyObject_RichCompareBool() */
+    bitpacked_select_key_compare(&ms, lo.keys, saved_ob_size);
+#endif
+
     /* Reverse sort stability achieved by initially reversing the list,
     applying a stable forward sort, then reversing the final result. */
     if (reverse) {
@@ -2006,7 +2102,7 @@ listsort(PyListObject *self, PyObject *args, PyObject *kwds)
         Py_ssize_t n;
 
         /* Identify next run. */
-        n = count_run(lo.keys, lo.keys + nremaining, &descending);
+        n = count_run(&ms, lo.keys, lo.keys + nremaining, &descending);
         if (n < 0)
             goto fail;
         if (descending)
@@ -2015,7 +2111,7 @@ listsort(PyListObject *self, PyObject *args, PyObject *kwds)
         if (n < minrun) {
             const Py_ssize_t force = nremaining <= minrun ?
                               nremaining : minrun;
-            if (binarysort(lo, lo.keys + force, lo.keys + n) < 0)
+            if (binarysort(&ms, lo, lo.keys + force, lo.keys + n) < 0)
                 goto fail;
             n = force;
         }
@@ -2069,6 +2165,8 @@ keyfunc_fail:
     Py_SIZE(self) = saved_ob_size;
     self->ob_item = saved_ob_item;
     self->allocated = saved_allocated;
+    /* a collection during the sort may have untracked the empty list */
+    list_maintain_tracking(self);
     if (final_ob_item != NULL) {
         /* we cannot use list_clear() for this because it does not
            guarantee that the list is really empty when it returns */
@@ -2211,6 +2309,28 @@ listremove(PyListObject *self, PyObject *v)
     return NULL;
 }
 
+#ifdef BITPACKED
+/* Untrack the list if it can not be part of a reference cycle: all of
+ * its items are tagged values or objects that are never tracked.  A list
+ * with NULL items is still being filled in by C code, and stays tracked.
+ */
+void
+_PyList_MaybeUntrack(PyObject *op)
+{
+    PyListObject *a = (PyListObject *)op;
+    Py_ssize_t i;
+
+    if (!PyList_CheckExact(op) || !_PyObject_GC_IS_TRACKED(op))
+        return;
+    for (i = 0; i < Py_SIZE(a); i++) {
+        PyObject *elt = a->ob_item[i];
+        if (elt == NULL || _PyObject_GC_MAY_BE_TRACKED(elt))
+            return;
+    }
+    _PyObject_GC_UNTRACK(op);
+}
+#endif
+
 static int
 list_traverse(PyListObject *o, visitproc visit, void *arg)
 {
@@ -2597,6 +2717,7 @@ list_ass_subscript(PyListObject* self, PyObject* item, PyObject* value)
                 ins = seqitems[i];
                 Py_INCREF(ins);
                 selfitems[cur] = ins;
+                MAINTAIN_TRACKING(self, ins);
             }
 
             for (i = 0; i < slicelength; i++) {
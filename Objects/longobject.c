@@ -14,6 +14,7 @@ static PyObject * _PyLong_FromLong_conventional(long ival);
 #define BITPACKED_LONG_INPLACE_CONVENTIONAL(ob)   \
     do if(BITPACKED_LONG_CHECK(ob)) {             \
         void* bitpacked_temp = (ob);              \
+        BITPACKED_STAT_REBOX();                   \
         (ob) = (void*)_PyLong_FromLong_conventional(BITPACKED_LONG_VALUE(ob)); \
         Py_DECREF(bitpacked_temp);                \
     }while(0)
@@ -26,6 +27,7 @@ static PyObject * _PyLong_FromLong_conventional(long ival);
     {                                                \
         void *bitpacked_temp_##x = NULL;             \
         if(BITPACKED_LONG_CHECK(x)) {                \
+            BITPACKED_STAT_REBOX();                  \
             bitpacked_temp_##x = (x);                \
             (x) = (void*)_PyLong_FromLong_conventional(BITPACKED_LONG_VALUE(x)); \
         }                                            \
@@ -46,11 +48,11 @@ Py_LOCAL_INLINE(void)
 bitpacked_fast_conventional_helper(char *temp1, void *p)
 {
     void **px = (void**)p;
-    bitpacked_static_assert(PyLong_SHIFT*2 > SIZEOF_INT*8);
+    bitpacked_static_assert(PyLong_SHIFT*2 >= BITPACKED_LONG_BITS);
     if(BITPACKED_LONG_CHECK(*px)){
         long nn = BITPACKED_LONG_VALUE(*px);
         int size = 0, sign = (nn < 0 ? -1 : 1);
-        Py_TYPE(temp1) = &PyLong_Type;
+        Py_SET_TYPE(temp1, &PyLong_Type);
         Py_REFCNT(temp1) = BITPACKED_DUMMY_REFCNT;
         if(sign == -1) nn = -nn;
         while(nn){
@@ -65,6 +67,7 @@ bitpacked_fast_conventional_helper(char *temp1, void *p)
     {                                                     \
         void *bitpacked_temp0_##x = (x);                  \
         char bitpacked_temp1_##x[sizeof(PyVarObject)+sizeof(digit)*2] = {0};  \
+        if(BITPACKED_LONG_CHECK(x)) BITPACKED_STAT_REBOX();  \
         bitpacked_fast_conventional_helper(bitpacked_temp1_##x, &(x));  \
         do{
 #define BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_END(x)    \
@@ -73,13 +76,11 @@ bitpacked_fast_conventional_helper(char *temp1, void *p)
     }
 #define BITPACKED_LONG_PSEUDOSIZE(ob) (BITPACKED_CHECK(ob)?BITPACKED_LONG_VALUE(ob):Py_SIZE(ob))
 #define BITPACKED_LONG_RETURN(ival) do {         \
-        bitpacked_longobject w_ret;              \
-        w_ret.uword = BITPACKED_TYPEID_LONG;     \
-        w_ret.value = (ival);                    \
-        Py_INCREF(w_ret.pyobj);                  \
-        return (void*)w_ret.pyobj;               \
+        PyObject *w_ret = BITPACKED_LONG_PACK(ival); \
+        BITPACKED_STAT_TAGGED(BITPACKED_TYPEID_LONG); \
+        Py_INCREF(w_ret);                        \
+        return (void*)w_ret;                     \
     } while(0)
-#define BITPACKED_LONG_RANGE_CHECK(ival) (INT_MIN <= (ival) && (ival) <= INT_MAX)
 #define NSMALLPOSINTS           0
 #define NSMALLNEGINTS           0
 #else
@@ -90,7 +91,6 @@ bitpacked_fast_conventional_helper(char *temp1, void *p)
 #define BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_END(x) if(0){} }while(0);
 #define BITPACKED_LONG_PSEUDOSIZE(ob) Py_SIZE(ob)
 #define BITPACKED_LONG_RETURN(ival) abort()
-#define BITPACKED_LONG_RANGE_CHECK(ival) 0
 #ifndef NSMALLPOSINTS
 #define NSMALLPOSINTS           257
 #endif
@@ -111,6 +111,7 @@ bitpacked_fast_conventional_helper(char *temp1, void *p)
 #define CHECK_SMALL_INT(ival) do {               \
     if (BITPACKED_LONG_RANGE_CHECK(ival))        \
         BITPACKED_LONG_RETURN(ival);             \
+    BITPACKED_STAT_FALLBACK(LONG_RANGE);         \
     } while(0)
 static PyLongObject *
 maybe_small_long(PyLongObject *v)
@@ -118,13 +119,18 @@ maybe_small_long(PyLongObject *v)
 #if (PyLong_SHIFT != 30) || (SIZEOF_INT != 4) || (SIZEOF_LONG != 8) || (SIZEOF_VOID_P != 8)
 #error "Bit-Packed datasize error"
 #endif
-    if (v && !BITPACKED_CHECK(v) && Py_ABS(Py_SIZE(v)) <= 1) {
-        sdigit ival = MEDIUM_VALUE(v);
+    if (v && !BITPACKED_CHECK(v) && Py_ABS(Py_SIZE(v)) <= 2) {
+        long ival = Py_ABS(Py_SIZE(v)) <= 1 ? (long)MEDIUM_VALUE(v)
+            : (long)v->ob_digit[0] | ((long)v->ob_digit[1] << PyLong_SHIFT);
+        if (Py_SIZE(v) < -1)
+            ival = -ival;
         if(BITPACKED_LONG_RANGE_CHECK(ival)){
             Py_DECREF(v);
             BITPACKED_LONG_RETURN(ival);
         }
     }
+    if (v && !BITPACKED_CHECK(v))
+        BITPACKED_STAT_FALLBACK(LONG_RANGE);
     return v;
 }
 #else
@@ -187,13 +193,13 @@ _PyLong_Negate(PyLongObject **x_p)
     x = (PyLongObject *)*x_p;
 #ifdef BITPACKED
     if(BITPACKED_CHECK(x)){
-        bitpacked_longobject *w = (bitpacked_longobject*)(&x);
-        if(w->value != INT_MIN){
-            w->value = -w->value;
-            *x_p = x;
+        long n = -BITPACKED_LONG_VALUE(x);
+        if(BITPACKED_LONG_RANGE_CHECK(n)){
+            BITPACKED_STAT_TAGGED(BITPACKED_TYPEID_LONG);
+            *x_p = (PyLongObject *)BITPACKED_LONG_PACK(n);
         }else{
-            *x_p = (PyLongObject *)_PyLong_FromLong_conventional(-(long)w->value);
-            Py_DECREF(x);
+            BITPACKED_STAT_FALLBACK(LONG_RANGE);
+            *x_p = (PyLongObject *)_PyLong_FromLong_conventional(n);
         }
         return;
     }
@@ -355,7 +361,7 @@ PyObject *
 PyLong_FromLong(long ival)
 #ifdef BITPACKED
 {
-    bitpacked_static_assert(sizeof(BITPACKED_UWORD) == sizeof(bitpacked_longobject));
+    bitpacked_static_assert(sizeof(BITPACKED_UWORD) == sizeof(PyObject*));
     bitpacked_static_assert(sizeof(long) == 8);
     CHECK_SMALL_INT(ival);
     return _PyLong_FromLong_conventional(ival);
@@ -441,6 +447,10 @@ PyLong_FromUnsignedLong(unsigned long ival)
     unsigned long t;
     int ndigits = 0;
 
+#ifdef BITPACKED
+    if (ival <= (unsigned long)BITPACKED_LONG_MAX)
+        return PyLong_FromLong((long)ival);
+#endif
     if (ival < PyLong_BASE)
         return PyLong_FromLong(ival);
     /* Count the number of Python digits. */
@@ -500,7 +510,7 @@ PyLong_FromDouble(double dval)
     }
     if (neg)
         Py_SIZE(v) = -(Py_SIZE(v));
-    return (PyObject *)v;
+    return (PyObject *)maybe_small_long(v);
 }
 
 /* Checking for overflow in PyLong_AsLong is a PITA since C doesn't define
@@ -634,7 +644,6 @@ _PyLong_AsInt(PyObject *obj)
 {
     int overflow;
     long result;
-    if(BITPACKED_LONG_CHECK(obj)) return BITPACKED_LONG_VALUE(obj);
     result = PyLong_AsLongAndOverflow(obj, &overflow);
     if (overflow || result > INT_MAX || result < INT_MIN) {
         /* XXX: could be cute and give a different
@@ -1029,9 +1038,44 @@ _PyLong_FromByteArray(const unsigned char* bytes, size_t n,
     }
 
     Py_SIZE(v) = is_signed ? -idigit : idigit;
-    return (PyObject *)long_normalize(v);
+    return (PyObject *)maybe_small_long(long_normalize(v));
 }
 
+#ifdef BITPACKED
+/* _PyLong_AsByteArray() for a tagged value: store the two's complement
+ * bytes straight from the machine word.
+ */
+static int
+bitpacked_long_as_bytearray(long ival, unsigned char* bytes, size_t n,
+                            int little_endian, int is_signed)
+{
+    long rest = ival;
+    size_t j;
+
+    if (ival < 0 && !is_signed) {
+        PyErr_SetString(PyExc_OverflowError,
+                        "can't convert negative int to unsigned");
+        return -1;
+    }
+    for (j = 0; j < n; ++j) {
+        bytes[little_endian ? j : n - 1 - j] = (unsigned char)(rest & 0xff);
+        rest >>= 8;
+    }
+    /* what did not fit must be pure sign extension, and a signed result
+       must also carry the right sign in its top bit */
+    if (rest != (ival < 0 ? -1 : 0))
+        goto Overflow;
+    if (is_signed && n > 0 &&
+        ((bytes[little_endian ? n - 1 : 0] & 0x80) != 0) != (ival < 0))
+        goto Overflow;
+    return 0;
+
+  Overflow:
+    PyErr_SetString(PyExc_OverflowError, "int too big to convert");
+    return -1;
+}
+#endif
+
 int
 _PyLong_AsByteArray(PyLongObject* v,
                     unsigned char* bytes, size_t n,
@@ -1049,6 +1093,11 @@ _PyLong_AsByteArray(PyLongObject* v,
 
     assert(v != NULL && PyLong_Check(v));
 
+#ifdef BITPACKED
+    if (BITPACKED_LONG_CHECK(v))
+        return bitpacked_long_as_bytearray(BITPACKED_LONG_VALUE(v), bytes, n,
+                                           little_endian, is_signed);
+#endif
 BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_BEGIN(v)
     if (Py_SIZE(v) < 0) {
         ndigits = -(Py_SIZE(v));
@@ -1282,6 +1331,10 @@ PyLong_FromUnsignedLongLong(unsigned PY_LONG_LONG ival)
     unsigned PY_LONG_LONG t;
     int ndigits = 0;
 
+#ifdef BITPACKED
+    if (ival <= (unsigned PY_LONG_LONG)BITPACKED_LONG_MAX)
+        return PyLong_FromLong((long)ival);
+#endif
     if (ival < PyLong_BASE)
         return PyLong_FromLong((long)ival);
     /* Count the number of Python digits. */
@@ -1351,6 +1404,10 @@ PyLong_FromSize_t(size_t ival)
     size_t t;
     int ndigits = 0;
 
+#ifdef BITPACKED
+    if (ival <= (size_t)BITPACKED_LONG_MAX)
+        return PyLong_FromLong((long)ival);
+#endif
     if (ival < PyLong_BASE)
         return PyLong_FromLong((long)ival);
     /* Count the number of Python digits. */
@@ -1949,7 +2006,7 @@ static PyObject *
 long_to_decimal_string(PyObject *aa)
 {
     PyObject *v;
-    if(BITPACKED_LONG_CHECK(aa)) return PyUnicode_FromFormat("%d", BITPACKED_LONG_VALUE(aa));
+    if(BITPACKED_LONG_CHECK(aa)) return PyUnicode_FromFormat("%ld", BITPACKED_LONG_VALUE(aa));
     if (long_to_decimal_string_internal(aa, &v, NULL) == -1)
         return NULL;
     return v;
@@ -2111,7 +2168,7 @@ _PyLong_Format(PyObject *obj, int base)
     PyObject *str;
     int err;
 #if 0
-    if(base == 10 && BITPACKED_LONG_CHECK(obj)) return PyUnicode_FromFormat("%d", BITPACKED_LONG_VALUE(obj));
+    if(base == 10 && BITPACKED_LONG_CHECK(obj)) return PyUnicode_FromFormat("%ld", BITPACKED_LONG_VALUE(obj));
 #endif
     if (base == 10)
         err = long_to_decimal_string_internal(obj, &str, NULL);
@@ -3189,7 +3246,7 @@ long_add(PyLongObject *a, PyLongObject *b)
     PyLongObject *z;
 
     if(BITPACKED_LONG_CHECK2(a, b))
-        return PyLong_FromLong((long)BITPACKED_LONG_VALUE(a) + (long)BITPACKED_LONG_VALUE(b));
+        return PyLong_FromLong(BITPACKED_LONG_VALUE(a) + BITPACKED_LONG_VALUE(b));
     CHECK_BINOP(a, b);
 
 BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_BEGIN(a)
@@ -3217,7 +3274,7 @@ BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_BEGIN(b)
     }
 BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_END(b)
 BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_END(a)
-    return (PyObject *)z;
+    return (PyObject *)maybe_small_long(z);
 }
 
 static PyObject *
@@ -3226,7 +3283,7 @@ long_sub(PyLongObject *a, PyLongObject *b)
     PyLongObject *z;
 
     if(BITPACKED_LONG_CHECK2(a, b))
-        return PyLong_FromLong((long)BITPACKED_LONG_VALUE(a) - (long)BITPACKED_LONG_VALUE(b));
+        return PyLong_FromLong(BITPACKED_LONG_VALUE(a) - BITPACKED_LONG_VALUE(b));
     CHECK_BINOP(a, b);
 
 BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_BEGIN(a)
@@ -3251,7 +3308,7 @@ BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_BEGIN(b)
         else
             z = x_sub(a, b);
     }
-    return (PyObject *)z;
+    return (PyObject *)maybe_small_long(z);
 BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_END(b)
 BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_END(a)
 }
@@ -3673,8 +3730,13 @@ long_mul(PyLongObject *a, PyLongObject *b)
 {
     PyLongObject *z;
 
-    if(BITPACKED_LONG_CHECK2(a, b))
-        return PyLong_FromLong((long)BITPACKED_LONG_VALUE(a) * (long)BITPACKED_LONG_VALUE(b));
+#ifdef BITPACKED
+    if(BITPACKED_LONG_CHECK2(a, b)) {
+        long res;
+        if(!__builtin_mul_overflow(BITPACKED_LONG_VALUE(a), BITPACKED_LONG_VALUE(b), &res))
+            return PyLong_FromLong(res);
+    }
+#endif
     CHECK_BINOP(a, b);
 
 BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_BEGIN(a)
@@ -3702,7 +3764,7 @@ BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_BEGIN(b)
         if (z == NULL)
             return NULL;
     }
-    return (PyObject *)z;
+    return (PyObject *)maybe_small_long(z);
 BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_END(b)
 BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_END(a)
 }
@@ -3793,6 +3855,53 @@ bitpacked_l_divmod(PyObject *a, PyObject *b, long *div, long *mod)
     }
     return 1;
 }
+
+/* base ** exp for exp >= 0; returns 0 when the result does not fit a long */
+Py_LOCAL_INLINE(int)
+bitpacked_l_pow(long base, long exp, long *res)
+{
+    long r = 1;
+    for(;;){
+        if((exp & 1) && __builtin_mul_overflow(r, base, &r))
+            return 0;
+        exp >>= 1;
+        if(!exp)
+            break;
+        if(__builtin_mul_overflow(base, base, &base))
+            return 0;
+    }
+    *res = r;
+    return 1;
+}
+
+/* pow(base, exp, mod) for exp >= 0 and mod != 0; the result takes the
+ * sign of mod like long_pow().  Returns 0 when a product of two residues
+ * could overflow, which only happens without a 128bit integer type.
+ */
+Py_LOCAL_INLINE(int)
+bitpacked_l_powmod(long base, long exp, long mod, long *res)
+{
+    unsigned long m = mod < 0 ? -(unsigned long)mod : (unsigned long)mod;
+    unsigned long b, r = 1 % m;
+#ifdef __SIZEOF_INT128__
+#define BITPACKED_MULMOD(x, y) \
+    ((unsigned long)((unsigned __int128)(x) * (y) % m))
+#else
+#define BITPACKED_MULMOD(x, y) ((x) * (y) % m)
+    if(m > (1UL << 32))
+        return 0;
+#endif
+    b = base < 0 ? m - 1 - (unsigned long)(-(base + 1)) % m
+                 : (unsigned long)base % m;
+    for(; exp; exp >>= 1){
+        if(exp & 1)
+            r = BITPACKED_MULMOD(r, b);
+        b = BITPACKED_MULMOD(b, b);
+    }
+#undef BITPACKED_MULMOD
+    *res = (mod < 0 && r) ? (long)r + mod : (long)r;
+    return 1;
+}
 #endif
 
 static PyObject *
@@ -3803,17 +3912,17 @@ long_div(PyObject *a, PyObject *b)
 #ifdef BITPACKED
     if(BITPACKED_LONG_CHECK2(a, b)) {
         long div, mod;
-        /* when a, b == INT_MIN, -1, div is INT_MAX+1 */
+        /* when a, b == BITPACKED_LONG_MIN, -1, div is out of range */
         if(bitpacked_l_divmod(a, b, &div, &mod)) return PyLong_FromLong(div);
         return NULL;
     }
 #endif
     CHECK_BINOP(a, b);
 BITPACKED_LONG_ASSURE_CONVENTIONAL_BEGIN(a)
-BITPACKED_LONG_ASSURE_CONVENTIONAL_BEGIN(b)
+BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_BEGIN(b)
     if (l_divmod((PyLongObject*)a, (PyLongObject*)b, &div, NULL) < 0)
         div = NULL;
-BITPACKED_LONG_ASSURE_CONVENTIONAL_END(b)
+BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_END(b)
 BITPACKED_LONG_ASSURE_CONVENTIONAL_END(a)
     return (PyObject *)div;
 }
@@ -3832,7 +3941,11 @@ long_true_divide(PyObject *v, PyObject *w)
     int inexact, negate, a_is_small, b_is_small;
     double dx, result;
 
-    if(BITPACKED_LONG_CHECK2(v, w)){
+    /* Both values convert to double exactly, so one division rounds
+     * correctly. */
+    if(BITPACKED_LONG_CHECK2(v, w)
+       && Py_ABS(BITPACKED_LONG_VALUE(v)) <= (1L << DBL_MANT_DIG)
+       && Py_ABS(BITPACKED_LONG_VALUE(w)) <= (1L << DBL_MANT_DIG)){
         if(BITPACKED_LONG_VALUE(w) == 0) {
             PyErr_SetString(PyExc_ZeroDivisionError,
                             "division by zero");
@@ -4109,10 +4222,10 @@ long_mod(PyObject *a, PyObject *b)
     CHECK_BINOP(a, b);
 
 BITPACKED_LONG_ASSURE_CONVENTIONAL_BEGIN(a)
-BITPACKED_LONG_ASSURE_CONVENTIONAL_BEGIN(b)
+BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_BEGIN(b)
     if (l_divmod((PyLongObject*)a, (PyLongObject*)b, NULL, &mod) < 0)
         mod = NULL;
-BITPACKED_LONG_ASSURE_CONVENTIONAL_END(b)
+BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_END(b)
 BITPACKED_LONG_ASSURE_CONVENTIONAL_END(a)
     return (PyObject *)mod;
 }
@@ -4140,7 +4253,7 @@ long_divmod(PyObject *a, PyObject *b)
     CHECK_BINOP(a, b);
 
 BITPACKED_LONG_ASSURE_CONVENTIONAL_BEGIN(a)
-BITPACKED_LONG_ASSURE_CONVENTIONAL_BEGIN(b)
+BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_BEGIN(b)
     if (l_divmod((PyLongObject*)a, (PyLongObject*)b, &div, &mod) < 0) {
         z = NULL;
         goto exit;
@@ -4155,7 +4268,7 @@ BITPACKED_LONG_ASSURE_CONVENTIONAL_BEGIN(b)
         Py_DECREF(mod);
     }
   exit:
-BITPACKED_LONG_ASSURE_CONVENTIONAL_END(b)
+BITPACKED_LONG_ASSURE_FAST_CONVENTIONAL_END(b)
 BITPACKED_LONG_ASSURE_CONVENTIONAL_END(a)
     return z;
 }
@@ -4179,6 +4292,22 @@ long_pow(PyObject *v, PyObject *w, PyObject *x)
 
     /* a, b, c = v, w, x */
     CHECK_BINOP(v, w);
+#ifdef BITPACKED
+    if(BITPACKED_LONG_CHECK2(v, w) && BITPACKED_LONG_VALUE(w) >= 0) {
+        long res;
+        if(x == Py_None) {
+            if(bitpacked_l_pow(BITPACKED_LONG_VALUE(v),
+                               BITPACKED_LONG_VALUE(w), &res))
+                return PyLong_FromLong(res);
+        }
+        else if(BITPACKED_LONG_CHECK(x) && BITPACKED_LONG_VALUE(x) != 0) {
+            if(bitpacked_l_powmod(BITPACKED_LONG_VALUE(v),
+                                  BITPACKED_LONG_VALUE(w),
+                                  BITPACKED_LONG_VALUE(x), &res))
+                BITPACKED_LONG_RETURN(res);
+        }
+    }
+#endif
 BITPACKED_LONG_ASSURE_CONVENTIONAL_BEGIN(v)
 BITPACKED_LONG_ASSURE_CONVENTIONAL_BEGIN(w)
 BITPACKED_LONG_ASSURE_CONVENTIONAL_BEGIN(x)
@@ -4398,7 +4527,7 @@ long_neg(PyLongObject *v)
     z = (PyLongObject *)_PyLong_Copy(v);
     if (z != NULL)
         Py_SIZE(z) = -(Py_SIZE(v));
-    return (PyObject *)z;
+    return (PyObject *)maybe_small_long(z);
 }
 
 static PyObject *
@@ -4432,14 +4561,14 @@ long_rshift(PyLongObject *a, PyLongObject *b)
     digit lomask, himask;
 
     if(BITPACKED_LONG_CHECK2(a, b)) {
-        int na = BITPACKED_LONG_VALUE(a);
-        int nb = BITPACKED_LONG_VALUE(b);
+        long na = BITPACKED_LONG_VALUE(a);
+        long nb = BITPACKED_LONG_VALUE(b);
         if(nb < 0){
             PyErr_SetString(PyExc_ValueError,
                             "negative shift count");
             return NULL;
         }
-        BITPACKED_LONG_RETURN(nb >= 32 ? (na >= 0 ? 0 : -1) : na >> nb);
+        BITPACKED_LONG_RETURN(nb >= BITPACKED_LONG_BITS ? (na >= 0 ? 0 : -1) : na >> nb);
     }
     CHECK_BINOP(a, b);
     if (BITPACKED_LONG_PSEUDOSIZE(a) < 0) {
@@ -4510,8 +4639,8 @@ long_lshift(PyObject *v, PyObject *w)
             return NULL;
         }
         if(na == 0) BITPACKED_LONG_RETURN(0);
-        if(nb < 32){
-            res = na << nb;
+        if(nb < BITPACKED_LONG_BITS){
+            res = (long)((unsigned long)na << nb);
             if(res >> nb == na){
                 CHECK_SMALL_INT(res);
             }
@@ -4766,7 +4895,8 @@ _PyLong_GCD(PyObject *aarg, PyObject *barg)
             y = x % y;
             x = t;
         }
-        BITPACKED_LONG_RETURN(x);
+        /* gcd(BITPACKED_LONG_MIN, 0) does not fit */
+        return PyLong_FromLong(x);
     }
 
     a = (PyLongObject *)aarg;
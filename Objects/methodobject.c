@@ -134,6 +134,11 @@ PyCFunction_Call(PyObject *func, PyObject *args, PyObject *kwds)
             res = (*meth)(self, arg);
             break;
 
+        case METH_FASTCALL:
+            res = (*(_PyCFunctionFast)meth)(self, &PyTuple_GET_ITEM(args, 0),
+                                            PyTuple_GET_SIZE(args));
+            break;
+
         default:
             PyErr_SetString(PyExc_SystemError,
                             "Bad call flags in PyCFunction_Call. "
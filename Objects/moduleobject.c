@@ -33,10 +33,18 @@ PyModuleDef_Init(struct PyModuleDef* def)
 {
     if (PyType_Ready(&PyModuleDef_Type) < 0)
          return NULL;
+#ifdef BITPACKED
+    if ((BITPACKED_UWORD)def & (BITPACKED_ALIGNMENT - 1)) {
+        PyErr_Format(PyExc_SystemError,
+                     "module definition of '%s' is not 16-byte aligned",
+                     def->m_name);
+        return NULL;
+    }
+#endif
     if (def->m_base.m_index == 0) {
         max_module_number++;
         Py_REFCNT(def) = 1;
-        Py_TYPE(def) = &PyModuleDef_Type;
+        Py_SET_TYPE(def, &PyModuleDef_Type);
         def->m_base.m_index = max_module_number;
     }
     return (PyObject*)def;
@@ -206,7 +214,8 @@ PyModule_FromDefAndSpec2(struct PyModuleDef* def, PyObject *spec, int module_api
     char *name;
     int ret;
 
-    PyModuleDef_Init(def);
+    if (PyModuleDef_Init(def) == NULL)
+        return NULL;
 
     nameobj = PyObject_GetAttrString(spec, "name");
     if (nameobj == NULL) {
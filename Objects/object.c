@@ -3,6 +3,7 @@
 
 #include "Python.h"
 #include "frameobject.h"
+#include <stddef.h>               /* For offsetof */
 
 #ifdef __cplusplus
 extern "C" {
@@ -217,7 +218,7 @@ _Py_NegativeRefcount(const char *fname, int lineno, PyObject *op)
     PyOS_snprintf(buf, sizeof(buf),
                   "%s:%i object at %p has negative ref count "
                   "%" PY_FORMAT_SIZE_T "d",
-                  fname, lineno, op, Py_REFCNT(op));
+                  fname, lineno, op, (Py_ssize_t)Py_REFCNT(op));
     Py_FatalError(buf);
 }
 
@@ -241,7 +242,7 @@ PyObject_Init(PyObject *op, PyTypeObject *tp)
     if (op == NULL)
         return PyErr_NoMemory();
     /* Any changes should be reflected in PyObject_INIT (objimpl.h) */
-    Py_TYPE(op) = tp;
+    Py_SET_TYPE(op, tp);
     _Py_NewReference(op);
     return op;
 }
@@ -253,7 +254,7 @@ PyObject_InitVar(PyVarObject *op, PyTypeObject *tp, Py_ssize_t size)
         return (PyVarObject *) PyErr_NoMemory();
     /* Any changes should be reflected in PyObject_INIT_VAR */
     Py_SIZE(op) = size;
-    Py_TYPE(op) = tp;
+    Py_SET_TYPE(op, tp);
     _Py_NewReference((PyObject *)op);
     return op;
 }
@@ -1121,6 +1122,44 @@ PyObject_GenericGetAttr(PyObject *obj, PyObject *name)
     return _PyObject_GenericGetAttrWithDict(obj, name, NULL);
 }
 
+/* Look up obj.name for a call.  If generic attribute lookup would bind a
+   Python function or a method descriptor found on the type, set *method to
+   it and return 1, so that the caller can pass obj as the first argument
+   instead of allocating a bound method.  Otherwise set *method to the result of
+   PyObject_GetAttr() (NULL with an exception set on failure) and return 0.
+*/
+int
+_PyObject_GetMethod(PyObject *obj, PyObject *name, PyObject **method)
+{
+    PyTypeObject *tp = Py_TYPE(obj);
+    PyObject *descr, *dict, **dictptr;
+    int shadowed = 0;
+
+    if (tp->tp_getattro == PyObject_GenericGetAttr &&
+        tp->tp_dict != NULL && PyUnicode_CheckExact(name)) {
+        descr = _PyType_Lookup(tp, name);
+        /* Functions and method descriptors are not data descriptors, so
+           an instance attribute of the same name takes precedence. */
+        if (descr != NULL && (PyFunction_Check(descr) ||
+                              Py_TYPE(descr) == &PyMethodDescr_Type)) {
+            Py_INCREF(descr);
+            dictptr = _PyObject_GetDictPtr(obj);
+            if (dictptr != NULL && (dict = *dictptr) != NULL) {
+                Py_INCREF(dict);
+                shadowed = PyDict_GetItem(dict, name) != NULL;
+                Py_DECREF(dict);
+            }
+            if (!shadowed) {
+                *method = descr;
+                return 1;
+            }
+            Py_DECREF(descr);
+        }
+    }
+    *method = PyObject_GetAttr(obj, name);
+    return 0;
+}
+
 int
 _PyObject_GenericSetAttrWithDict(PyObject *obj, PyObject *name,
                                  PyObject *value, PyObject *dict)
@@ -1703,6 +1742,14 @@ _Py_ReadyTypes(void)
     if (PyType_Ready(&PyEllipsis_Type) < 0)
         Py_FatalError("Can't initialize ellipsis type");
 
+#ifdef BITPACKED_COMPACT_HEADER
+    /* Statically initialized objects other than types start out as
+       instances of type; see _PyObject_TYPE_INIT. */
+    Py_SET_TYPE(Py_Ellipsis, &PyEllipsis_Type);
+    _PyDict_InitDummy();
+    _PySet_InitDummy();
+#endif
+
     if (PyType_Ready(&PyMemberDescr_Type) < 0)
         Py_FatalError("Can't initialize member descriptor type");
 
@@ -1803,7 +1850,7 @@ _Py_PrintReferences(FILE *fp)
     PyObject *op;
     fprintf(fp, "Remaining objects:\n");
     for (op = refchain._ob_next; op != &refchain; op = op->_ob_next) {
-        fprintf(fp, "%p [%" PY_FORMAT_SIZE_T "d] ", op, Py_REFCNT(op));
+        fprintf(fp, "%p [%" PY_FORMAT_SIZE_T "d] ", op, (Py_ssize_t)Py_REFCNT(op));
         if (PyObject_Print(op, fp, 0) != 0)
             PyErr_Clear();
         putc('\n', fp);
@@ -1820,7 +1867,7 @@ _Py_PrintReferenceAddresses(FILE *fp)
     fprintf(fp, "Remaining object addresses:\n");
     for (op = refchain._ob_next; op != &refchain; op = op->_ob_next)
         fprintf(fp, "%p [%" PY_FORMAT_SIZE_T "d] %s\n", op,
-            Py_REFCNT(op), Py_TYPE(op)->tp_name);
+            (Py_ssize_t)Py_REFCNT(op), Py_TYPE(op)->tp_name);
 }
 
 PyObject *
@@ -2048,34 +2095,214 @@ _Py_Dealloc(PyObject *op)
 
 #ifdef BITPACKED
 #if !BITPACKED_NOREFCNT
-Py_ssize_t bitpacked_refcnt = BITPACKED_DUMMY_REFCNT;
+BITPACKED_REFCNT bitpacked_refcnt = BITPACKED_DUMMY_REFCNT;
 #endif
-struct _typeobject *const bitpacked_types[16] = {
-    /*  *****00* : Pointer to PyObject
+struct _typeobject *bitpacked_types[16] = {
+    /*  ****000* : Pointer to PyObject (BITPACKED_ALIGNMENT aligned)
      *  *****01* : Number Object (float, int or bool)
      *  ****001* : int or subclass (int or bool)
      *  ***0001* : int
      *  ***1001* : bool
      *  ****101* : float(60bit available)
+     *  ***111** : float with wider exponent(60bit available)
      *  *****1** : Other BitPacked Object
+     *  ****100* : Other BitPacked Object (needs 16-byte alignment)
      */
     NULL,                     /* ***0000*|00 : MUST BE NULL */
     &PyLong_Type,             /* ***0001*|02 : 5th-7th bits are common with bool */
     &_PyNone_Type,            /* ***0010*|04 */
     &_PyNotImplemented_Type,  /* ***0011*|06 */
-    NULL,                     /* ***0100*|08 : MUST BE NULL */
+    NULL,                     /* ***0100*|08 : Not-Used */
     &PyFloat_Type,            /* ***0101*|0A : 4th bit is part of data */
     &PyRange_Type,            /* ***0110*|0C */
-    NULL,                     /* ***0111*|0E : Not-Used */
+    &PyRange_Type,            /* ***0111*|0E : range with wider bounds */
     NULL,                     /* ***1000*|10 : MUST BE NULL */
     &PyBool_Type,             /* ***1001*|12 : 5th-7th bits are common with long */
-    NULL,                     /* ***1010*|14 : Not-Used */
-    NULL,                     /* ***1011*|16 : Not-Used */
-    NULL,                     /* ***1100*|18 : MUST BE NULL */
+    NULL,                     /* ***1010*|14 : datetime.date, registered by _datetime */
+    NULL,                     /* ***1011*|16 : datetime.time, registered by _datetime */
+    NULL,                     /* ***1100*|18 : datetime.timedelta, registered by _datetime */
     &PyFloat_Type,            /* ***1101*|1A : 4th bit is part of data */
-    NULL,                     /* ***1110*|1C : Not-Used */
-    NULL                      /* ***1111*|1E : Not-Used */
+    &PyFloat_Type,            /* ***1110*|1C : float with wider exponent */
+    &PyFloat_Type             /* ***1111*|1E : 2nd bit is part of data */
+};
+
+#ifdef BITPACKED_COMPACT_HEADER
+/* Types of heap objects, indexed by ob_typeidx_bitpacked.  Slots 0 and 1
+ * are PyType_Type and NULL, see _PyObject_TYPE_INIT.  Slots 2 to 17 repeat
+ * bitpacked_types for Py_TYPE() of tagged values.  Released slots are
+ * chained through the table as odd values (next << 1 | 1).
+ */
+PyTypeObject *bitpacked_typetable[BITPACKED_TYPETABLE_SIZE] = {
+    &PyType_Type, NULL,
+    NULL, &PyLong_Type, &_PyNone_Type, &_PyNotImplemented_Type,
+    NULL, &PyFloat_Type, &PyRange_Type, &PyRange_Type,
+    NULL, &PyBool_Type, NULL, NULL,
+    NULL, &PyFloat_Type, &PyFloat_Type, &PyFloat_Type
+};
+static unsigned int bitpacked_typetable_used = 18;
+static unsigned int bitpacked_typetable_free = 0;
+
+static const unsigned int bitpacked_tagged_typeidx[16] = {
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17
+};
+#define BITPACKED_OBJSLOT    ((char *)offsetof(PyObject, ob_typeidx_bitpacked))
+#define BITPACKED_TAGSLOT(i) ((char *)&bitpacked_tagged_typeidx[i])
+#else
+#define BITPACKED_OBJSLOT    ((char *)offsetof(PyObject, ob_type_bitpacked))
+#define BITPACKED_TAGSLOT(i) ((char *)&bitpacked_types[i])
+#endif
+
+/* Where Py_TYPE() finds the type for each type id. */
+char *const bitpacked_typeslots[16] = {
+    BITPACKED_OBJSLOT,    BITPACKED_TAGSLOT(1),
+    BITPACKED_TAGSLOT(2), BITPACKED_TAGSLOT(3),
+    BITPACKED_TAGSLOT(4), BITPACKED_TAGSLOT(5),
+    BITPACKED_TAGSLOT(6), BITPACKED_TAGSLOT(7),
+    BITPACKED_OBJSLOT,    BITPACKED_TAGSLOT(9),
+    BITPACKED_TAGSLOT(10), BITPACKED_TAGSLOT(11),
+    BITPACKED_TAGSLOT(12), BITPACKED_TAGSLOT(13),
+    BITPACKED_TAGSLOT(14), BITPACKED_TAGSLOT(15)
+};
+
+int
+_PyBitpacked_RegisterTaggedType(BITPACKED_UWORD typeid, PyTypeObject *tp)
+{
+    unsigned int i = (unsigned int)(typeid >> 1);
+    if((typeid != BITPACKED_TYPEID_DATE && typeid != BITPACKED_TYPEID_TIME &&
+        typeid != BITPACKED_TYPEID_DELTA) ||
+       (bitpacked_types[i] != NULL && bitpacked_types[i] != tp)){
+        PyErr_Format(PyExc_SystemError,
+                     "type id 0x%02x can not be registered for %s",
+                     i << 1, tp->tp_name);
+        return -1;
+    }
+    bitpacked_types[i] = tp;
+#ifdef BITPACKED_COMPACT_HEADER
+    bitpacked_typetable[bitpacked_tagged_typeidx[i]] = tp;
+#endif
+    return 0;
+}
+
+#ifdef BITPACKED_STATS
+Py_ssize_t bitpacked_stat_tagged[16];
+Py_ssize_t bitpacked_stat_fallback[BITPACKED_FALLBACK_NREASONS];
+static bitpacked_stat_site *bitpacked_stat_sites = NULL;
+
+static const char *const bitpacked_stat_typeid_names[16] = {
+    NULL, "LONG", "NONE", "NOTIMPL",
+    "NOTUSED_08", "FLOAT", "RANGE", "RANGE_WIDE",
+    NULL, "BOOL", "DATE", "TIME",
+    "DELTA", "FLOAT_RSV", "FLOAT_WIDE", "FLOAT_WIDE_RSV"
+};
+static const char *const bitpacked_stat_fallback_names[] = {
+    "long_range", "float_nan", "float_exponent", "range_bounds"
 };
+
+void
+_PyBitpacked_RegisterStatSite(bitpacked_stat_site *site)
+{
+    site->registered = 1;
+    site->next = bitpacked_stat_sites;
+    bitpacked_stat_sites = site;
+}
+
+static int
+bitpacked_stat_set(PyObject *dict, const char *key, Py_ssize_t n)
+{
+    PyObject *v = PyLong_FromSsize_t(n);
+    int ret;
+    if(!v) return -1;
+    ret = PyDict_SetItemString(dict, key, v);
+    Py_DECREF(v);
+    return ret;
+}
+
+PyObject *
+_PyBitpacked_GetStats(void)
+{
+    PyObject *tagged = NULL, *fallback = NULL, *rebox = NULL, *res = NULL;
+    bitpacked_stat_site *site;
+    int i;
+
+    if(!(tagged = PyDict_New()) || !(fallback = PyDict_New()) ||
+       !(rebox = PyDict_New()))
+        goto exit;
+    for(i = 0; i < 16; ++i){
+        if(bitpacked_stat_typeid_names[i] &&
+           bitpacked_stat_set(tagged, bitpacked_stat_typeid_names[i],
+                              bitpacked_stat_tagged[i]) < 0)
+            goto exit;
+    }
+    for(i = 0; i < BITPACKED_FALLBACK_NREASONS; ++i){
+        if(bitpacked_stat_set(fallback, bitpacked_stat_fallback_names[i],
+                              bitpacked_stat_fallback[i]) < 0)
+            goto exit;
+    }
+    for(site = bitpacked_stat_sites; site; site = site->next){
+        char key[128];
+        PyObject *prev;
+        Py_ssize_t n = site->count;
+        PyOS_snprintf(key, sizeof(key), "%s:%d", site->func, site->line);
+        /* one macro expanded twice on a line shares a key */
+        if((prev = PyDict_GetItemString(rebox, key)) != NULL)
+            n += PyLong_AsSsize_t(prev);
+        if(bitpacked_stat_set(rebox, key, n) < 0)
+            goto exit;
+    }
+    res = Py_BuildValue("{sOsOsO}", "tagged", tagged,
+                        "fallback", fallback, "rebox", rebox);
+  exit:
+    Py_XDECREF(tagged);
+    Py_XDECREF(fallback);
+    Py_XDECREF(rebox);
+    return res;
+}
+
+void
+_PyBitpacked_ResetStats(void)
+{
+    bitpacked_stat_site *site;
+    memset(bitpacked_stat_tagged, 0, sizeof(bitpacked_stat_tagged));
+    memset(bitpacked_stat_fallback, 0, sizeof(bitpacked_stat_fallback));
+    for(site = bitpacked_stat_sites; site; site = site->next)
+        site->count = 0;
+}
+#endif
+
+#ifdef BITPACKED_COMPACT_HEADER
+
+unsigned int
+_PyBitpacked_RegisterType(PyTypeObject *tp)
+{
+    unsigned int idx = 0;
+    assert(tp != NULL);
+    if(tp == &PyType_Type) return 0;
+    if(tp->tp_bitpacked_index) return tp->tp_bitpacked_index;
+    if(bitpacked_typetable_free){
+        idx = bitpacked_typetable_free;
+        bitpacked_typetable_free =
+            (unsigned int)((BITPACKED_UWORD)bitpacked_typetable[idx] >> 1);
+    }else if(bitpacked_typetable_used < BITPACKED_TYPETABLE_SIZE){
+        idx = bitpacked_typetable_used++;
+    }else{
+        Py_FatalError("too many types for compact object headers");
+    }
+    bitpacked_typetable[idx] = tp;
+    tp->tp_bitpacked_index = idx;
+    return idx;
+}
+
+void
+_PyBitpacked_UnregisterType(PyTypeObject *tp)
+{
+    unsigned int idx = tp->tp_bitpacked_index;
+    if(!idx) return;
+    bitpacked_typetable[idx] =
+        (PyTypeObject*)(((BITPACKED_UWORD)bitpacked_typetable_free << 1) | 1);
+    bitpacked_typetable_free = idx;
+    tp->tp_bitpacked_index = 0;
+}
+#endif
 #endif
 
 #ifdef __cplusplus
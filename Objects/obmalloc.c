@@ -377,18 +377,30 @@ _PyMem_Strdup(const char *str)
     return copy;
 }
 
+#ifdef BITPACKED
+/* The low bits of an object pointer are tag bits.  pymalloc blocks are
+   aligned by construction (see ALIGNMENT below); this catches malloc()
+   for large blocks, and allocators installed with PyMem_SetAllocator(),
+   before a misaligned object is mistaken for a tagged value. */
+static void *
+bitpacked_check_aligned(void *p)
+{
+    if ((BITPACKED_UWORD)p & (BITPACKED_ALIGNMENT - 1))
+        Py_FatalError("object allocator returned a block that is not "
+                      "16-byte aligned");
+    return p;
+}
+#else
+#define bitpacked_check_aligned(p) (p)
+#endif
+
 void *
 PyObject_Malloc(size_t size)
 {
     /* see PyMem_RawMalloc() */
-    void *result;
     if (size > (size_t)PY_SSIZE_T_MAX)
         return NULL;
-    result = _PyObject.malloc(_PyObject.ctx, size);
-#ifdef BITPACKED
-    assert(!BITPACKED_CHECK(result)); //FIXME
-#endif
-    return result;
+    return bitpacked_check_aligned(_PyObject.malloc(_PyObject.ctx, size));
 }
 
 void *
@@ -397,7 +409,8 @@ PyObject_Calloc(size_t nelem, size_t elsize)
     /* see PyMem_RawMalloc() */
     if (elsize != 0 && nelem > (size_t)PY_SSIZE_T_MAX / elsize)
         return NULL;
-    return _PyObject.calloc(_PyObject.ctx, nelem, elsize);
+    return bitpacked_check_aligned(
+        _PyObject.calloc(_PyObject.ctx, nelem, elsize));
 }
 
 void *
@@ -406,7 +419,8 @@ PyObject_Realloc(void *ptr, size_t new_size)
     /* see PyMem_RawMalloc() */
     if (new_size > (size_t)PY_SSIZE_T_MAX)
         return NULL;
-    return _PyObject.realloc(_PyObject.ctx, ptr, new_size);
+    return bitpacked_check_aligned(
+        _PyObject.realloc(_PyObject.ctx, ptr, new_size));
 }
 
 void
@@ -538,15 +552,25 @@ static int running_on_valgrind = -1;
  */
 
 /*
- * Alignment of addresses returned to the user. 8-bytes alignment works
- * on most current architectures (with 32-bit or 64-bit address busses).
+ * Alignment of addresses returned to the user.  On 64-bit platforms this
+ * has to be 16 bytes: structures holding a long double (e.g. ctypes'
+ * CDataObject) may be accessed with 16-byte aligned stores.
  * The alignment value is also used for grouping small requests in size
  * classes spaced ALIGNMENT bytes apart.
  *
  * You shouldn't change this unless you know what you are doing.
  */
+#if SIZEOF_VOID_P > 4
+#define ALIGNMENT              16               /* must be 2^N */
+#define ALIGNMENT_SHIFT         4
+#else
 #define ALIGNMENT               8               /* must be 2^N */
 #define ALIGNMENT_SHIFT         3
+#endif
+
+#if defined(BITPACKED) && ALIGNMENT < BITPACKED_ALIGNMENT
+#error "pymalloc blocks must be BITPACKED_ALIGNMENT aligned"
+#endif
 
 /* Return the number of bytes in size class I, as a uint. */
 #define INDEX2SIZE(I) (((uint)(I) + 1) << ALIGNMENT_SHIFT)
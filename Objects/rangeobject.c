@@ -10,35 +10,13 @@
    would presumably help perf.
 */
 
-typedef struct {
+typedef struct _rangeobject {
     PyObject_HEAD
     PyObject *start;
     PyObject *stop;
     PyObject *step;
     PyObject *length;
 } rangeobject;
-#ifdef BITPACKED
-typedef union{
-    struct{
-#if PY_LITTLE_ENDIAN
-        char reserved;
-        signed char step;
-        short start;
-        short stop;
-        unsigned short length;
-#else
-        short start;
-        short stop;
-        unsigned short length;
-        signed char step;
-        char reserved;
-#endif
-    };
-    BITPACKED_UWORD uword;
-    PyObject* pyobj;
-    rangeobject* rangeobj;
-} bitpacked_rangeobject;
-#endif
 
 /* Helper function for validating step.  Always returns a new reference or
    NULL on error.
@@ -67,6 +45,96 @@ validate_step(PyObject *step)
     return step;
 }
 
+#ifdef BITPACKED
+/* Ranges whose bounds do not fit in a bitpacked_rangeobject are packed
+ * with BITPACKED_TYPEID_RANGE_WIDE when stop fits in 32 bits, start in 22
+ * bits and step is a power of two up to 2**15 (either sign):
+ *
+ *   bits 32-63: stop, bits 10-31: start, bits 6-9: log2(abs(step)),
+ *   bit 5: set if step < 0, bits 0-4: Type-ID
+ */
+#define BP_WIDE_START_MIN   (-(1L << 21))
+#define BP_WIDE_START_MAX   ((1L << 21) - 1)
+#define BP_WIDE_SHIFT_MAX   15
+#define BP_WIDE_NEGSTEP     0x20ULL
+
+/* Return a bitpacked range, or NULL (with no exception set) when the values
+   fit neither encoding.  step must not be zero. */
+static PyObject *
+bitpacked_range_pack(long start, long stop, long step)
+{
+    bitpacked_static_assert(sizeof(BITPACKED_UWORD) == sizeof(bitpacked_rangeobject));
+    if(SHRT_MIN <= start && start <= SHRT_MAX &&
+       SHRT_MIN <= stop && stop <= SHRT_MAX &&
+       SCHAR_MIN <= step && step <= SCHAR_MAX){
+        bitpacked_rangeobject w;
+        long lo = start, hi = stop, n_step = step;
+        w.uword = BITPACKED_TYPEID_RANGE;
+        w.start = start;
+        w.stop = stop;
+        w.step = step;
+        if(n_step < 0){
+            lo = stop;
+            hi = start;
+            n_step = -n_step;
+        }
+        w.length = lo >= hi ? 0 : (((hi - lo) - 1) / n_step) + 1;
+        BITPACKED_STAT_TAGGED(BITPACKED_TYPEID_RANGE);
+        Py_INCREF(w.pyobj);
+        return w.pyobj;
+    }
+    if(BP_WIDE_START_MIN <= start && start <= BP_WIDE_START_MAX &&
+       INT_MIN <= stop && stop <= INT_MAX &&
+       -(1L << BP_WIDE_SHIFT_MAX) <= step && step <= (1L << BP_WIDE_SHIFT_MAX)){
+        unsigned long abs_step = step < 0 ? -step : step;
+        BITPACKED_UWORD shift = 0;
+        PyObject *ret;
+        if(abs_step & (abs_step - 1)) return NULL;
+        while((1UL << shift) != abs_step) shift++;
+        ret = (PyObject*)(((BITPACKED_UWORD)(unsigned int)stop << 32)
+                          | (((BITPACKED_UWORD)start & 0x3FFFFFULL) << 10)
+                          | (shift << 6)
+                          | (step < 0 ? BP_WIDE_NEGSTEP : 0)
+                          | BITPACKED_TYPEID_RANGE_WIDE);
+        BITPACKED_STAT_TAGGED(BITPACKED_TYPEID_RANGE_WIDE);
+        Py_INCREF(ret);
+        return ret;
+    }
+    return NULL;
+}
+
+/* Unpack either encoding of a bitpacked range; returns its length. */
+static long
+bitpacked_range_unpack(rangeobject *r, long *start, long *stop, long *step)
+{
+    BITPACKED_UWORD x = (BITPACKED_UWORD)r;
+    int shift;
+    long lo, hi;
+    if(BITPACKED_TYPEID(x) == BITPACKED_TYPEID_RANGE){
+        bitpacked_rangeobject w;
+        w.uword = x;
+        *start = w.start;
+        *stop = w.stop;
+        *step = w.step;
+        return w.length;
+    }
+    assert(BITPACKED_TYPEID(x) == BITPACKED_TYPEID_RANGE_WIDE);
+    shift = (int)((x >> 6) & 0xF);
+    *stop = (long)((BITPACKED_SWORD)x >> 32);
+    *start = (long)((BITPACKED_SWORD)(x << 32) >> 42);
+    if(x & BP_WIDE_NEGSTEP){
+        *step = -(1L << shift);
+        lo = *stop;
+        hi = *start;
+    }else{
+        *step = 1L << shift;
+        lo = *start;
+        hi = *stop;
+    }
+    return lo >= hi ? 0 : (((hi - lo) - 1) >> shift) + 1;
+}
+#endif
+
 static PyObject *
 compute_range_length(PyObject *start, PyObject *stop, PyObject *step);
 
@@ -77,42 +145,33 @@ make_range_object(PyTypeObject *type, PyObject *start,
     rangeobject *obj = NULL;
     PyObject *length;
 #ifdef BITPACKED
-    bitpacked_static_assert(sizeof(BITPACKED_UWORD) == sizeof(bitpacked_rangeobject));
     if(type == &PyRange_Type) do{
         int overflow;
         long n_start, n_stop, n_step;
-        bitpacked_rangeobject w_ret;
+        PyObject *ret;
         n_start = PyLong_AsLongAndOverflow(start,  &overflow);
         if(n_start == -1 && PyErr_Occurred()) return NULL;
-        if(overflow || n_start < SHRT_MIN || SHRT_MAX < n_start) break;
+        if(overflow) break;
         n_stop = PyLong_AsLongAndOverflow(stop,  &overflow);
         if(n_stop == -1 && PyErr_Occurred()) return NULL;
-        if(overflow || n_stop < SHRT_MIN || SHRT_MAX < n_stop) break;
+        if(overflow) break;
         n_step = PyLong_AsLongAndOverflow(step,  &overflow);
         if(n_step == -1 && PyErr_Occurred()) return NULL;
-        if(overflow || n_step < SCHAR_MIN || SCHAR_MAX < n_step) break;
-        Py_DECREF(start);
-        Py_DECREF(stop);
-        Py_DECREF(step);
+        if(overflow) break;
         if(n_step == 0) {
             PyErr_SetString(PyExc_ValueError,
                             "range() arg 3 must not be zero");
             return NULL;
         }
-        w_ret.uword = BITPACKED_TYPEID_RANGE;
-        w_ret.start = n_start;
-        w_ret.stop = n_stop;
-        w_ret.step = n_step;
-        if(n_step < 0){
-            long temp = n_start;
-            n_start = n_stop;
-            n_stop = temp;
-            n_step = -n_step;
-        }
-        w_ret.length = n_start >= n_stop ? 0 :  (((n_stop - n_start) - 1) / n_step) + 1;
-        Py_INCREF(w_ret.pyobj);
-        return w_ret.rangeobj;
+        ret = bitpacked_range_pack(n_start, n_stop, n_step);
+        if(ret == NULL) break;
+        Py_DECREF(start);
+        Py_DECREF(stop);
+        Py_DECREF(step);
+        return (rangeobject*)ret;
     }while(0);
+    if(type == &PyRange_Type)
+        BITPACKED_STAT_FALLBACK(RANGE_BOUNDS);
 #endif
     length = compute_range_length(start, stop, step);
     if (length == NULL) {
@@ -298,7 +357,8 @@ range_length(rangeobject *r)
 {
 #ifdef BITPACKED
     if(BITPACKED_CHECK(r)){
-        return ((bitpacked_rangeobject*)(&r))->length;
+        long start, stop, step;
+        return bitpacked_range_unpack(r, &start, &stop, &step);
     }
 #endif
     return PyLong_AsSsize_t(r->length);
@@ -401,14 +461,15 @@ range_item(rangeobject *r, Py_ssize_t i)
     PyObject *res, *arg;
 #ifdef BITPACKED
     if(BITPACKED_CHECK(r)){
-        bitpacked_rangeobject *w = (bitpacked_rangeobject*)(&r);
-        if(i<0) i += w->length;
-        if(i < 0 || w->length <= i) {
+        long start, stop, step, length;
+        length = bitpacked_range_unpack(r, &start, &stop, &step);
+        if(i<0) i += length;
+        if(i < 0 || length <= i) {
             PyErr_SetString(PyExc_IndexError,
                             "range object index out of range");
             return NULL;
         }
-        return PyLong_FromLong(w->start + w->step * i);
+        return PyLong_FromLong(start + step * i);
     }
 #endif
     arg = PyLong_FromSsize_t(i);
@@ -431,36 +492,38 @@ compute_slice(rangeobject *r, PyObject *_slice)
 
 #ifdef BITPACKED
     if(BITPACKED_CHECK(r)){
-        bitpacked_rangeobject w;
+        long r_start, r_stop, r_step;
         Py_ssize_t n_start, n_stop, n_step, n_length;
-        w.rangeobj = r;
-        error = PySlice_GetIndicesEx(_slice, w.length, &n_start, &n_stop, &n_step, &n_length);
+        PyObject *packed;
+        n_length = bitpacked_range_unpack(r, &r_start, &r_stop, &r_step);
+        error = PySlice_GetIndicesEx(_slice, n_length, &n_start, &n_stop, &n_step, &n_length);
         if (error == -1) return NULL;
-        n_start = w.start + (n_start * w.step);
-        n_stop = w.start + (n_stop * w.step);
-        n_step = w.step * n_step;
-        if((n_start < n_stop) != (n_step > 0)) n_stop = n_start;
-        if(SCHAR_MIN <= n_step && n_step <= SCHAR_MAX) {
-            w.start = n_start;
-            w.stop = n_stop;
-            w.step = n_step;
-            w.length = n_length;
-            Py_INCREF(w.pyobj);
-            return w.pyobj;
+        n_start = r_start + (n_start * r_step);
+        n_stop = r_start + (n_stop * r_step);
+        if((n_start < n_stop) != ((n_step > 0) == (r_step > 0))) n_stop = n_start;
+        /* r_step is at most 2**15, so this product cannot overflow */
+        if(-(1L << 40) < n_step && n_step < (1L << 40)) {
+            n_step = r_step * n_step;
+            packed = bitpacked_range_pack(n_start, n_stop, n_step);
+            if(packed != NULL) return packed;
+            BITPACKED_STAT_FALLBACK(RANGE_BOUNDS);
+            substep = PyLong_FromSsize_t(n_step);
         }else{
-            PyObject *args = Py_BuildValue("nnn", n_start, n_stop, n_step);
-            if(!args){
-                return NULL;
-            }
-            result = make_range_object(Py_TYPE(r), PyTuple_GET_ITEM(args, 0), PyTuple_GET_ITEM(args, 1), PyTuple_GET_ITEM(args, 2));
-            if(result != NULL){
-                PyTuple_SET_ITEM(args, 0, NULL);
-                PyTuple_SET_ITEM(args, 1, NULL);
-                PyTuple_SET_ITEM(args, 2, NULL);
-            }
-            Py_DECREF(args);
-            return (PyObject*)result;
+            BITPACKED_STAT_FALLBACK(RANGE_BOUNDS);
+            start = PyLong_FromLong(r_step);
+            if (start == NULL) goto fail;
+            step = PyLong_FromSsize_t(n_step);
+            if (step == NULL) goto fail;
+            substep = PyNumber_Multiply(start, step);
+            Py_CLEAR(start);
+            Py_CLEAR(step);
         }
+        if (substep == NULL) goto fail;
+        substart = PyLong_FromSsize_t(n_start);
+        if (substart == NULL) goto fail;
+        substop = PyLong_FromSsize_t(n_stop);
+        if (substop == NULL) goto fail;
+        goto make_result;
     }
 #endif
     error = _PySlice_GetLongIndices(slice, r->length, &start, &stop, &step);
@@ -479,6 +542,9 @@ compute_slice(rangeobject *r, PyObject *_slice)
     if (substop == NULL) goto fail;
     Py_CLEAR(stop);
 
+#ifdef BITPACKED
+  make_result:
+#endif
     result = make_range_object(Py_TYPE(r), substart, substop, substep);
     if (result != NULL) {
         return (PyObject *) result;
@@ -505,17 +571,18 @@ range_contains_long(rangeobject *r, PyObject *ob)
 
 #ifdef BITPACKED
     if(BITPACKED_CHECK(r)){
-        bitpacked_rangeobject *w = (bitpacked_rangeobject*)(&r);
+        long start, stop, step;
         int overflow;
         long n = PyLong_AsLongAndOverflow(ob, &overflow);
         if(n == -1 && PyErr_Occurred()) return -1;
         if(overflow) return 0;
-        if(w->step > 0){
-            if(!(w->start <= n && n < w->stop)) return 0;
+        bitpacked_range_unpack(r, &start, &stop, &step);
+        if(step > 0){
+            if(!(start <= n && n < stop)) return 0;
         }else{
-            if(!(w->stop < n && n <= w->start)) return 0;
+            if(!(stop < n && n <= start)) return 0;
         }
-        return (n - w->start) % w->step == 0 ? 1 : 0;
+        return (n - start) % step == 0 ? 1 : 0;
     }
 #endif
     zero = PyLong_FromLong(0);
@@ -594,13 +661,11 @@ range_equals(rangeobject *r0, rangeobject *r1)
         return 1;
 #ifdef BITPACKED
     if(BITPACKED_CHECK(r0)) {
-        bitpacked_rangeobject *w0 = (bitpacked_rangeobject*)(&r0);
-        long n_length, n_start, n_step;
+        long w_length, w_start, w_stop, w_step;
+        long n_length, n_start, n_stop, n_step;
+        w_length = bitpacked_range_unpack(r0, &w_start, &w_stop, &w_step);
         if(BITPACKED_CHECK(r1)){
-            bitpacked_rangeobject *w1 = (bitpacked_rangeobject*)(&r1);
-            n_length = w1->length;
-            n_start = w1->start;
-            n_step = w1->step;
+            n_length = bitpacked_range_unpack(r1, &n_start, &n_stop, &n_step);
         }else{
             int overflow;
             n_length = PyLong_AsLongAndOverflow(r1->length, &overflow);
@@ -613,11 +678,11 @@ range_equals(rangeobject *r0, rangeobject *r1)
             if(n_step == -1 && PyErr_Occurred()) return -1;
             if(overflow) n_step = LONG_MAX;
         }
-        if(w0->length != n_length) return 0;
-        if(w0->length == 0) return 1;
-        if(w0->start != n_start) return 0;
-        if(w0->length == 1) return 1;
-        return w0->step == n_step ? 1 : 0;
+        if(w_length != n_length) return 0;
+        if(w_length == 0) return 1;
+        if(w_start != n_start) return 0;
+        if(w_length == 1) return 1;
+        return w_step == n_step ? 1 : 0;
     }else if(BITPACKED_CHECK(r1)){
         return range_equals(r1, r0);
     }
@@ -692,14 +757,15 @@ range_hash(rangeobject *r)
 
 #ifdef BITPACKED
     if(BITPACKED_CHECK(r)){
-        bitpacked_rangeobject *w = (bitpacked_rangeobject*)(&r);
+        long start, stop, step, length;
+        length = bitpacked_range_unpack(r, &start, &stop, &step);
         t = NULL;
-        if(w->length == 0){
+        if(length == 0){
             t = Py_BuildValue("iss", 0, NULL, NULL);
-        }else if(w->length == 1){
-            t = Py_BuildValue("ihs", 1, w->start, NULL);
+        }else if(length == 1){
+            t = Py_BuildValue("ils", 1, start, NULL);
         }else{
-            t = Py_BuildValue("Hhb", w->length, w->start, w->step);
+            t = Py_BuildValue("lll", length, start, step);
         }
         if (!t) return -1;
         result = PyObject_Hash(t);
@@ -788,10 +854,11 @@ range_index(rangeobject *r, PyObject *ob)
         PyObject *idx, *tmp;
 #ifdef BITPACKED
         if(BITPACKED_CHECK(r)){
-            bitpacked_rangeobject *w = (bitpacked_rangeobject*)(&r);
+            long start, stop, step;
             long n = PyLong_AsLong(ob);
             if(n == -1 && PyErr_Occurred()) return NULL;
-            return PyLong_FromLong((n - w->start) / w->step);
+            bitpacked_range_unpack(r, &start, &stop, &step);
+            return PyLong_FromLong((n - start) / step);
         }
 #endif
         tmp = PyNumber_Subtract(ob, r->start);
@@ -826,11 +893,12 @@ range_repr(rangeobject *r)
 
 #ifdef BITPACKED
     if(BITPACKED_CHECK(r)){
-        bitpacked_rangeobject *w = (bitpacked_rangeobject*)(&r);
-        if(w->step == 1){
-            return PyUnicode_FromFormat("range(%d, %d)", w->start, w->stop);
+        long start, stop, step;
+        bitpacked_range_unpack(r, &start, &stop, &step);
+        if(step == 1){
+            return PyUnicode_FromFormat("range(%ld, %ld)", start, stop);
         }else{
-            return PyUnicode_FromFormat("range(%d, %d, %d)", w->start, w->stop, w->step);
+            return PyUnicode_FromFormat("range(%ld, %ld, %ld)", start, stop, step);
         }
     }
 #endif
@@ -855,9 +923,10 @@ range_reduce(rangeobject *r, PyObject *args)
 {
 #ifdef BITPACKED
     if(BITPACKED_CHECK(r)){
-        bitpacked_rangeobject *w = (bitpacked_rangeobject*)(&r);
-        return Py_BuildValue("(O(hhb))",Py_TYPE(r),
-                         w->start, w->stop, w->step);
+        long start, stop, step;
+        bitpacked_range_unpack(r, &start, &stop, &step);
+        return Py_BuildValue("(O(lll))",Py_TYPE(r),
+                         start, stop, step);
     }
 #endif
     return Py_BuildValue("(O(OOO))", Py_TYPE(r),
@@ -924,11 +993,12 @@ static PyObject*
 bitpacked_range_getset(rangeobject *r, int *closure) {
     PyObject *result = NULL;
     if(BITPACKED_CHECK(r)){
-        bitpacked_rangeobject *w = (bitpacked_rangeobject*)(&r);
+        long start, stop, step;
+        bitpacked_range_unpack(r, &start, &stop, &step);
         switch(*closure) {
-        case _GETSET_START: return PyLong_FromLong(w->start);
-        case _GETSET_STOP: return PyLong_FromLong(w->stop);
-        case _GETSET_STEP: return PyLong_FromLong(w->step);
+        case _GETSET_START: return PyLong_FromLong(start);
+        case _GETSET_STOP: return PyLong_FromLong(stop);
+        case _GETSET_STEP: return PyLong_FromLong(step);
         default: abort();
         }
     }else{
@@ -1377,8 +1447,8 @@ range_iter(PyObject *seq)
 
 #ifdef BITPACKED
     if(BITPACKED_CHECK(r)){
-        bitpacked_rangeobject *w = (bitpacked_rangeobject*)(&r);
-        return fast_range_iter(w->start, w->stop, w->step);
+        bitpacked_range_unpack(r, &lstart, &lstop, &lstep);
+        return fast_range_iter(lstart, lstop, lstep);
     }
 #endif
     /* If all three fields and the length convert to long, use the int
@@ -1441,10 +1511,10 @@ range_reverse(PyObject *seq)
     assert(PyRange_Check(seq));
 #ifdef BITPACKED
     if(BITPACKED_CHECK(range)){
-        bitpacked_rangeobject *w = (bitpacked_rangeobject*)(&range);
-        new_stop = w->start - w->step;
-        new_start = new_stop + w->length * w->step;
-        return fast_range_iter(new_start, new_stop, -w->step);
+        long length = bitpacked_range_unpack(range, &lstart, &lstop, &lstep);
+        new_stop = lstart - lstep;
+        new_start = new_stop + length * lstep;
+        return fast_range_iter(new_start, new_stop, -lstep);
     }
 #endif
 
@@ -45,6 +45,11 @@ static PyObject _dummy_struct;
 /* This must be >= 1 */
 #define PERTURB_SHIFT 5
 
+#ifdef BITPACKED
+static setentry *set_lookkey_bitpacked(PySetObject *so, PyObject *key,
+                                       Py_hash_t hash);
+#endif
+
 static setentry *
 set_lookkey(PySetObject *so, PyObject *key, Py_hash_t hash)
 {
@@ -57,6 +62,10 @@ set_lookkey(PySetObject *so, PyObject *key, Py_hash_t hash)
     size_t j;
     int cmp;
 
+#ifdef BITPACKED
+    if (BITPACKED_LONG_CHECKEXACT(key))
+        return set_lookkey_bitpacked(so, key, hash);
+#endif
     entry = &table[i];
     if (entry->key == NULL)
         return entry;
@@ -127,6 +136,92 @@ set_lookkey(PySetObject *so, PyObject *key, Py_hash_t hash)
     return freeslot == NULL ? entry : freeslot;
 }
 
+#ifdef BITPACKED
+/*
+Variant of set_lookkey() for bitpacked int keys.  Two bitpacked ints are
+equal only when they are the same word, so an entry holding another
+bitpacked int is skipped without calling back into Python.  Conventional
+keys with the same hash (1.0, True, int subclasses, ...) still go through
+PyObject_RichCompareBool().
+*/
+static setentry *
+set_lookkey_bitpacked(PySetObject *so, PyObject *key, Py_hash_t hash)
+{
+    setentry *table = so->table;
+    setentry *freeslot = NULL;
+    setentry *entry;
+    size_t perturb = hash;
+    size_t mask = so->mask;
+    size_t i = (size_t)hash & mask;
+    size_t j;
+    int cmp;
+
+    entry = &table[i];
+    if (entry->key == NULL)
+        return entry;
+
+    while (1) {
+        if (entry->hash == hash) {
+            PyObject *startkey = entry->key;
+            assert(startkey != dummy);
+            if (startkey == key)
+                return entry;
+            if (!BITPACKED_LONG_CHECKEXACT(startkey)) {
+                Py_INCREF(startkey);
+                cmp = PyObject_RichCompareBool(startkey, key, Py_EQ);
+                Py_DECREF(startkey);
+                if (cmp < 0)
+                    return NULL;
+                if (table != so->table || entry->key != startkey)
+                    return set_lookkey(so, key, hash);
+                if (cmp > 0)
+                    return entry;
+                mask = so->mask;
+            }
+        }
+        if (entry->hash == -1 && freeslot == NULL)
+            freeslot = entry;
+
+        if (i + LINEAR_PROBES <= mask) {
+            for (j = 0 ; j < LINEAR_PROBES ; j++) {
+                entry++;
+                if (entry->key == NULL)
+                    goto found_null;
+                if (entry->hash == hash) {
+                    PyObject *startkey = entry->key;
+                    assert(startkey != dummy);
+                    if (startkey == key)
+                        return entry;
+                    if (!BITPACKED_LONG_CHECKEXACT(startkey)) {
+                        Py_INCREF(startkey);
+                        cmp = PyObject_RichCompareBool(startkey, key, Py_EQ);
+                        Py_DECREF(startkey);
+                        if (cmp < 0)
+                            return NULL;
+                        if (table != so->table || entry->key != startkey)
+                            return set_lookkey(so, key, hash);
+                        if (cmp > 0)
+                            return entry;
+                        mask = so->mask;
+                    }
+                }
+                if (entry->hash == -1 && freeslot == NULL)
+                    freeslot = entry;
+            }
+        }
+
+        perturb >>= PERTURB_SHIFT;
+        i = (i * 5 + 1 + perturb) & mask;
+
+        entry = &table[i];
+        if (entry->key == NULL)
+            goto found_null;
+    }
+  found_null:
+    return freeslot == NULL ? entry : freeslot;
+}
+#endif
+
 /*
 Internal routine used by set_table_resize() to insert an item which is
 known to be absent from the set.  This routine also assumes that
@@ -2494,8 +2589,16 @@ static PyTypeObject _PySetDummy_Type = {
     Py_TPFLAGS_DEFAULT, /*tp_flags */
 };
 
-static PyObject _dummy_struct = {
+static PyObject _dummy_struct BITPACKED_ALIGNED = {
   _PyObject_EXTRA_INIT
-  2, &_PySetDummy_Type
+  2, _PyObject_TYPE_INIT(&_PySetDummy_Type)
 };
 
+#ifdef BITPACKED_COMPACT_HEADER
+void
+_PySet_InitDummy(void)
+{
+    Py_SET_TYPE(&_dummy_struct, &_PySetDummy_Type);
+}
+#endif
+
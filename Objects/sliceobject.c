@@ -85,9 +85,9 @@ PyTypeObject PyEllipsis_Type = {
     ellipsis_new,                       /* tp_new */
 };
 
-PyObject _Py_EllipsisObject = {
+PyObject _Py_EllipsisObject BITPACKED_ALIGNED = {
     _PyObject_EXTRA_INIT
-    1, &PyEllipsis_Type
+    1, _PyObject_TYPE_INIT(&PyEllipsis_Type)
 };
 
 
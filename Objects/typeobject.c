@@ -3029,6 +3029,9 @@ type_dealloc(PyTypeObject *type)
     remove_all_subclasses(type, type->tp_bases);
     PyErr_Restore(tp, val, tb);
     PyObject_ClearWeakRefs((PyObject *)type);
+#ifdef BITPACKED_COMPACT_HEADER
+    _PyBitpacked_UnregisterType(type);
+#endif
     et = (PyHeapTypeObject *)type;
     Py_XDECREF(type->tp_base);
     Py_XDECREF(type->tp_dict);
@@ -3716,7 +3719,7 @@ object_set_class(PyObject *self, PyObject *value, void *closure)
     if (compatible_for_assignment(oldto, newto, "__class__")) {
         if (newto->tp_flags & Py_TPFLAGS_HEAPTYPE)
             Py_INCREF(newto);
-        Py_TYPE(self) = newto;
+        Py_SET_TYPE(self, newto);
         if (oldto->tp_flags & Py_TPFLAGS_HEAPTYPE)
             Py_DECREF(oldto);
         return 0;
@@ -4800,6 +4803,15 @@ PyType_Ready(PyTypeObject *type)
     }
     assert((type->tp_flags & Py_TPFLAGS_READYING) == 0);
 
+#ifdef BITPACKED
+    /* a misaligned static type would be taken for a tagged value */
+    if ((BITPACKED_UWORD)type & (BITPACKED_ALIGNMENT - 1)) {
+        PyErr_Format(PyExc_SystemError,
+                     "type '%s' is not 16-byte aligned", type->tp_name);
+        return -1;
+    }
+#endif
+
     type->tp_flags |= Py_TPFLAGS_READYING;
 
 #ifdef Py_TRACE_REFS
@@ -4835,8 +4847,15 @@ PyType_Ready(PyTypeObject *type)
        NULL when type is &PyBaseObject_Type, and we know its ob_type is
        not NULL (it's initialized to &PyType_Type).      But coverity doesn't
        know that. */
+#ifdef BITPACKED_COMPACT_HEADER
+    /* A compact header cannot hold NULL: statically initialized types all
+       start with the placeholder index 0, so treat it as "unset" here. */
+    if (((PyObject *)type)->ob_typeidx_bitpacked == 0 &&
+        !(type->tp_flags & Py_TPFLAGS_HEAPTYPE) && base != NULL)
+#else
     if (Py_TYPE(type) == NULL && base != NULL)
-        Py_TYPE(type) = Py_TYPE(base);
+#endif
+        Py_SET_TYPE(type, Py_TYPE(base));
 
     /* Initialize tp_bases */
     bases = type->tp_bases;
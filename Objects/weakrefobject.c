@@ -820,9 +820,9 @@ PyWeakref_NewProxy(PyObject *ob, PyObject *callback)
             PyWeakReference *prev;
 
             if (PyCallable_Check(ob))
-                Py_TYPE(result) = &_PyWeakref_CallableProxyType;
+                Py_SET_TYPE(result, &_PyWeakref_CallableProxyType);
             else
-                Py_TYPE(result) = &_PyWeakref_ProxyType;
+                Py_SET_TYPE(result, &_PyWeakref_ProxyType);
             get_basic_refs(*list, &ref, &proxy);
             if (callback == NULL) {
                 if (proxy != NULL) {
@@ -1081,7 +1081,7 @@ static PYC_MAGIC magic_values[] = {
     { 3160, 3180, L"3.2" },
     { 3190, 3230, L"3.3" },
     { 3250, 3310, L"3.4" },
-    { 3320, 3350, L"3.5" },
+    { 3320, 3352, L"3.5" },
     { 3360, 3361, L"3.6" },
     { 0 }
 };
@@ -248,6 +248,92 @@ builtin_abs(PyModuleDef *module, PyObject *x)
     return PyNumber_Absolute(x);
 }
 
+#ifdef BITPACKED
+/* Kernels for sum(), min(), max(), any() and all() over the item array of
+ * an exact list or tuple.  They look at the tagged items only, so they
+ * neither run Python code nor fail; the builtins carry on with the generic
+ * loop from the first item a kernel cannot handle.  Loops over
+ * BITPACKED_KERNEL_BLOCK items at a time have no branches and no carried
+ * dependencies, so the compiler can vectorize them.
+ */
+#define BITPACKED_KERNEL_BLOCK 8
+
+/* Advance a new list or tuple iterator past the n items a kernel took. */
+static int
+bitpacked_iter_skip(PyObject *it, Py_ssize_t n)
+{
+    _Py_IDENTIFIER(__setstate__);
+    PyObject *res;
+
+    if (n == 0)
+        return 0;
+    res = _PyObject_CallMethodId(it, &PyId___setstate__, "n", n);
+    if (res == NULL)
+        return -1;
+    Py_DECREF(res);
+    return 0;
+}
+
+/* Tagged ints, bools, None, NotImplemented and floats have a truth value
+ * that can be read from the word: they are false for 0, False, None, 0.0
+ * and -0.0 only.
+ */
+static const unsigned char bitpacked_truth_known[32] = {
+    /* by BITPACKED_TYPEID(): 0x02 int, 0x04 None, 0x06 NotImplemented,
+       0x12 bool, 0x0A, 0x1A, 0x1C and 0x1E float */
+    0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0
+};
+#define BITPACKED_TRUTH_KNOWN(w) bitpacked_truth_known[(w) & 0x1e]
+#define BITPACKED_TRUTH(w)                                              \
+    (((w) != BITPACKED_TYPEID_LONG) & ((w) != BITPACKED_TYPEID_BOOL) &   \
+     ((w) != BITPACKED_TYPEID_NONE) & ((w) << 1 != BITPACKED_TYPEID_FLOAT << 1))
+
+/* Index of the first of items[0:n] whose truth is stop, or which has no
+ * truth value in the word; n if there is none.
+ */
+static Py_ssize_t
+bitpacked_scan_truth(PyObject **items, Py_ssize_t n, int stop)
+{
+    Py_ssize_t i = 0, j;
+
+    for (; i + BITPACKED_KERNEL_BLOCK <= n; i += BITPACKED_KERNEL_BLOCK) {
+        int hit = 0;
+        for (j = 0; j < BITPACKED_KERNEL_BLOCK; j++) {
+            BITPACKED_UWORD w = (BITPACKED_UWORD)items[i + j];
+            hit |= !BITPACKED_TRUTH_KNOWN(w) | (BITPACKED_TRUTH(w) == stop);
+        }
+        if (hit)
+            break;
+    }
+    for (; i < n; i++) {
+        BITPACKED_UWORD w = (BITPACKED_UWORD)items[i];
+        if (!BITPACKED_TRUTH_KNOWN(w) || BITPACKED_TRUTH(w) == stop)
+            break;
+    }
+    return i;
+}
+
+/* any() and all() of an exact list or tuple: return 0 or 1 if the tagged
+ * items decide it, else -1 with *pos set to where the generic loop has to
+ * start.
+ */
+static int
+bitpacked_any_all(PyObject *seq, int stop, Py_ssize_t *pos)
+{
+    Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+    PyObject **items = PySequence_Fast_ITEMS(seq);
+    Py_ssize_t i = bitpacked_scan_truth(items, n, stop);
+
+    if (i == n)
+        return !stop;
+    if (BITPACKED_TRUTH_KNOWN((BITPACKED_UWORD)items[i]))
+        return stop;
+    *pos = i;
+    return -1;
+}
+#endif
+
 /*[clinic input]
 all as builtin_all
 
@@ -266,10 +352,25 @@ builtin_all(PyModuleDef *module, PyObject *iterable)
     PyObject *it, *item;
     PyObject *(*iternext)(PyObject *);
     int cmp;
+#ifdef BITPACKED
+    Py_ssize_t pos = 0;
+
+    if (PyList_CheckExact(iterable) || PyTuple_CheckExact(iterable)) {
+        cmp = bitpacked_any_all(iterable, 0, &pos);
+        if (cmp >= 0)
+            return PyBool_FromLong(cmp);
+    }
+#endif
 
     it = PyObject_GetIter(iterable);
     if (it == NULL)
         return NULL;
+#ifdef BITPACKED
+    if (bitpacked_iter_skip(it, pos) < 0) {
+        Py_DECREF(it);
+        return NULL;
+    }
+#endif
     iternext = *Py_TYPE(it)->tp_iternext;
 
     for (;;) {
@@ -315,10 +416,25 @@ builtin_any(PyModuleDef *module, PyObject *iterable)
     PyObject *it, *item;
     PyObject *(*iternext)(PyObject *);
     int cmp;
+#ifdef BITPACKED
+    Py_ssize_t pos = 0;
+
+    if (PyList_CheckExact(iterable) || PyTuple_CheckExact(iterable)) {
+        cmp = bitpacked_any_all(iterable, 1, &pos);
+        if (cmp >= 0)
+            return PyBool_FromLong(cmp);
+    }
+#endif
 
     it = PyObject_GetIter(iterable);
     if (it == NULL)
         return NULL;
+#ifdef BITPACKED
+    if (bitpacked_iter_skip(it, pos) < 0) {
+        Py_DECREF(it);
+        return NULL;
+    }
+#endif
     iternext = *Py_TYPE(it)->tp_iternext;
 
     for (;;) {
@@ -1474,6 +1590,58 @@ builtin_locals_impl(PyModuleDef *module)
 }
 
 
+#ifdef BITPACKED
+/* min() and max() of items[0:n] (n > 0) when they are all tagged ints, or
+ * all tagged floats; NULL otherwise.  Equal tagged ints are the same word.
+ * Floats are compared one after another, so that the first of equal items
+ * (0.0 and -0.0) is returned as in min_max().
+ */
+static PyObject *
+bitpacked_min_max(PyObject **items, Py_ssize_t n, int op)
+{
+    Py_ssize_t i, j;
+
+    if (BITPACKED_LONG_CHECKEXACT(items[0])) {
+        BITPACKED_SWORD lo = (BITPACKED_SWORD)items[0], hi = lo;
+        for (i = 0; i + BITPACKED_KERNEL_BLOCK <= n; i += BITPACKED_KERNEL_BLOCK) {
+            BITPACKED_UWORD bad = 0;
+            for (j = 0; j < BITPACKED_KERNEL_BLOCK; j++) {
+                BITPACKED_SWORD w = (BITPACKED_SWORD)items[i + j];
+                bad |= (w & 0x1e) ^ BITPACKED_TYPEID_LONG;
+                lo = w < lo ? w : lo;
+                hi = w > hi ? w : hi;
+            }
+            if (bad)
+                return NULL;
+        }
+        for (; i < n; i++) {
+            BITPACKED_SWORD w = (BITPACKED_SWORD)items[i];
+            if (!BITPACKED_LONG_CHECKEXACT(w))
+                return NULL;
+            lo = w < lo ? w : lo;
+            hi = w > hi ? w : hi;
+        }
+        return (PyObject *)(op == Py_LT ? lo : hi);
+    }
+    if (BITPACKED_FLOAT_CHECK(items[0])) {
+        PyObject *best = items[0];
+        double bestval = _PyBitpacked_FloatValue(best);
+        for (i = 1; i < n; i++) {
+            double val;
+            if (!BITPACKED_FLOAT_CHECK(items[i]))
+                return NULL;
+            val = _PyBitpacked_FloatValue(items[i]);
+            if (op == Py_LT ? val < bestval : val > bestval) {
+                best = items[i];
+                bestval = val;
+            }
+        }
+        return best;
+    }
+    return NULL;
+}
+#endif
+
 static PyObject *
 min_max(PyObject *args, PyObject *kwds, int op)
 {
@@ -1505,6 +1673,16 @@ min_max(PyObject *args, PyObject *kwds, int op)
         return NULL;
     }
 
+#ifdef BITPACKED
+    if (keyfunc == NULL && (PyList_CheckExact(v) || PyTuple_CheckExact(v)) &&
+        PySequence_Fast_GET_SIZE(v) > 0) {
+        maxitem = bitpacked_min_max(PySequence_Fast_ITEMS(v),
+                                    PySequence_Fast_GET_SIZE(v), op);
+        if (maxitem != NULL)
+            return maxitem;
+    }
+#endif
+
     it = PyObject_GetIter(v);
     if (it == NULL) {
         return NULL;
@@ -2160,6 +2338,110 @@ Without arguments, equivalent to locals().\n\
 With an argument, equivalent to object.__dict__.");
 
 
+#ifdef BITPACKED
+/* sum() kernels: add the leading tagged ints of items[0:n] to *i_result,
+ * or the leading tagged floats and ints to *f_result, and return how many
+ * items were added.  Ints are added a block at a time, which cannot
+ * overflow within the block; floats one at a time and in order, so that
+ * the rounding is that of builtin_sum_impl()'s float loop.
+ */
+static Py_ssize_t
+bitpacked_sum_longs(PyObject **items, Py_ssize_t n, long *i_result)
+{
+    Py_ssize_t i = 0, j;
+    long acc = *i_result;
+
+    for (; i + BITPACKED_KERNEL_BLOCK <= n; i += BITPACKED_KERNEL_BLOCK) {
+        BITPACKED_UWORD bad = 0;
+        long b = 0, x;
+        for (j = 0; j < BITPACKED_KERNEL_BLOCK; j++) {
+            BITPACKED_UWORD w = (BITPACKED_UWORD)items[i + j];
+            bad |= (w & 0x1e) ^ BITPACKED_TYPEID_LONG;
+            b += (BITPACKED_SWORD)w >> BITPACKED_LONG_SHIFT;
+        }
+        x = acc + b;
+        if (bad || ((x^acc) < 0 && (x^b) < 0))
+            break;
+        acc = x;
+    }
+    for (; i < n; i++) {
+        long b, x;
+        if (!BITPACKED_LONG_CHECKEXACT(items[i]))
+            break;
+        b = BITPACKED_LONG_VALUE(items[i]);
+        x = acc + b;
+        if ((x^acc) < 0 && (x^b) < 0)
+            break;
+        acc = x;
+    }
+    *i_result = acc;
+    return i;
+}
+
+static Py_ssize_t
+bitpacked_sum_doubles(PyObject **items, Py_ssize_t n, double *f_result)
+{
+    Py_ssize_t i;
+    double acc = *f_result;
+
+    for (i = 0; i < n; i++) {
+        PyObject *item = items[i];
+        if (BITPACKED_FLOAT_CHECK(item))
+            acc += _PyBitpacked_FloatValue(item);
+        else if (BITPACKED_LONG_CHECKEXACT(item))
+            acc += (double)BITPACKED_LONG_VALUE(item);
+        else
+            break;
+    }
+    *f_result = acc;
+    return i;
+}
+
+/* Add up the tagged items at the start of an exact list or tuple, the way
+ * the int and float loops of builtin_sum_impl() would.  *result holds the
+ * start value and is replaced by the partial sum.  Return the number of
+ * items added, or -1 on error.
+ */
+static Py_ssize_t
+bitpacked_sum_sequence(PyObject *seq, PyObject **result)
+{
+    Py_ssize_t n = PySequence_Fast_GET_SIZE(seq), i;
+    PyObject **items = PySequence_Fast_ITEMS(seq);
+    PyObject *sum;
+    long i_result;
+    double f_result;
+
+    if (BITPACKED_LONG_CHECKEXACT(*result)) {
+        i_result = BITPACKED_LONG_VALUE(*result);
+        i = bitpacked_sum_longs(items, n, &i_result);
+        if (i == n || !BITPACKED_FLOAT_CHECK(items[i])) {
+            if (i == 0)
+                return 0;
+            sum = PyLong_FromLong(i_result);
+            goto done;
+        }
+        /* int + float makes a float, and the float loop takes over */
+        f_result = (double)i_result + _PyBitpacked_FloatValue(items[i++]);
+    }
+    else if (BITPACKED_FLOAT_CHECK(*result)) {
+        f_result = _PyBitpacked_FloatValue(*result);
+        i = 0;
+    }
+    else
+        return 0;
+    PyFPE_START_PROTECT("add", return -1)
+    i += bitpacked_sum_doubles(items + i, n - i, &f_result);
+    PyFPE_END_PROTECT(f_result)
+    sum = PyFloat_FromDouble(f_result);
+done:
+    if (sum == NULL)
+        return -1;
+    Py_DECREF(*result);
+    *result = sum;
+    return i;
+}
+#endif
+
 /*[clinic input]
 sum as builtin_sum
 
@@ -2215,6 +2497,17 @@ builtin_sum_impl(PyModuleDef *module, PyObject *iterable, PyObject *start)
     }
 
 #ifndef SLOW_SUM
+#ifdef BITPACKED
+    if (PyList_CheckExact(iterable) || PyTuple_CheckExact(iterable)) {
+        Py_ssize_t n = bitpacked_sum_sequence(iterable, &result);
+        if (n < 0 || bitpacked_iter_skip(iter, n) < 0) {
+            Py_DECREF(result);
+            Py_DECREF(iter);
+            return NULL;
+        }
+    }
+#endif
+
     /* Fast addition by keeping temporary sums in C instead of new Python objects.
        Assumes all inputs are the same type.  If the assumption fails, default
        to the more general routine.
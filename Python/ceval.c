@@ -147,6 +147,207 @@ static PyObject * unicode_concatenate(PyObject *, PyObject *,
                                       PyFrameObject *, unsigned char *);
 static PyObject * special_lookup(PyObject *, _Py_Identifier *);
 
+/* Fast paths for bitpacked int operands.
+ * Bitpacked ints carry no reference and their values fit in
+ * BITPACKED_LONG_BITS bits, so + and - of two of them never overflow a
+ * long; * is checked with __builtin_mul_overflow.
+ */
+#ifdef BITPACKED
+#define BITPACKED_LONG_CHECKEXACT2(v, w) \
+    (BITPACKED_LONG_CHECKEXACT(v) && BITPACKED_LONG_CHECKEXACT(w))
+
+Py_LOCAL_INLINE(PyObject *)
+bitpacked_long_result(long ival)
+{
+    if (BITPACKED_LONG_RANGE_CHECK(ival)) {
+        BITPACKED_STAT_TAGGED(BITPACKED_TYPEID_LONG);
+        return BITPACKED_LONG_PACK(ival);
+    }
+    return PyLong_FromLong(ival);
+}
+
+Py_LOCAL_INLINE(PyObject *)
+bitpacked_long_multiply(PyObject *v, PyObject *w)
+{
+    long res;
+    if (__builtin_mul_overflow(BITPACKED_LONG_VALUE(v),
+                               BITPACKED_LONG_VALUE(w), &res))
+        return PyNumber_Multiply(v, w);
+    return bitpacked_long_result(res);
+}
+
+Py_LOCAL_INLINE(PyObject *)
+bitpacked_long_compare(int op, PyObject *v, PyObject *w)
+{
+    long a = BITPACKED_LONG_VALUE(v);
+    long b = BITPACKED_LONG_VALUE(w);
+    int res;
+    switch (op) {
+    case PyCmp_LT: res = a <  b; break;
+    case PyCmp_LE: res = a <= b; break;
+    case PyCmp_EQ: res = a == b; break;
+    case PyCmp_NE: res = a != b; break;
+    case PyCmp_GT: res = a >  b; break;
+    case PyCmp_GE: res = a >= b; break;
+    default: return cmp_outcome(op, v, w);
+    }
+    return res ? Py_True : Py_False;
+}
+
+/* Fast paths for bitpacked float operands, where the other operand may
+ * also be a bitpacked int (BITPACKED_FLOAT_OPERANDS).  Both doubles are
+ * decoded in place and the result is tagged again by PyFloat_FromDouble()
+ * when it can be.  Floats and ints have no in-place slots, so the INPLACE_
+ * opcodes share these.
+ */
+#define bitpacked_float_binop(v, OP, w) \
+    PyFloat_FromDouble(_PyBitpacked_NumberValue(v) OP _PyBitpacked_NumberValue(w))
+
+Py_LOCAL_INLINE(PyObject *)
+bitpacked_float_true_divide(PyObject *v, PyObject *w)
+{
+    double b = _PyBitpacked_NumberValue(w);
+    if (b == 0.0)
+        return PyNumber_TrueDivide(v, w);   /* raises ZeroDivisionError */
+    return PyFloat_FromDouble(_PyBitpacked_NumberValue(v) / b);
+}
+
+/* float_richcompare() compares ints beyond 2**53 exactly, not as doubles */
+#define BITPACKED_LONG_DOUBLE_EXACT(ob) \
+    (!BITPACKED_LONG_CHECKEXACT(ob) || \
+     (unsigned long)(BITPACKED_LONG_VALUE(ob) + (1L << 53)) <= (2UL << 53))
+
+Py_LOCAL_INLINE(PyObject *)
+bitpacked_float_compare(int op, PyObject *v, PyObject *w)
+{
+    double a, b;
+    int res;
+    if (!BITPACKED_LONG_DOUBLE_EXACT(v) || !BITPACKED_LONG_DOUBLE_EXACT(w))
+        return cmp_outcome(op, v, w);
+    a = _PyBitpacked_NumberValue(v);
+    b = _PyBitpacked_NumberValue(w);
+    switch (op) {
+    case PyCmp_LT: res = a <  b; break;
+    case PyCmp_LE: res = a <= b; break;
+    case PyCmp_EQ: res = a == b; break;
+    case PyCmp_NE: res = a != b; break;
+    case PyCmp_GT: res = a >  b; break;
+    case PyCmp_GE: res = a >= b; break;
+    default: return cmp_outcome(op, v, w);
+    }
+    return res ? Py_True : Py_False;
+}
+#else
+#define BITPACKED_LONG_CHECKEXACT2(v, w) 0
+#define bitpacked_long_result(ival) PyLong_FromLong(ival)
+#define bitpacked_long_multiply(v, w) PyNumber_Multiply(v, w)
+#define bitpacked_long_compare(op, v, w) cmp_outcome(op, v, w)
+#define BITPACKED_FLOAT_OPERANDS(v, w) 0
+#define bitpacked_float_binop(v, OP, w) NULL
+#define bitpacked_float_true_divide(v, w) PyNumber_TrueDivide(v, w)
+#define bitpacked_float_compare(op, v, w) cmp_outcome(op, v, w)
+#endif
+
+/* Quickening.  A code object that has been entered or has jumped back
+   QUICKEN_WARMUP times gets a private copy of its bytecode, co_quickened,
+   which frames run instead of co_code.  In that copy the generic
+   LOAD_ATTR, LOAD_GLOBAL, COMPARE_OP and BINARY_ADD rewrite their own
+   opcode to a specialized form when they see the case the form is for,
+   and the specialized forms rewrite it back on the first operand they
+   cannot handle.  Opcode arguments and offsets stay the same, so f_lasti,
+   line numbers and EXTENDED_ARG are unaffected, and co_code is never
+   modified. */
+#define QUICKEN_WARMUP 16
+
+/* Hits and misses of the specialized opcodes; see sys._getquickenstats() */
+static unsigned long quicken_stats[256][2];
+
+#define QUICKENED() (first_instr == co->co_quickened)
+#define SPECIALIZE(op) (next_instr[HAS_ARG(op) ? -3 : -1] = (op))
+#define QUICKEN_HIT(op) (quicken_stats[op][0]++)
+#define DEOPTIMIZE(op, generic) \
+    (quicken_stats[op][1]++, SPECIALIZE(generic))
+
+/* The outcome of comparison op, one of PyCmp_LT to PyCmp_GE, on two
+   doubles */
+Py_LOCAL_INLINE(int)
+float_compare_outcome(int op, double a, double b)
+{
+    switch (op) {
+    case PyCmp_LT: return a < b;
+    case PyCmp_LE: return a <= b;
+    case PyCmp_EQ: return a == b;
+    case PyCmp_NE: return a != b;
+    case PyCmp_GT: return a > b;
+    default: return a >= b;
+    }
+}
+
+/* Copies co_code to co_quickened.  On failure, which only means that the
+   code keeps running unquickened, returns -1 without setting an
+   exception. */
+static int
+quicken(PyCodeObject *co)
+{
+    Py_ssize_t size = PyBytes_GET_SIZE(co->co_code);
+    Py_ssize_t nnames = PyTuple_GET_SIZE(co->co_names);
+    unsigned char *quickened;
+
+    if (nnames > 0 && co->co_attrcache == NULL) {
+        co->co_attrcache = PyMem_Calloc(nnames, sizeof(_PyCodeAttrCache));
+        if (co->co_attrcache == NULL) {
+            co->co_warmth = 0;
+            return -1;
+        }
+    }
+    quickened = PyMem_Malloc(size);
+    if (quickened == NULL) {
+        co->co_warmth = 0;
+        return -1;
+    }
+    memcpy(quickened, PyBytes_AS_STRING(co->co_code), size);
+    co->co_quickened = quickened;
+    return 0;
+}
+
+/* Counts an entry into co or a backward jump in it.  Returns the
+   quickened code, or NULL while co is not quickened. */
+Py_LOCAL_INLINE(unsigned char *)
+quicken_warm_up(PyCodeObject *co)
+{
+    if (co->co_quickened == NULL && ++co->co_warmth >= QUICKEN_WARMUP)
+        quicken(co);
+    return co->co_quickened;
+}
+
+/* Called by LOAD_ATTR in quickened code.  If owner's type leaves name to
+   the instance dict, which is the case when it uses the generic getattr
+   and defines no attribute of that name, records the type in ac and
+   returns the value from the instance dict as a borrowed reference.
+   Otherwise returns NULL without setting an exception. */
+static PyObject *
+specialize_load_attr(_PyCodeAttrCache *ac, PyObject *owner, PyObject *name)
+{
+    PyTypeObject *tp = Py_TYPE(owner);
+    PyObject **dictptr;
+
+    if (ac->ac_type == tp && ac->ac_type_version == tp->tp_version_tag &&
+        !ac->ac_specialize)
+        return NULL;
+    ac->ac_type = tp;
+    ac->ac_specialize = (tp->tp_getattro == PyObject_GenericGetAttr &&
+                         _PyType_Lookup(tp, name) == NULL &&
+                         PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG));
+    /* After _PyType_Lookup(), which may have assigned the tag */
+    ac->ac_type_version = tp->tp_version_tag;
+    if (!ac->ac_specialize)
+        return NULL;
+    dictptr = _PyObject_GetDictPtr(owner);
+    if (dictptr == NULL || *dictptr == NULL)
+        return NULL;
+    return PyDict_GetItem(*dictptr, name);
+}
+
 #define NAME_ERROR_MSG \
     "name '%.200s' is not defined"
 #define UNBOUNDLOCAL_ERROR_MSG \
@@ -1001,6 +1202,18 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
 #define JUMPTO(x)       (next_instr = first_instr + (x))
 #define JUMPBY(x)       (next_instr += (x))
 
+/* Moves a superinstruction on to the instruction after it, whose opcode
+   and argument it then has.  When tracing is possible, that instruction
+   runs on its own instead, so that it gets its line event. */
+#define SECOND_INSTRUCTION() \
+    { \
+        if (_Py_TracingPossible) \
+            DISPATCH(); \
+        f->f_lasti = INSTR_OFFSET(); \
+        opcode = NEXTOP(); \
+        oparg = NEXTARG(); \
+    }
+
 /* OpCode prediction macros
     Some opcodes tend to come in pairs thus making it possible to
     predict the second code when the first is run.  For example,
@@ -1165,7 +1378,9 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
     consts = co->co_consts;
     fastlocals = f->f_localsplus;
     freevars = f->f_localsplus + co->co_nlocals;
-    first_instr = (unsigned char*) PyBytes_AS_STRING(co->co_code);
+    first_instr = quicken_warm_up(co);
+    if (first_instr == NULL)
+        first_instr = (unsigned char*) PyBytes_AS_STRING(co->co_code);
     /* An explanation is in order for the next line.
 
        f->f_lasti now refers to the index of the last instruction
@@ -1377,6 +1592,49 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             FAST_DISPATCH();
         }
 
+        /* Superinstructions stand for the instruction they replaced and
+           the one after it, which peephole.c leaves in place for jumps to
+           it; see SECOND_INSTRUCTION(). */
+        TARGET(LOAD_FAST__LOAD_FAST) {
+            PyObject *value = GETLOCAL(oparg);
+            if (value == NULL) {
+                format_exc_check_arg(PyExc_UnboundLocalError,
+                                     UNBOUNDLOCAL_ERROR_MSG,
+                                     PyTuple_GetItem(co->co_varnames, oparg));
+                goto error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            SECOND_INSTRUCTION();
+            value = GETLOCAL(oparg);
+            if (value == NULL) {
+                format_exc_check_arg(PyExc_UnboundLocalError,
+                                     UNBOUNDLOCAL_ERROR_MSG,
+                                     PyTuple_GetItem(co->co_varnames, oparg));
+                goto error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            FAST_DISPATCH();
+        }
+
+        TARGET(LOAD_FAST__LOAD_ATTR) {
+            PyObject *value = GETLOCAL(oparg);
+            if (value == NULL) {
+                format_exc_check_arg(PyExc_UnboundLocalError,
+                                     UNBOUNDLOCAL_ERROR_MSG,
+                                     PyTuple_GetItem(co->co_varnames, oparg));
+                goto error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            SECOND_INSTRUCTION();
+            /* Quickening may have specialized the LOAD_ATTR */
+            if (opcode == LOAD_ATTR_INSTANCE_DICT)
+                goto _load_attr_instance_dict;
+            goto _load_attr;
+        }
+
         TARGET(LOAD_CONST) {
             PyObject *value = GETITEM(consts, oparg);
             Py_INCREF(value);
@@ -1391,6 +1649,22 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             FAST_DISPATCH();
         }
 
+        TARGET(STORE_FAST__LOAD_FAST) {
+            PyObject *value = POP();
+            SETLOCAL(oparg, value);
+            SECOND_INSTRUCTION();
+            value = GETLOCAL(oparg);
+            if (value == NULL) {
+                format_exc_check_arg(PyExc_UnboundLocalError,
+                                     UNBOUNDLOCAL_ERROR_MSG,
+                                     PyTuple_GetItem(co->co_varnames, oparg));
+                goto error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            FAST_DISPATCH();
+        }
+
         TARGET(POP_TOP) {
             PyObject *value = POP();
             Py_DECREF(value);
@@ -1497,7 +1771,13 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         TARGET(BINARY_MULTIPLY) {
             PyObject *right = POP();
             PyObject *left = TOP();
-            PyObject *res = PyNumber_Multiply(left, right);
+            PyObject *res;
+            if (BITPACKED_LONG_CHECKEXACT2(left, right))
+                res = bitpacked_long_multiply(left, right);
+            else if (BITPACKED_FLOAT_OPERANDS(left, right))
+                res = bitpacked_float_binop(left, *, right);
+            else
+                res = PyNumber_Multiply(left, right);
             Py_DECREF(left);
             Py_DECREF(right);
             SET_TOP(res);
@@ -1521,7 +1801,11 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         TARGET(BINARY_TRUE_DIVIDE) {
             PyObject *divisor = POP();
             PyObject *dividend = TOP();
-            PyObject *quotient = PyNumber_TrueDivide(dividend, divisor);
+            PyObject *quotient;
+            if (BITPACKED_FLOAT_OPERANDS(dividend, divisor))
+                quotient = bitpacked_float_true_divide(dividend, divisor);
+            else
+                quotient = PyNumber_TrueDivide(dividend, divisor);
             Py_DECREF(dividend);
             Py_DECREF(divisor);
             SET_TOP(quotient);
@@ -1556,11 +1840,21 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
-        TARGET(BINARY_ADD) {
+        TARGET(BINARY_ADD)
+        _binary_add: {
             PyObject *right = POP();
             PyObject *left = TOP();
             PyObject *sum;
-            if (PyUnicode_CheckExact(left) &&
+            if (BITPACKED_LONG_CHECKEXACT2(left, right)) {
+                if (QUICKENED())
+                    SPECIALIZE(BINARY_ADD_TAGGED_INT);
+                sum = bitpacked_long_result(
+                    BITPACKED_LONG_VALUE(left) + BITPACKED_LONG_VALUE(right));
+            }
+            else if (BITPACKED_FLOAT_OPERANDS(left, right)) {
+                sum = bitpacked_float_binop(left, +, right);
+            }
+            else if (PyUnicode_CheckExact(left) &&
                      PyUnicode_CheckExact(right)) {
                 sum = unicode_concatenate(left, right, f, next_instr);
                 /* unicode_concatenate consumed the ref to v */
@@ -1576,10 +1870,38 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
+        TARGET(BINARY_ADD_TAGGED_INT) {
+            /* BINARY_ADD of two tagged ints in quickened code; only
+               bitpacked builds specialize to it */
+#ifdef BITPACKED
+            PyObject *right = TOP();
+            PyObject *left = SECOND();
+            if (BITPACKED_LONG_CHECKEXACT2(left, right)) {
+                PyObject *sum = bitpacked_long_result(
+                    BITPACKED_LONG_VALUE(left) + BITPACKED_LONG_VALUE(right));
+                QUICKEN_HIT(BINARY_ADD_TAGGED_INT);
+                STACKADJ(-1);
+                SET_TOP(sum);
+                if (sum == NULL)
+                    goto error;
+                DISPATCH();
+            }
+#endif
+            DEOPTIMIZE(BINARY_ADD_TAGGED_INT, BINARY_ADD);
+            goto _binary_add;
+        }
+
         TARGET(BINARY_SUBTRACT) {
             PyObject *right = POP();
             PyObject *left = TOP();
-            PyObject *diff = PyNumber_Subtract(left, right);
+            PyObject *diff;
+            if (BITPACKED_LONG_CHECKEXACT2(left, right))
+                diff = bitpacked_long_result(
+                    BITPACKED_LONG_VALUE(left) - BITPACKED_LONG_VALUE(right));
+            else if (BITPACKED_FLOAT_OPERANDS(left, right))
+                diff = bitpacked_float_binop(left, -, right);
+            else
+                diff = PyNumber_Subtract(left, right);
             Py_DECREF(right);
             Py_DECREF(left);
             SET_TOP(diff);
@@ -1699,7 +2021,13 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         TARGET(INPLACE_MULTIPLY) {
             PyObject *right = POP();
             PyObject *left = TOP();
-            PyObject *res = PyNumber_InPlaceMultiply(left, right);
+            PyObject *res;
+            if (BITPACKED_LONG_CHECKEXACT2(left, right))
+                res = bitpacked_long_multiply(left, right);
+            else if (BITPACKED_FLOAT_OPERANDS(left, right))
+                res = bitpacked_float_binop(left, *, right);
+            else
+                res = PyNumber_InPlaceMultiply(left, right);
             Py_DECREF(left);
             Py_DECREF(right);
             SET_TOP(res);
@@ -1723,7 +2051,11 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         TARGET(INPLACE_TRUE_DIVIDE) {
             PyObject *divisor = POP();
             PyObject *dividend = TOP();
-            PyObject *quotient = PyNumber_InPlaceTrueDivide(dividend, divisor);
+            PyObject *quotient;
+            if (BITPACKED_FLOAT_OPERANDS(dividend, divisor))
+                quotient = bitpacked_float_true_divide(dividend, divisor);
+            else
+                quotient = PyNumber_InPlaceTrueDivide(dividend, divisor);
             Py_DECREF(dividend);
             Py_DECREF(divisor);
             SET_TOP(quotient);
@@ -1760,7 +2092,14 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             PyObject *right = POP();
             PyObject *left = TOP();
             PyObject *sum;
-            if (PyUnicode_CheckExact(left) && PyUnicode_CheckExact(right)) {
+            if (BITPACKED_LONG_CHECKEXACT2(left, right)) {
+                sum = bitpacked_long_result(
+                    BITPACKED_LONG_VALUE(left) + BITPACKED_LONG_VALUE(right));
+            }
+            else if (BITPACKED_FLOAT_OPERANDS(left, right)) {
+                sum = bitpacked_float_binop(left, +, right);
+            }
+            else if (PyUnicode_CheckExact(left) && PyUnicode_CheckExact(right)) {
                 sum = unicode_concatenate(left, right, f, next_instr);
                 /* unicode_concatenate consumed the ref to v */
             }
@@ -1778,7 +2117,14 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         TARGET(INPLACE_SUBTRACT) {
             PyObject *right = POP();
             PyObject *left = TOP();
-            PyObject *diff = PyNumber_InPlaceSubtract(left, right);
+            PyObject *diff;
+            if (BITPACKED_LONG_CHECKEXACT2(left, right))
+                diff = bitpacked_long_result(
+                    BITPACKED_LONG_VALUE(left) - BITPACKED_LONG_VALUE(right));
+            else if (BITPACKED_FLOAT_OPERANDS(left, right))
+                diff = bitpacked_float_binop(left, -, right);
+            else
+                diff = PyNumber_InPlaceSubtract(left, right);
             Py_DECREF(left);
             Py_DECREF(right);
             SET_TOP(diff);
@@ -2394,20 +2740,53 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
-        TARGET(LOAD_GLOBAL) {
+        TARGET(LOAD_GLOBAL)
+        _load_global: {
             PyObject *name = GETITEM(names, oparg);
             PyObject *v;
             if (PyDict_CheckExact(f->f_globals)
                 && PyDict_CheckExact(f->f_builtins)) {
-                v = _PyDict_LoadGlobal((PyDictObject *)f->f_globals,
-                                       (PyDictObject *)f->f_builtins,
-                                       name);
+                PyDictObject *globals = (PyDictObject *)f->f_globals;
+                PyDictObject *builtins = (PyDictObject *)f->f_builtins;
+                _PyCodeGlobalCache *cache = co->co_globalcache;
+                PY_UINT64_T globals_version = globals->ma_version_tag;
+                PY_UINT64_T builtins_version = builtins->ma_version_tag;
+                if (cache != NULL) {
+                    cache += oparg;
+                    if (cache->gc_globals_version == globals_version &&
+                        cache->gc_builtins_version == builtins_version) {
+                        if (QUICKENED())
+                            SPECIALIZE(LOAD_GLOBAL_CACHED);
+                        v = cache->gc_value;
+                        Py_INCREF(v);
+                        PUSH(v);
+                        DISPATCH();
+                    }
+                }
+                v = _PyDict_LoadGlobal(globals, builtins, name);
                 if (v == NULL) {
                     if (!_PyErr_OCCURRED())
                         format_exc_check_arg(PyExc_NameError,
                                              NAME_ERROR_MSG, name);
                     goto error;
                 }
+                if (cache == NULL) {
+                    /* On failure the next miss tries again. */
+                    co->co_globalcache = PyMem_Calloc(
+                        PyTuple_GET_SIZE(names), sizeof(_PyCodeGlobalCache));
+                    cache = co->co_globalcache;
+                    if (cache != NULL)
+                        cache += oparg;
+                }
+                if (cache != NULL) {
+                    /* The versions from before the lookup: if it changed
+                       either dict, the entry will not match. */
+                    cache->gc_globals_version = globals_version;
+                    cache->gc_builtins_version = builtins_version;
+                    cache->gc_value = v;
+                    if (QUICKENED())
+                        SPECIALIZE(LOAD_GLOBAL_CACHED);
+                }
                 Py_INCREF(v);
             }
             else {
@@ -2432,6 +2811,26 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
+        TARGET(LOAD_GLOBAL_CACHED) {
+            /* LOAD_GLOBAL whose co_globalcache entry matched last time */
+            PyObject *globals = f->f_globals;
+            PyObject *builtins = f->f_builtins;
+            _PyCodeGlobalCache *cache = co->co_globalcache + oparg;
+            if (PyDict_CheckExact(globals) && PyDict_CheckExact(builtins) &&
+                cache->gc_globals_version ==
+                    ((PyDictObject *)globals)->ma_version_tag &&
+                cache->gc_builtins_version ==
+                    ((PyDictObject *)builtins)->ma_version_tag) {
+                PyObject *v = cache->gc_value;
+                QUICKEN_HIT(LOAD_GLOBAL_CACHED);
+                Py_INCREF(v);
+                PUSH(v);
+                DISPATCH();
+            }
+            DEOPTIMIZE(LOAD_GLOBAL_CACHED, LOAD_GLOBAL);
+            goto _load_global;
+        }
+
         TARGET(DELETE_FAST) {
             PyObject *v = GETLOCAL(oparg);
             if (v != NULL) {
@@ -2737,10 +3136,23 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
-        TARGET(LOAD_ATTR) {
+        TARGET(LOAD_ATTR)
+        _load_attr: {
             PyObject *name = GETITEM(names, oparg);
             PyObject *owner = TOP();
-            PyObject *res = PyObject_GetAttr(owner, name);
+            PyObject *res;
+            if (QUICKENED() && co->co_attrcache != NULL) {
+                res = specialize_load_attr(co->co_attrcache + oparg,
+                                           owner, name);
+                if (res != NULL) {
+                    SPECIALIZE(LOAD_ATTR_INSTANCE_DICT);
+                    Py_INCREF(res);
+                    Py_DECREF(owner);
+                    SET_TOP(res);
+                    DISPATCH();
+                }
+            }
+            res = PyObject_GetAttr(owner, name);
             Py_DECREF(owner);
             SET_TOP(res);
             if (res == NULL)
@@ -2748,10 +3160,68 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
-        TARGET(COMPARE_OP) {
+        TARGET(LOAD_ATTR_INSTANCE_DICT)
+        _load_attr_instance_dict: {
+            /* LOAD_ATTR of a name that the type of the owner leaves to the
+               instance dict; see specialize_load_attr(). */
+            PyObject *owner = TOP();
+            PyTypeObject *tp = Py_TYPE(owner);
+            _PyCodeAttrCache *ac = co->co_attrcache + oparg;
+            if (ac->ac_type == tp && ac->ac_specialize &&
+                ac->ac_type_version == tp->tp_version_tag &&
+                PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG)) {
+                PyObject **dictptr = _PyObject_GetDictPtr(owner);
+                PyObject *res = NULL;
+                if (dictptr != NULL && *dictptr != NULL)
+                    res = PyDict_GetItem(*dictptr, GETITEM(names, oparg));
+                if (res != NULL) {
+                    QUICKEN_HIT(LOAD_ATTR_INSTANCE_DICT);
+                    Py_INCREF(res);
+                    Py_DECREF(owner);
+                    SET_TOP(res);
+                    DISPATCH();
+                }
+            }
+            DEOPTIMIZE(LOAD_ATTR_INSTANCE_DICT, LOAD_ATTR);
+            goto _load_attr;
+        }
+
+        TARGET(LOAD_METHOD) {
+            /* Pushes the function and the object for CALL_METHOD when the
+               attribute is a Python function or a method descriptor found
+               on the type, which saves the bound method.  Otherwise pushes
+               NULL and the attribute. */
+            PyObject *name = GETITEM(names, oparg);
+            PyObject *obj = TOP();
+            PyObject *meth;
+            if (_PyObject_GetMethod(obj, name, &meth)) {
+                SET_TOP(meth);
+                PUSH(obj);
+            }
+            else {
+                if (meth == NULL)
+                    goto error;
+                SET_TOP(NULL);
+                Py_DECREF(obj);
+                PUSH(meth);
+            }
+            DISPATCH();
+        }
+
+        TARGET(COMPARE_OP)
+        _compare_op: {
             PyObject *right = POP();
             PyObject *left = TOP();
-            PyObject *res = cmp_outcome(oparg, left, right);
+            PyObject *res;
+            if (QUICKENED() && oparg <= PyCmp_GE &&
+                PyFloat_CheckExact(left) && PyFloat_CheckExact(right))
+                SPECIALIZE(COMPARE_OP_FLOAT);
+            if (BITPACKED_LONG_CHECKEXACT2(left, right))
+                res = bitpacked_long_compare(oparg, left, right);
+            else if (BITPACKED_FLOAT_OPERANDS(left, right))
+                res = bitpacked_float_compare(oparg, left, right);
+            else
+                res = cmp_outcome(oparg, left, right);
             Py_DECREF(left);
             Py_DECREF(right);
             SET_TOP(res);
@@ -2762,6 +3232,79 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
+        TARGET(COMPARE_OP_FLOAT) {
+            /* COMPARE_OP of two floats with <, <=, ==, !=, > or >= */
+            PyObject *right = TOP();
+            PyObject *left = SECOND();
+            if (PyFloat_CheckExact(left) && PyFloat_CheckExact(right)) {
+                PyObject *res;
+                QUICKEN_HIT(COMPARE_OP_FLOAT);
+                res = float_compare_outcome(oparg, PyFloat_AS_DOUBLE(left),
+                                            PyFloat_AS_DOUBLE(right)) ?
+                      Py_True : Py_False;
+                Py_INCREF(res);
+                STACKADJ(-1);
+                Py_DECREF(left);
+                Py_DECREF(right);
+                SET_TOP(res);
+                PREDICT(POP_JUMP_IF_FALSE);
+                PREDICT(POP_JUMP_IF_TRUE);
+                DISPATCH();
+            }
+            DEOPTIMIZE(COMPARE_OP_FLOAT, COMPARE_OP);
+            goto _compare_op;
+        }
+
+        TARGET(COMPARE_OP__POP_JUMP_IF_FALSE) {
+            /* Only fused on one line, so there is no line event to wait
+               for.  Two floats, as COMPARE_OP_FLOAT would take them, are
+               compared without a bool to test. */
+            PyObject *right = POP();
+            PyObject *left = POP();
+            PyObject *res;
+            int err;
+            if (oparg <= PyCmp_GE &&
+                PyFloat_CheckExact(left) && PyFloat_CheckExact(right)) {
+                err = float_compare_outcome(oparg, PyFloat_AS_DOUBLE(left),
+                                            PyFloat_AS_DOUBLE(right));
+                Py_DECREF(left);
+                Py_DECREF(right);
+                opcode = NEXTOP();
+                oparg = NEXTARG();
+                if (!err)
+                    JUMPTO(oparg);
+                FAST_DISPATCH();
+            }
+            if (BITPACKED_LONG_CHECKEXACT2(left, right))
+                res = bitpacked_long_compare(oparg, left, right);
+            else if (BITPACKED_FLOAT_OPERANDS(left, right))
+                res = bitpacked_float_compare(oparg, left, right);
+            else
+                res = cmp_outcome(oparg, left, right);
+            Py_DECREF(left);
+            Py_DECREF(right);
+            if (res == NULL)
+                goto error;
+            opcode = NEXTOP();
+            oparg = NEXTARG();
+            if (res == Py_True) {
+                Py_DECREF(res);
+                FAST_DISPATCH();
+            }
+            if (res == Py_False) {
+                Py_DECREF(res);
+                JUMPTO(oparg);
+                FAST_DISPATCH();
+            }
+            err = PyObject_IsTrue(res);
+            Py_DECREF(res);
+            if (err == 0)
+                JUMPTO(oparg);
+            else if (err < 0)
+                goto error;
+            DISPATCH();
+        }
+
         TARGET(IMPORT_NAME) {
             _Py_IDENTIFIER(__import__);
             PyObject *name = GETITEM(names, oparg);
@@ -2951,6 +3494,12 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
 
         PREDICTED_WITH_ARG(JUMP_ABSOLUTE);
         TARGET(JUMP_ABSOLUTE) {
+            /* Loops warm the code up too: switch to the quickened copy */
+            if (!QUICKENED() && oparg < INSTR_OFFSET()) {
+                unsigned char *quickened = quicken_warm_up(co);
+                if (quickened != NULL)
+                    first_instr = quickened;
+            }
             JUMPTO(oparg);
 #if FAST_LOOPS
             /* Enabling this path speeds-up all while and for-loops by bypassing
@@ -2969,7 +3518,14 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         TARGET(GET_ITER) {
             /* before: [obj]; after [getiter(obj)] */
             PyObject *iterable = TOP();
-            PyObject *iter = PyObject_GetIter(iterable);
+            PyObject *iter;
+            /* A bitpacked range consumed right away by FOR_ITER is
+               iterated in place on the stack; see FOR_ITER. */
+            if (BITPACKED_RANGE_CHECKEXACT(iterable) && *next_instr == FOR_ITER) {
+                PREDICT(FOR_ITER);
+                DISPATCH();
+            }
+            iter = PyObject_GetIter(iterable);
             Py_DECREF(iterable);
             SET_TOP(iter);
             if (iter == NULL)
@@ -3010,7 +3566,31 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         TARGET(FOR_ITER) {
             /* before: [iter]; after: [iter, iter()] *or* [] */
             PyObject *iter = TOP();
-            PyObject *next = (*Py_TYPE(iter)->tp_iternext)(iter);
+            PyObject *next;
+#ifdef BITPACKED
+            if (BITPACKED_RANGE_CHECKEXACT(iter)) {
+                /* The range itself is the counter: push its start and
+                   leave the rest of it on the stack.  start + step may
+                   wrap only when nothing remains, so it is never used. */
+                bitpacked_rangeobject r;
+                r.pyobj = iter;
+                if (r.length != 0) {
+                    next = BITPACKED_LONG_PACK((long)r.start);
+                    BITPACKED_STAT_TAGGED(BITPACKED_TYPEID_LONG);
+                    r.start += r.step;
+                    r.length--;
+                    SET_TOP(r.pyobj);
+                    PUSH(next);
+                    PREDICT(STORE_FAST);
+                    PREDICT(UNPACK_SEQUENCE);
+                    DISPATCH();
+                }
+                STACKADJ(-1);
+                JUMPBY(oparg);
+                DISPATCH();
+            }
+#endif
+            next = (*Py_TYPE(iter)->tp_iternext)(iter);
             if (next != NULL) {
                 PUSH(next);
                 PREDICT(STORE_FAST);
@@ -3242,6 +3822,80 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
+        TARGET(CALL_METHOD) {
+            /* Below the arguments are either the function and self from
+               LOAD_METHOD, which go in as callable and first argument, or
+               NULL and the callable. */
+            PyObject **sp, *res;
+            int n = (oparg & 0xff) + 2 * ((oparg >> 8) & 0xff);
+            PyObject *meth = PEEK(n + 2);
+            int self_arg = meth != NULL;
+            PCALL(PCALL_ALL);
+            if (self_arg && Py_TYPE(meth) == &PyMethodDescr_Type) {
+                /* A method of a builtin type.  Without a profiler,
+                   METH_NOARGS, METH_O and METH_FASTCALL methods are called
+                   right away; other calls bind it as LOAD_ATTR would have. */
+                PyMethodDef *ml = ((PyMethodDescrObject *)meth)->d_method;
+                PyObject *self = PEEK(n + 1);
+                int profiled = tstate->use_tracing && tstate->c_profilefunc;
+                if (!profiled && oparg == 0 && (ml->ml_flags & METH_NOARGS)) {
+                    res = (*ml->ml_meth)(self, NULL);
+                    res = _Py_CheckFunctionResult(meth, res, NULL);
+                    STACKADJ(-2);
+                }
+                else if (!profiled && oparg == 1 && (ml->ml_flags & METH_O)) {
+                    PyObject *arg = POP();
+                    res = (*ml->ml_meth)(self, arg);
+                    res = _Py_CheckFunctionResult(meth, res, NULL);
+                    Py_DECREF(arg);
+                    STACKADJ(-2);
+                }
+                else if (!profiled && oparg == n &&
+                         (ml->ml_flags & METH_FASTCALL)) {
+                    res = (*(_PyCFunctionFast)ml->ml_meth)(
+                        self, stack_pointer - n, n);
+                    res = _Py_CheckFunctionResult(meth, res, NULL);
+                    while (n-- > 0) {
+                        PyObject *arg = POP();
+                        Py_DECREF(arg);
+                    }
+                    STACKADJ(-2);
+                }
+                else {
+                    PyObject *bound = Py_TYPE(meth)->tp_descr_get(
+                        meth, self, (PyObject *)Py_TYPE(self));
+                    if (bound == NULL)
+                        goto error;
+                    PEEK(n + 2) = NULL;
+                    PEEK(n + 1) = bound;
+                    Py_DECREF(meth);
+                    Py_DECREF(self);
+                    self_arg = 0;
+                    goto call_method;
+                }
+                Py_DECREF(self);
+                Py_DECREF(meth);
+                PUSH(res);
+                if (res == NULL)
+                    goto error;
+                DISPATCH();
+            }
+        call_method:
+            sp = stack_pointer;
+#ifdef WITH_TSC
+            res = call_function(&sp, oparg + self_arg, &intr0, &intr1);
+#else
+            res = call_function(&sp, oparg + self_arg);
+#endif
+            stack_pointer = sp;
+            if (!self_arg)
+                (void)POP();
+            PUSH(res);
+            if (res == NULL)
+                goto error;
+            DISPATCH();
+        }
+
         TARGET_WITH_IMPL(CALL_FUNCTION_VAR, _call_function_var_kw)
         TARGET_WITH_IMPL(CALL_FUNCTION_KW, _call_function_var_kw)
         TARGET(CALL_FUNCTION_VAR_KW)
@@ -4697,6 +5351,17 @@ call_function(PyObject ***pp_stack, int oparg
                 x = NULL;
             }
         }
+        else if (flags & METH_FASTCALL) {
+            /* The arguments are passed straight from the stack and
+               popped below */
+            _PyCFunctionFast meth = (_PyCFunctionFast)PyCFunction_GET_FUNCTION(func);
+            PyObject *self = PyCFunction_GET_SELF(func);
+            READ_TIMESTAMP(*pintr0);
+            C_TRACE(x, (*meth)(self, (*pp_stack) - na, na));
+            READ_TIMESTAMP(*pintr1);
+
+            x = _Py_CheckFunctionResult(func, x, NULL);
+        }
         else {
             PyObject *callargs;
             callargs = load_args(pp_stack, na);
@@ -5273,6 +5938,7 @@ unicode_concatenate(PyObject *v, PyObject *w,
          */
         switch (*next_instr) {
         case STORE_FAST:
+        case STORE_FAST__LOAD_FAST:
         {
             int oparg = PEEKARG();
             PyObject **fastlocals = f->f_localsplus;
@@ -5352,3 +6018,35 @@ _Py_GetDXProfile(PyObject *self, PyObject *args)
 }
 
 #endif
+
+/* sys._getquickenstats(): a dict mapping the name of each specialized
+   opcode to a (hits, misses) tuple */
+PyObject *
+_PyEval_GetQuickenStats(PyObject *self, PyObject *unused)
+{
+    static const struct {
+        int op;
+        const char *name;
+    } specialized[] = {
+        {BINARY_ADD_TAGGED_INT, "BINARY_ADD_TAGGED_INT"},
+        {LOAD_ATTR_INSTANCE_DICT, "LOAD_ATTR_INSTANCE_DICT"},
+        {LOAD_GLOBAL_CACHED, "LOAD_GLOBAL_CACHED"},
+        {COMPARE_OP_FLOAT, "COMPARE_OP_FLOAT"},
+    };
+    PyObject *d = PyDict_New();
+    size_t i;
+
+    if (d == NULL)
+        return NULL;
+    for (i = 0; i < Py_ARRAY_LENGTH(specialized); i++) {
+        unsigned long *counts = quicken_stats[specialized[i].op];
+        PyObject *v = Py_BuildValue("(kk)", counts[0], counts[1]);
+        if (v == NULL || PyDict_SetItemString(d, specialized[i].name, v) < 0) {
+            Py_XDECREF(v);
+            Py_DECREF(d);
+            return NULL;
+        }
+        Py_DECREF(v);
+    }
+    return d;
+}
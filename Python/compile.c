@@ -886,6 +886,7 @@ PyCompile_OpcodeStackEffect(int opcode, int oparg)
         case BINARY_MATRIX_MULTIPLY:
         case BINARY_MODULO:
         case BINARY_ADD:
+        case BINARY_ADD_TAGGED_INT:
         case BINARY_SUBTRACT:
         case BINARY_SUBSCR:
         case BINARY_FLOOR_DIVIDE:
@@ -987,8 +988,13 @@ PyCompile_OpcodeStackEffect(int opcode, int oparg)
         case BUILD_MAP:
             return 1 - 2*oparg;
         case LOAD_ATTR:
+        case LOAD_ATTR_INSTANCE_DICT:
             return 0;
+        case LOAD_METHOD:
+            return 1;
         case COMPARE_OP:
+        case COMPARE_OP_FLOAT:
+        case COMPARE_OP__POP_JUMP_IF_FALSE:
             return -1;
         case IMPORT_NAME:
             return -1;
@@ -1006,6 +1012,7 @@ PyCompile_OpcodeStackEffect(int opcode, int oparg)
             return -1;
 
         case LOAD_GLOBAL:
+        case LOAD_GLOBAL_CACHED:
             return 1;
 
         case CONTINUE_LOOP:
@@ -1017,9 +1024,14 @@ PyCompile_OpcodeStackEffect(int opcode, int oparg)
             return 6; /* can push 3 values for the new exception
                 + 3 others for the previous exception state */
 
+        /* A superinstruction counts as its first instruction, since the
+           second one is still in the code after it */
         case LOAD_FAST:
+        case LOAD_FAST__LOAD_FAST:
+        case LOAD_FAST__LOAD_ATTR:
             return 1;
         case STORE_FAST:
+        case STORE_FAST__LOAD_FAST:
             return -1;
         case DELETE_FAST:
             return 0;
@@ -1029,6 +1041,8 @@ PyCompile_OpcodeStackEffect(int opcode, int oparg)
 #define NARGS(o) (((o) % 256) + 2*(((o) / 256) % 256))
         case CALL_FUNCTION:
             return -NARGS(oparg);
+        case CALL_METHOD:
+            return -NARGS(oparg)-1;
         case CALL_FUNCTION_VAR:
         case CALL_FUNCTION_KW:
             return -NARGS(oparg)-1;
@@ -3160,9 +3174,49 @@ compiler_compare(struct compiler *c, expr_ty e)
     return 1;
 }
 
+/* Compile obj.name(args) as LOAD_METHOD and CALL_METHOD, which do not
+   need a bound method object.  Returns -1 if the call has another form
+   (or * or ** arguments, or too many positional arguments to add self),
+   else 1 on success and 0 on error. */
+static int
+maybe_optimize_method_call(struct compiler *c, expr_ty e)
+{
+    Py_ssize_t argsl, kwdsl, i;
+    expr_ty meth = e->v.Call.func;
+    asdl_seq *args = e->v.Call.args;
+    asdl_seq *kwds = e->v.Call.keywords;
+
+    if (meth->kind != Attribute_kind || meth->v.Attribute.ctx != Load)
+        return -1;
+    argsl = asdl_seq_LEN(args);
+    kwdsl = asdl_seq_LEN(kwds);
+    if (argsl >= 255)
+        return -1;
+    for (i = 0; i < argsl; i++) {
+        expr_ty elt = asdl_seq_GET(args, i);
+        if (elt->kind == Starred_kind)
+            return -1;
+    }
+    for (i = 0; i < kwdsl; i++) {
+        keyword_ty kw = asdl_seq_GET(kwds, i);
+        if (kw->arg == NULL)
+            return -1;
+    }
+
+    VISIT(c, expr, meth->v.Attribute.value);
+    ADDOP_NAME(c, LOAD_METHOD, meth->v.Attribute.attr, names);
+    VISIT_SEQ(c, expr, args);
+    VISIT_SEQ(c, keyword, kwds);
+    ADDOP_I(c, CALL_METHOD, argsl | (kwdsl << 8));
+    return 1;
+}
+
 static int
 compiler_call(struct compiler *c, expr_ty e)
 {
+    int ret = maybe_optimize_method_call(c, e);
+    if (ret >= 0)
+        return ret;
     VISIT(c, expr, e->v.Call.func);
     return compiler_call_helper(c, 0,
                                 e->v.Call.args,
@@ -69,10 +69,10 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,0,0,0,0,3,0,0,0,7,0,0,0,67,
     0,0,0,115,92,0,0,0,120,66,0,100,1,0,100,2,
     0,100,3,0,100,4,0,103,4,0,68,93,46,0,125,2,
-    0,116,0,0,124,1,0,124,2,0,131,2,0,114,19,0,
-    116,1,0,124,0,0,124,2,0,116,2,0,124,1,0,124,
-    2,0,131,2,0,131,3,0,1,113,19,0,87,124,0,0,
-    106,3,0,106,4,0,124,1,0,106,3,0,131,1,0,1,
+    0,116,0,0,165,1,0,124,2,0,131,2,0,114,19,0,
+    116,1,0,165,0,0,124,2,0,116,2,0,165,1,0,124,
+    2,0,131,2,0,131,3,0,1,113,19,0,87,166,0,0,
+    106,3,0,160,4,0,166,1,0,106,3,0,161,1,0,1,
     100,5,0,83,41,6,122,47,83,105,109,112,108,101,32,115,
     117,98,115,116,105,116,117,116,101,32,102,111,114,32,102,117,
     110,99,116,111,111,108,115,46,117,112,100,97,116,101,95,119,
@@ -106,7 +106,7 @@ const unsigned char _Py_M__importlib[] = {
     102,32,115,121,115,46,109,111,100,117,108,101,115,32,102,111,
     114,32,108,111,97,100,95,109,111,100,117,108,101,40,41,46,
     99,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,
-    0,67,0,0,0,115,13,0,0,0,124,1,0,124,0,0,
+    0,67,0,0,0,115,13,0,0,0,165,1,0,124,0,0,
     95,0,0,100,0,0,83,41,1,78,41,1,218,5,95,110,
     97,109,101,41,2,218,4,115,101,108,102,114,15,0,0,0,
     114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,218,
@@ -114,7 +114,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,1,122,22,95,77,97,110,97,103,101,82,101,108,
     111,97,100,46,95,95,105,110,105,116,95,95,99,1,0,0,
     0,0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,
-    0,115,25,0,0,0,124,0,0,106,0,0,116,1,0,106,
+    0,115,25,0,0,0,166,0,0,106,0,0,116,1,0,106,
     2,0,107,6,0,124,0,0,95,3,0,100,0,0,83,41,
     1,78,41,4,114,18,0,0,0,114,14,0,0,0,218,7,
     109,111,100,117,108,101,115,218,10,95,105,115,95,114,101,108,
@@ -125,13 +125,13 @@ const unsigned char _Py_M__importlib[] = {
     95,101,110,116,101,114,95,95,99,1,0,0,0,0,0,0,
     0,2,0,0,0,11,0,0,0,71,0,0,0,115,77,0,
     0,0,116,0,0,100,1,0,100,2,0,132,0,0,124,1,
-    0,68,131,1,0,131,1,0,114,73,0,124,0,0,106,1,
-    0,12,114,73,0,121,17,0,116,2,0,106,3,0,124,0,
-    0,106,4,0,61,87,110,18,0,4,116,5,0,107,10,0,
+    0,68,131,1,0,131,1,0,114,73,0,166,0,0,106,1,
+    0,12,114,73,0,121,17,0,116,2,0,106,3,0,166,0,
+    0,106,4,0,61,87,110,18,0,4,116,5,0,168,10,0,
     114,72,0,1,1,1,89,110,1,0,88,100,0,0,83,41,
     3,78,99,1,0,0,0,0,0,0,0,2,0,0,0,3,
     0,0,0,115,0,0,0,115,27,0,0,0,124,0,0,93,
-    17,0,125,1,0,124,1,0,100,0,0,107,9,0,86,1,
+    17,0,167,1,0,124,1,0,100,0,0,107,9,0,86,1,
     113,3,0,100,0,0,83,41,1,78,114,10,0,0,0,41,
     2,218,2,46,48,218,3,97,114,103,114,10,0,0,0,114,
     10,0,0,0,114,11,0,0,0,250,9,60,103,101,110,101,
@@ -178,9 +178,9 @@ const unsigned char _Py_M__importlib[] = {
     32,116,111,10,32,32,32,32,116,97,107,101,32,108,111,99,
     107,115,32,66,32,116,104,101,110,32,65,41,46,10,32,32,
     32,32,99,2,0,0,0,0,0,0,0,2,0,0,0,2,
-    0,0,0,67,0,0,0,115,70,0,0,0,116,0,0,106,
-    1,0,131,0,0,124,0,0,95,2,0,116,0,0,106,1,
-    0,131,0,0,124,0,0,95,3,0,124,1,0,124,0,0,
+    0,0,0,67,0,0,0,115,70,0,0,0,116,0,0,160,
+    1,0,161,0,0,124,0,0,95,2,0,116,0,0,160,1,
+    0,161,0,0,124,0,0,95,3,0,165,1,0,124,0,0,
     95,4,0,100,0,0,124,0,0,95,5,0,100,1,0,124,
     0,0,95,6,0,100,1,0,124,0,0,95,7,0,100,0,
     0,83,41,2,78,233,0,0,0,0,41,8,218,7,95,116,
@@ -193,12 +193,12 @@ const unsigned char _Py_M__importlib[] = {
     0,0,115,12,0,0,0,0,1,15,1,15,1,9,1,9,
     1,9,1,122,20,95,77,111,100,117,108,101,76,111,99,107,
     46,95,95,105,110,105,116,95,95,99,1,0,0,0,0,0,
-    0,0,4,0,0,0,2,0,0,0,67,0,0,0,115,88,
-    0,0,0,116,0,0,106,1,0,131,0,0,125,1,0,124,
-    0,0,106,2,0,125,2,0,120,60,0,116,3,0,106,4,
-    0,124,2,0,131,1,0,125,3,0,124,3,0,100,0,0,
-    107,8,0,114,55,0,100,1,0,83,124,3,0,106,2,0,
-    125,2,0,124,2,0,124,1,0,107,2,0,114,24,0,100,
+    0,0,4,0,0,0,3,0,0,0,67,0,0,0,115,88,
+    0,0,0,116,0,0,160,1,0,161,0,0,167,1,0,124,
+    0,0,106,2,0,125,2,0,120,60,0,116,3,0,160,4,
+    0,124,2,0,161,1,0,167,3,0,124,3,0,100,0,0,
+    168,8,0,114,55,0,100,1,0,83,166,3,0,106,2,0,
+    167,2,0,124,2,0,124,1,0,168,2,0,114,24,0,100,
     2,0,83,113,24,0,87,100,0,0,83,41,3,78,70,84,
     41,5,114,34,0,0,0,218,9,103,101,116,95,105,100,101,
     110,116,114,37,0,0,0,218,12,95,98,108,111,99,107,105,
@@ -210,19 +210,19 @@ const unsigned char _Py_M__importlib[] = {
     1,4,1,9,1,12,1,122,24,95,77,111,100,117,108,101,
     76,111,99,107,46,104,97,115,95,100,101,97,100,108,111,99,
     107,99,1,0,0,0,0,0,0,0,2,0,0,0,16,0,
-    0,0,67,0,0,0,115,210,0,0,0,116,0,0,106,1,
-    0,131,0,0,125,1,0,124,0,0,116,2,0,124,1,0,
-    60,122,173,0,120,166,0,124,0,0,106,3,0,143,124,0,
-    1,124,0,0,106,4,0,100,1,0,107,2,0,115,68,0,
-    124,0,0,106,5,0,124,1,0,107,2,0,114,96,0,124,
+    0,0,67,0,0,0,115,210,0,0,0,116,0,0,160,1,
+    0,161,0,0,167,1,0,124,0,0,116,2,0,124,1,0,
+    60,122,173,0,120,166,0,166,0,0,106,3,0,143,124,0,
+    1,166,0,0,106,4,0,100,1,0,107,2,0,115,68,0,
+    166,0,0,106,5,0,124,1,0,168,2,0,114,96,0,165,
     1,0,124,0,0,95,5,0,124,0,0,4,106,4,0,100,
-    2,0,55,2,95,4,0,100,3,0,83,124,0,0,106,6,
-    0,131,0,0,114,124,0,116,7,0,100,4,0,124,0,0,
-    22,131,1,0,130,1,0,124,0,0,106,8,0,106,9,0,
-    100,5,0,131,1,0,114,157,0,124,0,0,4,106,10,0,
-    100,2,0,55,2,95,10,0,87,100,6,0,81,82,88,124,
-    0,0,106,8,0,106,9,0,131,0,0,1,124,0,0,106,
-    8,0,106,11,0,131,0,0,1,113,28,0,87,87,100,6,
+    2,0,55,2,95,4,0,100,3,0,83,124,0,0,160,6,
+    0,161,0,0,114,124,0,116,7,0,100,4,0,124,0,0,
+    22,131,1,0,130,1,0,166,0,0,106,8,0,160,9,0,
+    100,5,0,161,1,0,114,157,0,124,0,0,4,106,10,0,
+    100,2,0,55,2,95,10,0,87,100,6,0,81,82,88,166,
+    0,0,106,8,0,160,9,0,161,0,0,1,166,0,0,106,
+    8,0,160,11,0,161,0,0,1,113,28,0,87,87,100,6,
     0,116,2,0,124,1,0,61,88,100,6,0,83,41,7,122,
     185,10,32,32,32,32,32,32,32,32,65,99,113,117,105,114,
     101,32,116,104,101,32,109,111,100,117,108,101,32,108,111,99,
@@ -250,15 +250,15 @@ const unsigned char _Py_M__importlib[] = {
     19,95,77,111,100,117,108,101,76,111,99,107,46,97,99,113,
     117,105,114,101,99,1,0,0,0,0,0,0,0,2,0,0,
     0,10,0,0,0,67,0,0,0,115,157,0,0,0,116,0,
-    0,106,1,0,131,0,0,125,1,0,124,0,0,106,2,0,
-    143,129,0,1,124,0,0,106,3,0,124,1,0,107,3,0,
-    114,49,0,116,4,0,100,1,0,131,1,0,130,1,0,124,
+    0,160,1,0,161,0,0,167,1,0,124,0,0,106,2,0,
+    143,129,0,1,166,0,0,106,3,0,124,1,0,168,3,0,
+    114,49,0,116,4,0,100,1,0,131,1,0,130,1,0,166,
     0,0,106,5,0,100,2,0,107,4,0,115,70,0,116,6,
     0,130,1,0,124,0,0,4,106,5,0,100,3,0,56,2,
-    95,5,0,124,0,0,106,5,0,100,2,0,107,2,0,114,
-    146,0,100,0,0,124,0,0,95,3,0,124,0,0,106,7,
+    95,5,0,166,0,0,106,5,0,100,2,0,168,2,0,114,
+    146,0,100,0,0,124,0,0,95,3,0,166,0,0,106,7,
     0,114,146,0,124,0,0,4,106,7,0,100,3,0,56,2,
-    95,7,0,124,0,0,106,8,0,106,9,0,131,0,0,1,
+    95,7,0,166,0,0,106,8,0,160,9,0,161,0,0,1,
     87,100,0,0,81,82,88,100,0,0,83,41,4,78,122,31,
     99,97,110,110,111,116,32,114,101,108,101,97,115,101,32,117,
     110,45,97,99,113,117,105,114,101,100,32,108,111,99,107,114,
@@ -273,9 +273,9 @@ const unsigned char _Py_M__importlib[] = {
     15,1,12,1,21,1,15,1,15,1,9,1,9,1,15,1,
     122,19,95,77,111,100,117,108,101,76,111,99,107,46,114,101,
     108,101,97,115,101,99,1,0,0,0,0,0,0,0,1,0,
-    0,0,4,0,0,0,67,0,0,0,115,25,0,0,0,100,
-    1,0,106,0,0,124,0,0,106,1,0,116,2,0,124,0,
-    0,131,1,0,131,2,0,83,41,2,78,122,23,95,77,111,
+    0,0,5,0,0,0,67,0,0,0,115,25,0,0,0,100,
+    1,0,160,0,0,166,0,0,106,1,0,116,2,0,124,0,
+    0,131,1,0,161,2,0,83,41,2,78,122,23,95,77,111,
     100,117,108,101,76,111,99,107,40,123,33,114,125,41,32,97,
     116,32,123,125,41,3,218,6,102,111,114,109,97,116,114,15,
     0,0,0,218,2,105,100,41,1,114,19,0,0,0,114,10,
@@ -303,7 +303,7 @@ const unsigned char _Py_M__importlib[] = {
     117,108,116,105,45,116,104,114,101,97,100,105,110,103,32,115,
     117,112,112,111,114,116,46,99,2,0,0,0,0,0,0,0,
     2,0,0,0,2,0,0,0,67,0,0,0,115,22,0,0,
-    0,124,1,0,124,0,0,95,0,0,100,1,0,124,0,0,
+    0,165,1,0,124,0,0,95,0,0,100,1,0,124,0,0,
     95,1,0,100,0,0,83,41,2,78,114,33,0,0,0,41,
     2,114,15,0,0,0,114,38,0,0,0,41,2,114,19,0,
     0,0,114,15,0,0,0,114,10,0,0,0,114,10,0,0,
@@ -319,8 +319,8 @@ const unsigned char _Py_M__importlib[] = {
     4,0,0,0,0,1,15,1,122,24,95,68,117,109,109,121,
     77,111,100,117,108,101,76,111,99,107,46,97,99,113,117,105,
     114,101,99,1,0,0,0,0,0,0,0,1,0,0,0,3,
-    0,0,0,67,0,0,0,115,46,0,0,0,124,0,0,106,
-    0,0,100,1,0,107,2,0,114,27,0,116,1,0,100,2,
+    0,0,0,67,0,0,0,115,46,0,0,0,166,0,0,106,
+    0,0,100,1,0,168,2,0,114,27,0,116,1,0,100,2,
     0,131,1,0,130,1,0,124,0,0,4,106,0,0,100,3,
     0,56,2,95,0,0,100,0,0,83,41,4,78,114,33,0,
     0,0,122,31,99,97,110,110,111,116,32,114,101,108,101,97,
@@ -331,9 +331,9 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,115,6,0,0,0,0,1,15,1,12,1,122,24,
     95,68,117,109,109,121,77,111,100,117,108,101,76,111,99,107,
     46,114,101,108,101,97,115,101,99,1,0,0,0,0,0,0,
-    0,1,0,0,0,4,0,0,0,67,0,0,0,115,25,0,
-    0,0,100,1,0,106,0,0,124,0,0,106,1,0,116,2,
-    0,124,0,0,131,1,0,131,2,0,83,41,2,78,122,28,
+    0,1,0,0,0,5,0,0,0,67,0,0,0,115,25,0,
+    0,0,100,1,0,160,0,0,166,0,0,106,1,0,116,2,
+    0,124,0,0,131,1,0,161,2,0,83,41,2,78,122,28,
     95,68,117,109,109,121,77,111,100,117,108,101,76,111,99,107,
     40,123,33,114,125,41,32,97,116,32,123,125,41,3,114,50,
     0,0,0,114,15,0,0,0,114,51,0,0,0,41,1,114,
@@ -354,7 +354,7 @@ const unsigned char _Py_M__importlib[] = {
     0,90,5,0,100,7,0,83,41,8,218,18,95,77,111,100,
     117,108,101,76,111,99,107,77,97,110,97,103,101,114,99,2,
     0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,67,
-    0,0,0,115,22,0,0,0,124,1,0,124,0,0,95,0,
+    0,0,0,115,22,0,0,0,165,1,0,124,0,0,95,0,
     0,100,0,0,124,0,0,95,1,0,100,0,0,83,41,1,
     78,41,2,114,18,0,0,0,218,5,95,108,111,99,107,41,
     2,114,19,0,0,0,114,15,0,0,0,114,10,0,0,0,
@@ -362,11 +362,11 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,115,4,0,0,0,0,1,9,1,122,27,95,77,
     111,100,117,108,101,76,111,99,107,77,97,110,97,103,101,114,
     46,95,95,105,110,105,116,95,95,99,1,0,0,0,0,0,
-    0,0,1,0,0,0,10,0,0,0,67,0,0,0,115,53,
-    0,0,0,122,22,0,116,0,0,124,0,0,106,1,0,131,
-    1,0,124,0,0,95,2,0,87,100,0,0,116,3,0,106,
-    4,0,131,0,0,1,88,124,0,0,106,2,0,106,5,0,
-    131,0,0,1,100,0,0,83,41,1,78,41,6,218,16,95,
+    0,0,1,0,0,0,11,0,0,0,67,0,0,0,115,53,
+    0,0,0,122,22,0,116,0,0,166,0,0,106,1,0,131,
+    1,0,124,0,0,95,2,0,87,100,0,0,116,3,0,160,
+    4,0,161,0,0,1,88,166,0,0,106,2,0,160,5,0,
+    161,0,0,1,100,0,0,83,41,1,78,41,6,218,16,95,
     103,101,116,95,109,111,100,117,108,101,95,108,111,99,107,114,
     18,0,0,0,114,55,0,0,0,218,4,95,105,109,112,218,
     12,114,101,108,101,97,115,101,95,108,111,99,107,114,46,0,
@@ -375,8 +375,8 @@ const unsigned char _Py_M__importlib[] = {
     0,115,8,0,0,0,0,1,3,1,22,2,11,1,122,28,
     95,77,111,100,117,108,101,76,111,99,107,77,97,110,97,103,
     101,114,46,95,95,101,110,116,101,114,95,95,99,1,0,0,
-    0,0,0,0,0,3,0,0,0,1,0,0,0,79,0,0,
-    0,115,17,0,0,0,124,0,0,106,0,0,106,1,0,131,
+    0,0,0,0,0,3,0,0,0,2,0,0,0,79,0,0,
+    0,115,17,0,0,0,166,0,0,106,0,0,160,1,0,161,
     0,0,1,100,0,0,83,41,1,78,41,2,114,55,0,0,
     0,114,47,0,0,0,41,3,114,19,0,0,0,114,29,0,
     0,0,90,6,107,119,97,114,103,115,114,10,0,0,0,114,
@@ -389,15 +389,15 @@ const unsigned char _Py_M__importlib[] = {
     0,114,10,0,0,0,114,11,0,0,0,114,54,0,0,0,
     157,0,0,0,115,6,0,0,0,12,2,12,4,12,7,114,
     54,0,0,0,99,1,0,0,0,0,0,0,0,3,0,0,
-    0,11,0,0,0,3,0,0,0,115,139,0,0,0,100,1,
+    0,12,0,0,0,3,0,0,0,115,139,0,0,0,100,1,
     0,125,1,0,121,17,0,116,0,0,136,0,0,25,131,0,
-    0,125,1,0,87,110,18,0,4,116,1,0,107,10,0,114,
+    0,125,1,0,87,110,18,0,4,116,1,0,168,10,0,114,
     43,0,1,1,1,89,110,1,0,88,124,1,0,100,1,0,
-    107,8,0,114,135,0,116,2,0,100,1,0,107,8,0,114,
+    168,8,0,114,135,0,116,2,0,100,1,0,168,8,0,114,
     83,0,116,3,0,136,0,0,131,1,0,125,1,0,110,12,
     0,116,4,0,136,0,0,131,1,0,125,1,0,135,0,0,
     102,1,0,100,2,0,100,3,0,134,0,0,125,2,0,116,
-    5,0,106,6,0,124,1,0,124,2,0,131,2,0,116,0,
+    5,0,160,6,0,165,1,0,124,2,0,161,2,0,116,0,
     0,136,0,0,60,124,1,0,83,41,4,122,109,71,101,116,
     32,111,114,32,99,114,101,97,116,101,32,116,104,101,32,109,
     111,100,117,108,101,32,108,111,99,107,32,102,111,114,32,97,
@@ -423,10 +423,10 @@ const unsigned char _Py_M__importlib[] = {
     1,15,2,12,1,18,2,22,1,114,56,0,0,0,99,1,
     0,0,0,0,0,0,0,2,0,0,0,11,0,0,0,67,
     0,0,0,115,71,0,0,0,116,0,0,124,0,0,131,1,
-    0,125,1,0,116,1,0,106,2,0,131,0,0,1,121,14,
-    0,124,1,0,106,3,0,131,0,0,1,87,110,18,0,4,
-    116,4,0,107,10,0,114,56,0,1,1,1,89,110,11,0,
-    88,124,1,0,106,5,0,131,0,0,1,100,1,0,83,41,
+    0,125,1,0,116,1,0,160,2,0,161,0,0,1,121,14,
+    0,124,1,0,160,3,0,161,0,0,1,87,110,18,0,4,
+    116,4,0,168,10,0,114,56,0,1,1,1,89,110,11,0,
+    88,124,1,0,160,5,0,161,0,0,1,100,1,0,83,41,
     2,97,21,1,0,0,82,101,108,101,97,115,101,32,116,104,
     101,32,103,108,111,98,97,108,32,105,109,112,111,114,116,32,
     108,111,99,107,44,32,97,110,100,32,97,99,113,117,105,114,
@@ -453,7 +453,7 @@ const unsigned char _Py_M__importlib[] = {
     115,14,0,0,0,0,7,12,1,10,1,3,1,14,1,13,
     3,5,2,114,63,0,0,0,99,1,0,0,0,0,0,0,
     0,3,0,0,0,3,0,0,0,79,0,0,0,115,13,0,
-    0,0,124,0,0,124,1,0,124,2,0,142,0,0,83,41,
+    0,0,165,0,0,124,1,0,124,2,0,142,0,0,83,41,
     1,97,46,1,0,0,114,101,109,111,118,101,95,105,109,112,
     111,114,116,108,105,98,95,102,114,97,109,101,115,32,105,110,
     32,105,109,112,111,114,116,46,99,32,119,105,108,108,32,97,
@@ -481,9 +481,9 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,218,9,118,101,114,98,111,115,105,116,121,114,45,
     0,0,0,99,1,0,0,0,1,0,0,0,3,0,0,0,
     4,0,0,0,71,0,0,0,115,75,0,0,0,116,0,0,
-    106,1,0,106,2,0,124,1,0,107,5,0,114,71,0,124,
-    0,0,106,3,0,100,6,0,131,1,0,115,43,0,100,3,
-    0,124,0,0,23,125,0,0,116,4,0,124,0,0,106,5,
+    106,1,0,106,2,0,124,1,0,168,5,0,114,71,0,124,
+    0,0,160,3,0,100,6,0,161,1,0,115,43,0,100,3,
+    0,124,0,0,23,125,0,0,116,4,0,166,0,0,106,5,
     0,124,2,0,140,0,0,100,4,0,116,0,0,106,6,0,
     131,1,1,1,100,5,0,83,41,7,122,61,80,114,105,110,
     116,32,116,104,101,32,109,101,115,115,97,103,101,32,116,111,
@@ -509,9 +509,9 @@ const unsigned char _Py_M__importlib[] = {
     100,117,108,101,32,105,115,32,98,117,105,108,116,45,105,110,
     46,99,2,0,0,0,0,0,0,0,2,0,0,0,4,0,
     0,0,19,0,0,0,115,55,0,0,0,124,1,0,116,0,
-    0,106,1,0,107,7,0,114,42,0,116,2,0,100,1,0,
-    106,3,0,124,1,0,131,1,0,100,2,0,124,1,0,131,
-    1,1,130,1,0,136,0,0,124,0,0,124,1,0,131,2,
+    0,106,1,0,168,7,0,114,42,0,116,2,0,100,1,0,
+    160,3,0,124,1,0,161,1,0,100,2,0,124,1,0,131,
+    1,1,130,1,0,136,0,0,165,0,0,124,1,0,131,2,
     0,83,41,3,78,122,29,123,33,114,125,32,105,115,32,110,
     111,116,32,97,32,98,117,105,108,116,45,105,110,32,109,111,
     100,117,108,101,114,15,0,0,0,41,4,114,14,0,0,0,
@@ -539,9 +539,9 @@ const unsigned char _Py_M__importlib[] = {
     110,97,109,101,100,32,109,111,100,117,108,101,32,105,115,32,
     102,114,111,122,101,110,46,99,2,0,0,0,0,0,0,0,
     2,0,0,0,4,0,0,0,19,0,0,0,115,55,0,0,
-    0,116,0,0,106,1,0,124,1,0,131,1,0,115,42,0,
-    116,2,0,100,1,0,106,3,0,124,1,0,131,1,0,100,
-    2,0,124,1,0,131,1,1,130,1,0,136,0,0,124,0,
+    0,116,0,0,160,1,0,124,1,0,161,1,0,115,42,0,
+    116,2,0,100,1,0,160,3,0,124,1,0,161,1,0,100,
+    2,0,124,1,0,131,1,1,130,1,0,136,0,0,165,0,
     0,124,1,0,131,2,0,83,41,3,78,122,27,123,33,114,
     125,32,105,115,32,110,111,116,32,97,32,102,114,111,122,101,
     110,32,109,111,100,117,108,101,114,15,0,0,0,41,4,114,
@@ -560,10 +560,10 @@ const unsigned char _Py_M__importlib[] = {
     105,114,101,115,95,102,114,111,122,101,110,244,0,0,0,115,
     6,0,0,0,0,2,18,5,13,1,114,84,0,0,0,99,
     2,0,0,0,0,0,0,0,4,0,0,0,3,0,0,0,
-    67,0,0,0,115,81,0,0,0,116,0,0,124,1,0,124,
-    0,0,131,2,0,125,2,0,124,1,0,116,1,0,106,2,
-    0,107,6,0,114,67,0,116,1,0,106,2,0,124,1,0,
-    25,125,3,0,116,3,0,124,2,0,124,3,0,131,2,0,
+    67,0,0,0,115,81,0,0,0,116,0,0,165,1,0,124,
+    0,0,131,2,0,167,2,0,124,1,0,116,1,0,106,2,
+    0,168,6,0,114,67,0,116,1,0,106,2,0,124,1,0,
+    25,125,3,0,116,3,0,165,2,0,124,3,0,131,2,0,
     1,116,1,0,106,2,0,124,1,0,25,83,116,4,0,124,
     2,0,131,1,0,83,100,1,0,83,41,2,122,128,76,111,
     97,100,32,116,104,101,32,115,112,101,99,105,102,105,101,100,
@@ -582,24 +582,24 @@ const unsigned char _Py_M__importlib[] = {
     11,0,0,0,218,17,95,108,111,97,100,95,109,111,100,117,
     108,101,95,115,104,105,109,0,1,0,0,115,12,0,0,0,
     0,6,15,1,15,1,13,1,13,1,11,2,114,90,0,0,
-    0,99,1,0,0,0,0,0,0,0,5,0,0,0,35,0,
+    0,99,1,0,0,0,0,0,0,0,5,0,0,0,36,0,
     0,0,67,0,0,0,115,6,1,0,0,116,0,0,124,0,
     0,100,1,0,100,0,0,131,3,0,125,1,0,116,1,0,
     124,1,0,100,2,0,131,2,0,114,71,0,121,17,0,124,
-    1,0,106,2,0,124,0,0,131,1,0,83,87,110,18,0,
-    4,116,3,0,107,10,0,114,70,0,1,1,1,89,110,1,
-    0,88,121,13,0,124,0,0,106,4,0,125,2,0,87,110,
-    18,0,4,116,5,0,107,10,0,114,104,0,1,1,1,89,
-    110,23,0,88,124,2,0,100,0,0,107,9,0,114,127,0,
-    116,6,0,124,2,0,131,1,0,83,121,13,0,124,0,0,
-    106,7,0,125,3,0,87,110,24,0,4,116,5,0,107,10,
+    1,0,160,2,0,124,0,0,161,1,0,83,87,110,18,0,
+    4,116,3,0,168,10,0,114,70,0,1,1,1,89,110,1,
+    0,88,121,13,0,166,0,0,106,4,0,125,2,0,87,110,
+    18,0,4,116,5,0,168,10,0,114,104,0,1,1,1,89,
+    110,23,0,88,124,2,0,100,0,0,168,9,0,114,127,0,
+    116,6,0,124,2,0,131,1,0,83,121,13,0,166,0,0,
+    106,7,0,125,3,0,87,110,24,0,4,116,5,0,168,10,
     0,114,166,0,1,1,1,100,3,0,125,3,0,89,110,1,
-    0,88,121,13,0,124,0,0,106,8,0,125,4,0,87,110,
-    59,0,4,116,5,0,107,10,0,114,241,0,1,1,1,124,
-    1,0,100,0,0,107,8,0,114,221,0,100,4,0,106,9,
-    0,124,3,0,131,1,0,83,100,5,0,106,9,0,124,3,
-    0,124,1,0,131,2,0,83,89,110,17,0,88,100,6,0,
-    106,9,0,124,3,0,124,4,0,131,2,0,83,100,0,0,
+    0,88,121,13,0,166,0,0,106,8,0,125,4,0,87,110,
+    59,0,4,116,5,0,168,10,0,114,241,0,1,1,1,124,
+    1,0,100,0,0,168,8,0,114,221,0,100,4,0,160,9,
+    0,124,3,0,161,1,0,83,100,5,0,160,9,0,165,3,
+    0,124,1,0,161,2,0,83,89,110,17,0,88,100,6,0,
+    160,9,0,165,3,0,124,4,0,161,2,0,83,100,0,0,
     83,41,7,78,218,10,95,95,108,111,97,100,101,114,95,95,
     218,11,109,111,100,117,108,101,95,114,101,112,114,250,1,63,
     122,13,60,109,111,100,117,108,101,32,123,33,114,125,62,122,
@@ -627,8 +627,8 @@ const unsigned char _Py_M__importlib[] = {
     132,0,0,90,5,0,100,7,0,83,41,8,218,17,95,105,
     110,115,116,97,108,108,101,100,95,115,97,102,101,108,121,99,
     2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,
-    67,0,0,0,115,25,0,0,0,124,1,0,124,0,0,95,
-    0,0,124,1,0,106,1,0,124,0,0,95,2,0,100,0,
+    67,0,0,0,115,25,0,0,0,165,1,0,124,0,0,95,
+    0,0,166,1,0,106,1,0,124,0,0,95,2,0,100,0,
     0,83,41,1,78,41,3,218,7,95,109,111,100,117,108,101,
     114,95,0,0,0,218,5,95,115,112,101,99,41,2,114,19,
     0,0,0,114,89,0,0,0,114,10,0,0,0,114,10,0,
@@ -637,8 +637,8 @@ const unsigned char _Py_M__importlib[] = {
     97,108,108,101,100,95,115,97,102,101,108,121,46,95,95,105,
     110,105,116,95,95,99,1,0,0,0,0,0,0,0,1,0,
     0,0,3,0,0,0,67,0,0,0,115,38,0,0,0,100,
-    1,0,124,0,0,106,0,0,95,1,0,124,0,0,106,2,
-    0,116,3,0,106,4,0,124,0,0,106,0,0,106,5,0,
+    1,0,166,0,0,106,0,0,95,1,0,166,0,0,106,2,
+    0,116,3,0,106,4,0,166,0,0,106,0,0,106,5,0,
     60,100,0,0,83,41,2,78,84,41,6,114,104,0,0,0,
     218,13,95,105,110,105,116,105,97,108,105,122,105,110,103,114,
     103,0,0,0,114,14,0,0,0,114,21,0,0,0,114,15,
@@ -648,16 +648,16 @@ const unsigned char _Py_M__importlib[] = {
     115,116,97,108,108,101,100,95,115,97,102,101,108,121,46,95,
     95,101,110,116,101,114,95,95,99,1,0,0,0,0,0,0,
     0,3,0,0,0,17,0,0,0,71,0,0,0,115,121,0,
-    0,0,122,101,0,124,0,0,106,0,0,125,2,0,116,1,
+    0,0,122,101,0,166,0,0,106,0,0,125,2,0,116,1,
     0,100,1,0,100,2,0,132,0,0,124,1,0,68,131,1,
     0,131,1,0,114,78,0,121,17,0,116,2,0,106,3,0,
-    124,2,0,106,4,0,61,87,113,100,0,4,116,5,0,107,
+    166,2,0,106,4,0,61,87,113,100,0,4,116,5,0,168,
     10,0,114,74,0,1,1,1,89,113,100,0,88,110,22,0,
-    116,6,0,100,3,0,124,2,0,106,4,0,124,2,0,106,
-    7,0,131,3,0,1,87,100,0,0,100,4,0,124,0,0,
+    116,6,0,100,3,0,166,2,0,106,4,0,166,2,0,106,
+    7,0,131,3,0,1,87,100,0,0,100,4,0,166,0,0,
     106,0,0,95,8,0,88,100,0,0,83,41,5,78,99,1,
     0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,115,
-    0,0,0,115,27,0,0,0,124,0,0,93,17,0,125,1,
+    0,0,0,115,27,0,0,0,124,0,0,93,17,0,167,1,
     0,124,1,0,100,0,0,107,9,0,86,1,113,3,0,100,
     0,0,83,41,1,78,114,10,0,0,0,41,2,114,24,0,
     0,0,114,25,0,0,0,114,10,0,0,0,114,10,0,0,
@@ -790,9 +790,9 @@ const unsigned char _Py_M__importlib[] = {
     105,103,105,110,78,218,12,108,111,97,100,101,114,95,115,116,
     97,116,101,218,10,105,115,95,112,97,99,107,97,103,101,99,
     3,0,0,0,3,0,0,0,6,0,0,0,2,0,0,0,
-    67,0,0,0,115,79,0,0,0,124,1,0,124,0,0,95,
-    0,0,124,2,0,124,0,0,95,1,0,124,3,0,124,0,
-    0,95,2,0,124,4,0,124,0,0,95,3,0,124,5,0,
+    67,0,0,0,115,79,0,0,0,165,1,0,124,0,0,95,
+    0,0,165,2,0,124,0,0,95,1,0,165,3,0,124,0,
+    0,95,2,0,165,4,0,124,0,0,95,3,0,124,5,0,
     114,48,0,103,0,0,110,3,0,100,0,0,124,0,0,95,
     4,0,100,1,0,124,0,0,95,5,0,100,0,0,124,0,
     0,95,6,0,100,0,0,83,41,2,78,70,41,7,114,15,
@@ -807,16 +807,16 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,0,2,9,1,9,1,9,1,9,1,21,3,9,
     1,122,19,77,111,100,117,108,101,83,112,101,99,46,95,95,
     105,110,105,116,95,95,99,1,0,0,0,0,0,0,0,2,
-    0,0,0,4,0,0,0,67,0,0,0,115,147,0,0,0,
-    100,1,0,106,0,0,124,0,0,106,1,0,131,1,0,100,
-    2,0,106,0,0,124,0,0,106,2,0,131,1,0,103,2,
-    0,125,1,0,124,0,0,106,3,0,100,0,0,107,9,0,
-    114,76,0,124,1,0,106,4,0,100,3,0,106,0,0,124,
-    0,0,106,3,0,131,1,0,131,1,0,1,124,0,0,106,
-    5,0,100,0,0,107,9,0,114,116,0,124,1,0,106,4,
-    0,100,4,0,106,0,0,124,0,0,106,5,0,131,1,0,
-    131,1,0,1,100,5,0,106,0,0,124,0,0,106,6,0,
-    106,7,0,100,6,0,106,8,0,124,1,0,131,1,0,131,
+    0,0,0,6,0,0,0,67,0,0,0,115,147,0,0,0,
+    100,1,0,160,0,0,166,0,0,106,1,0,161,1,0,100,
+    2,0,160,0,0,166,0,0,106,2,0,161,1,0,103,2,
+    0,167,1,0,124,0,0,106,3,0,100,0,0,168,9,0,
+    114,76,0,124,1,0,160,4,0,100,3,0,160,0,0,166,
+    0,0,106,3,0,161,1,0,161,1,0,1,166,0,0,106,
+    5,0,100,0,0,168,9,0,114,116,0,124,1,0,160,4,
+    0,100,4,0,160,0,0,166,0,0,106,5,0,161,1,0,
+    161,1,0,1,100,5,0,160,0,0,166,0,0,106,6,0,
+    106,7,0,100,6,0,160,8,0,124,1,0,161,1,0,161,
     2,0,83,41,7,78,122,9,110,97,109,101,61,123,33,114,
     125,122,11,108,111,97,100,101,114,61,123,33,114,125,122,11,
     111,114,105,103,105,110,61,123,33,114,125,122,29,115,117,98,
@@ -832,15 +832,15 @@ const unsigned char _Py_M__importlib[] = {
     25,1,15,1,12,1,13,1,122,19,77,111,100,117,108,101,
     83,112,101,99,46,95,95,114,101,112,114,95,95,99,2,0,
     0,0,0,0,0,0,3,0,0,0,11,0,0,0,67,0,
-    0,0,115,145,0,0,0,124,0,0,106,0,0,125,2,0,
-    121,107,0,124,0,0,106,1,0,124,1,0,106,1,0,107,
-    2,0,111,114,0,124,0,0,106,2,0,124,1,0,106,2,
-    0,107,2,0,111,114,0,124,0,0,106,3,0,124,1,0,
-    106,3,0,107,2,0,111,114,0,124,2,0,124,1,0,106,
-    0,0,107,2,0,111,114,0,124,0,0,106,4,0,124,1,
-    0,106,4,0,107,2,0,111,114,0,124,0,0,106,5,0,
-    124,1,0,106,5,0,107,2,0,83,87,110,22,0,4,116,
-    6,0,107,10,0,114,140,0,1,1,1,100,1,0,83,89,
+    0,0,115,145,0,0,0,166,0,0,106,0,0,125,2,0,
+    121,107,0,166,0,0,106,1,0,166,1,0,106,1,0,107,
+    2,0,111,114,0,166,0,0,106,2,0,166,1,0,106,2,
+    0,107,2,0,111,114,0,166,0,0,106,3,0,166,1,0,
+    106,3,0,107,2,0,111,114,0,165,2,0,124,1,0,106,
+    0,0,107,2,0,111,114,0,166,0,0,106,4,0,166,1,
+    0,106,4,0,107,2,0,111,114,0,166,0,0,106,5,0,
+    166,1,0,106,5,0,107,2,0,83,87,110,22,0,4,116,
+    6,0,168,10,0,114,140,0,1,1,1,100,1,0,83,89,
     110,1,0,88,100,0,0,83,41,2,78,70,41,7,114,110,
     0,0,0,114,15,0,0,0,114,99,0,0,0,114,107,0,
     0,0,218,6,99,97,99,104,101,100,218,12,104,97,115,95,
@@ -851,13 +851,13 @@ const unsigned char _Py_M__importlib[] = {
     0,0,1,9,1,3,1,18,1,18,1,18,1,15,1,18,
     1,20,1,13,1,122,17,77,111,100,117,108,101,83,112,101,
     99,46,95,95,101,113,95,95,99,1,0,0,0,0,0,0,
-    0,1,0,0,0,2,0,0,0,67,0,0,0,115,85,0,
-    0,0,124,0,0,106,0,0,100,0,0,107,8,0,114,78,
-    0,124,0,0,106,1,0,100,0,0,107,9,0,114,78,0,
-    124,0,0,106,2,0,114,78,0,116,3,0,100,0,0,107,
-    8,0,114,57,0,116,4,0,130,1,0,116,3,0,106,5,
-    0,124,0,0,106,1,0,131,1,0,124,0,0,95,0,0,
-    124,0,0,106,0,0,83,41,1,78,41,6,114,112,0,0,
+    0,1,0,0,0,3,0,0,0,67,0,0,0,115,85,0,
+    0,0,166,0,0,106,0,0,100,0,0,168,8,0,114,78,
+    0,166,0,0,106,1,0,100,0,0,168,9,0,114,78,0,
+    166,0,0,106,2,0,114,78,0,116,3,0,100,0,0,168,
+    8,0,114,57,0,116,4,0,130,1,0,116,3,0,160,5,
+    0,166,0,0,106,1,0,161,1,0,124,0,0,95,0,0,
+    166,0,0,106,0,0,83,41,1,78,41,6,114,112,0,0,
     0,114,107,0,0,0,114,111,0,0,0,218,19,95,98,111,
     111,116,115,116,114,97,112,95,101,120,116,101,114,110,97,108,
     218,19,78,111,116,73,109,112,108,101,109,101,110,116,101,100,
@@ -867,15 +867,15 @@ const unsigned char _Py_M__importlib[] = {
     0,115,12,0,0,0,0,2,15,1,24,1,12,1,6,1,
     21,1,122,17,77,111,100,117,108,101,83,112,101,99,46,99,
     97,99,104,101,100,99,2,0,0,0,0,0,0,0,2,0,
-    0,0,2,0,0,0,67,0,0,0,115,13,0,0,0,124,
+    0,0,2,0,0,0,67,0,0,0,115,13,0,0,0,165,
     1,0,124,0,0,95,0,0,100,0,0,83,41,1,78,41,
     1,114,112,0,0,0,41,2,114,19,0,0,0,114,116,0,
     0,0,114,10,0,0,0,114,10,0,0,0,114,11,0,0,
     0,114,116,0,0,0,159,1,0,0,115,2,0,0,0,0,
-    2,99,1,0,0,0,0,0,0,0,1,0,0,0,2,0,
-    0,0,67,0,0,0,115,46,0,0,0,124,0,0,106,0,
-    0,100,1,0,107,8,0,114,35,0,124,0,0,106,1,0,
-    106,2,0,100,2,0,131,1,0,100,3,0,25,83,124,0,
+    2,99,1,0,0,0,0,0,0,0,1,0,0,0,3,0,
+    0,0,67,0,0,0,115,46,0,0,0,166,0,0,106,0,
+    0,100,1,0,168,8,0,114,35,0,166,0,0,106,1,0,
+    160,2,0,100,2,0,161,1,0,100,3,0,25,83,166,0,
     0,106,1,0,83,100,1,0,83,41,4,122,32,84,104,101,
     32,110,97,109,101,32,111,102,32,116,104,101,32,109,111,100,
     117,108,101,39,115,32,112,97,114,101,110,116,46,78,218,1,
@@ -886,7 +886,7 @@ const unsigned char _Py_M__importlib[] = {
     115,6,0,0,0,0,3,15,1,20,2,122,17,77,111,100,
     117,108,101,83,112,101,99,46,112,97,114,101,110,116,99,1,
     0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,67,
-    0,0,0,115,7,0,0,0,124,0,0,106,0,0,83,41,
+    0,0,0,115,7,0,0,0,166,0,0,106,0,0,83,41,
     1,78,41,1,114,111,0,0,0,41,1,114,19,0,0,0,
     114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,114,
     117,0,0,0,171,1,0,0,115,2,0,0,0,0,2,122,
@@ -909,18 +909,18 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,114,107,0,0,0,114,109,0,0,0,99,2,0,
     0,0,2,0,0,0,6,0,0,0,15,0,0,0,67,0,
     0,0,115,217,0,0,0,116,0,0,124,1,0,100,1,0,
-    131,2,0,114,110,0,116,1,0,100,2,0,107,8,0,114,
-    33,0,116,2,0,130,1,0,116,1,0,106,3,0,125,4,
-    0,124,3,0,100,2,0,107,8,0,114,70,0,124,4,0,
+    131,2,0,114,110,0,116,1,0,100,2,0,168,8,0,114,
+    33,0,116,2,0,130,1,0,116,1,0,106,3,0,167,4,
+    0,124,3,0,100,2,0,168,8,0,114,70,0,165,4,0,
     124,0,0,100,3,0,124,1,0,131,1,1,83,124,3,0,
-    114,82,0,103,0,0,110,3,0,100,2,0,125,5,0,124,
+    114,82,0,103,0,0,110,3,0,100,2,0,167,5,0,124,
     4,0,124,0,0,100,3,0,124,1,0,100,4,0,124,5,
-    0,131,1,2,83,124,3,0,100,2,0,107,8,0,114,192,
+    0,131,1,2,83,124,3,0,100,2,0,168,8,0,114,192,
     0,116,0,0,124,1,0,100,5,0,131,2,0,114,186,0,
-    121,19,0,124,1,0,106,4,0,124,0,0,131,1,0,125,
-    3,0,87,113,192,0,4,116,5,0,107,10,0,114,182,0,
+    121,19,0,124,1,0,160,4,0,124,0,0,161,1,0,125,
+    3,0,87,113,192,0,4,116,5,0,168,10,0,114,182,0,
     1,1,1,100,2,0,125,3,0,89,113,192,0,88,110,6,
-    0,100,6,0,125,3,0,116,6,0,124,0,0,124,1,0,
+    0,100,6,0,125,3,0,116,6,0,165,0,0,124,1,0,
     100,7,0,124,2,0,100,5,0,124,3,0,131,2,2,83,
     41,8,122,53,82,101,116,117,114,110,32,97,32,109,111,100,
     117,108,101,32,115,112,101,99,32,98,97,115,101,100,32,111,
@@ -939,30 +939,30 @@ const unsigned char _Py_M__importlib[] = {
     12,1,16,1,18,1,15,1,7,2,12,1,15,1,3,1,
     19,1,13,1,14,3,6,2,114,85,0,0,0,99,3,0,
     0,0,0,0,0,0,8,0,0,0,53,0,0,0,67,0,
-    0,0,115,118,1,0,0,121,13,0,124,0,0,106,0,0,
-    125,3,0,87,110,18,0,4,116,1,0,107,10,0,114,33,
-    0,1,1,1,89,110,17,0,88,124,3,0,100,0,0,107,
-    9,0,114,50,0,124,3,0,83,124,0,0,106,2,0,125,
-    4,0,124,1,0,100,0,0,107,8,0,114,105,0,121,13,
-    0,124,0,0,106,3,0,125,1,0,87,110,18,0,4,116,
-    1,0,107,10,0,114,104,0,1,1,1,89,110,1,0,88,
-    121,13,0,124,0,0,106,4,0,125,5,0,87,110,24,0,
-    4,116,1,0,107,10,0,114,144,0,1,1,1,100,0,0,
-    125,5,0,89,110,1,0,88,124,2,0,100,0,0,107,8,
-    0,114,218,0,124,5,0,100,0,0,107,8,0,114,212,0,
-    121,13,0,124,1,0,106,5,0,125,2,0,87,113,218,0,
-    4,116,1,0,107,10,0,114,208,0,1,1,1,100,0,0,
+    0,0,115,118,1,0,0,121,13,0,166,0,0,106,0,0,
+    125,3,0,87,110,18,0,4,116,1,0,168,10,0,114,33,
+    0,1,1,1,89,110,17,0,88,124,3,0,100,0,0,168,
+    9,0,114,50,0,124,3,0,83,166,0,0,106,2,0,167,
+    4,0,124,1,0,100,0,0,168,8,0,114,105,0,121,13,
+    0,166,0,0,106,3,0,125,1,0,87,110,18,0,4,116,
+    1,0,168,10,0,114,104,0,1,1,1,89,110,1,0,88,
+    121,13,0,166,0,0,106,4,0,125,5,0,87,110,24,0,
+    4,116,1,0,168,10,0,114,144,0,1,1,1,100,0,0,
+    125,5,0,89,110,1,0,88,124,2,0,100,0,0,168,8,
+    0,114,218,0,124,5,0,100,0,0,168,8,0,114,212,0,
+    121,13,0,166,1,0,106,5,0,125,2,0,87,113,218,0,
+    4,116,1,0,168,10,0,114,208,0,1,1,1,100,0,0,
     125,2,0,89,113,218,0,88,110,6,0,124,5,0,125,2,
-    0,121,13,0,124,0,0,106,6,0,125,6,0,87,110,24,
-    0,4,116,1,0,107,10,0,114,1,1,1,1,1,100,0,
-    0,125,6,0,89,110,1,0,88,121,19,0,116,7,0,124,
+    0,121,13,0,166,0,0,106,6,0,125,6,0,87,110,24,
+    0,4,116,1,0,168,10,0,114,1,1,1,1,1,100,0,
+    0,125,6,0,89,110,1,0,88,121,19,0,116,7,0,166,
     0,0,106,8,0,131,1,0,125,7,0,87,110,24,0,4,
-    116,1,0,107,10,0,114,47,1,1,1,1,100,0,0,125,
-    7,0,89,110,1,0,88,116,9,0,124,4,0,124,1,0,
-    100,1,0,124,2,0,131,2,1,125,3,0,124,5,0,100,
-    0,0,107,8,0,114,87,1,100,2,0,110,3,0,100,3,
-    0,124,3,0,95,10,0,124,6,0,124,3,0,95,11,0,
-    124,7,0,124,3,0,95,12,0,124,3,0,83,41,4,78,
+    116,1,0,168,10,0,114,47,1,1,1,1,100,0,0,125,
+    7,0,89,110,1,0,88,116,9,0,165,4,0,124,1,0,
+    100,1,0,124,2,0,131,2,1,167,3,0,124,5,0,100,
+    0,0,168,8,0,114,87,1,100,2,0,110,3,0,100,3,
+    0,124,3,0,95,10,0,165,6,0,124,3,0,95,11,0,
+    165,7,0,124,3,0,95,12,0,124,3,0,83,41,4,78,
     114,107,0,0,0,70,84,41,13,114,95,0,0,0,114,96,
     0,0,0,114,1,0,0,0,114,91,0,0,0,114,98,0,
     0,0,90,7,95,79,82,73,71,73,78,218,10,95,95,99,
@@ -982,40 +982,40 @@ const unsigned char _Py_M__importlib[] = {
     0,0,218,8,111,118,101,114,114,105,100,101,70,99,2,0,
     0,0,1,0,0,0,5,0,0,0,59,0,0,0,67,0,
     0,0,115,54,2,0,0,124,2,0,115,30,0,116,0,0,
-    124,1,0,100,1,0,100,0,0,131,3,0,100,0,0,107,
-    8,0,114,67,0,121,16,0,124,0,0,106,1,0,124,1,
-    0,95,2,0,87,110,18,0,4,116,3,0,107,10,0,114,
+    124,1,0,100,1,0,100,0,0,131,3,0,100,0,0,168,
+    8,0,114,67,0,121,16,0,166,0,0,106,1,0,124,1,
+    0,95,2,0,87,110,18,0,4,116,3,0,168,10,0,114,
     66,0,1,1,1,89,110,1,0,88,124,2,0,115,97,0,
     116,0,0,124,1,0,100,2,0,100,0,0,131,3,0,100,
-    0,0,107,8,0,114,221,0,124,0,0,106,4,0,125,3,
-    0,124,3,0,100,0,0,107,8,0,114,187,0,124,0,0,
-    106,5,0,100,0,0,107,9,0,114,187,0,116,6,0,100,
-    0,0,107,8,0,114,151,0,116,7,0,130,1,0,116,6,
-    0,106,8,0,125,4,0,124,4,0,106,9,0,124,4,0,
-    131,1,0,125,3,0,124,0,0,106,5,0,124,3,0,95,
-    10,0,121,13,0,124,3,0,124,1,0,95,11,0,87,110,
-    18,0,4,116,3,0,107,10,0,114,220,0,1,1,1,89,
+    0,0,168,8,0,114,221,0,166,0,0,106,4,0,167,3,
+    0,124,3,0,100,0,0,168,8,0,114,187,0,166,0,0,
+    106,5,0,100,0,0,168,9,0,114,187,0,116,6,0,100,
+    0,0,168,8,0,114,151,0,116,7,0,130,1,0,116,6,
+    0,106,8,0,167,4,0,124,4,0,160,9,0,124,4,0,
+    161,1,0,167,3,0,124,0,0,106,5,0,124,3,0,95,
+    10,0,121,13,0,165,3,0,124,1,0,95,11,0,87,110,
+    18,0,4,116,3,0,168,10,0,114,220,0,1,1,1,89,
     110,1,0,88,124,2,0,115,251,0,116,0,0,124,1,0,
-    100,3,0,100,0,0,131,3,0,100,0,0,107,8,0,114,
-    32,1,121,16,0,124,0,0,106,12,0,124,1,0,95,13,
-    0,87,110,18,0,4,116,3,0,107,10,0,114,31,1,1,
-    1,1,89,110,1,0,88,121,13,0,124,0,0,124,1,0,
-    95,14,0,87,110,18,0,4,116,3,0,107,10,0,114,65,
+    100,3,0,100,0,0,131,3,0,100,0,0,168,8,0,114,
+    32,1,121,16,0,166,0,0,106,12,0,124,1,0,95,13,
+    0,87,110,18,0,4,116,3,0,168,10,0,114,31,1,1,
+    1,1,89,110,1,0,88,121,13,0,165,0,0,124,1,0,
+    95,14,0,87,110,18,0,4,116,3,0,168,10,0,114,65,
     1,1,1,1,89,110,1,0,88,124,2,0,115,96,1,116,
     0,0,124,1,0,100,4,0,100,0,0,131,3,0,100,0,
-    0,107,8,0,114,148,1,124,0,0,106,5,0,100,0,0,
-    107,9,0,114,148,1,121,16,0,124,0,0,106,5,0,124,
-    1,0,95,15,0,87,110,18,0,4,116,3,0,107,10,0,
-    114,147,1,1,1,1,89,110,1,0,88,124,0,0,106,16,
+    0,168,8,0,114,148,1,166,0,0,106,5,0,100,0,0,
+    168,9,0,114,148,1,121,16,0,166,0,0,106,5,0,124,
+    1,0,95,15,0,87,110,18,0,4,116,3,0,168,10,0,
+    114,147,1,1,1,1,89,110,1,0,88,166,0,0,106,16,
     0,114,50,2,124,2,0,115,187,1,116,0,0,124,1,0,
-    100,5,0,100,0,0,131,3,0,100,0,0,107,8,0,114,
-    224,1,121,16,0,124,0,0,106,17,0,124,1,0,95,18,
-    0,87,110,18,0,4,116,3,0,107,10,0,114,223,1,1,
+    100,5,0,100,0,0,131,3,0,100,0,0,168,8,0,114,
+    224,1,121,16,0,166,0,0,106,17,0,124,1,0,95,18,
+    0,87,110,18,0,4,116,3,0,168,10,0,114,223,1,1,
     1,1,89,110,1,0,88,124,2,0,115,254,1,116,0,0,
-    124,1,0,100,6,0,100,0,0,131,3,0,100,0,0,107,
-    8,0,114,50,2,124,0,0,106,19,0,100,0,0,107,9,
-    0,114,50,2,121,16,0,124,0,0,106,19,0,124,1,0,
-    95,20,0,87,110,18,0,4,116,3,0,107,10,0,114,49,
+    124,1,0,100,6,0,100,0,0,131,3,0,100,0,0,168,
+    8,0,114,50,2,166,0,0,106,19,0,100,0,0,168,9,
+    0,114,50,2,121,16,0,166,0,0,106,19,0,124,1,0,
+    95,20,0,87,110,18,0,4,116,3,0,168,10,0,114,49,
     2,1,1,1,89,110,1,0,88,124,1,0,83,41,7,78,
     114,1,0,0,0,114,91,0,0,0,218,11,95,95,112,97,
     99,107,97,103,101,95,95,114,131,0,0,0,114,98,0,0,
@@ -1038,15 +1038,15 @@ const unsigned char _Py_M__importlib[] = {
     1,5,2,30,1,15,1,3,1,16,1,13,1,5,2,9,
     1,30,1,3,1,16,1,13,1,5,2,30,1,15,1,3,
     1,16,1,13,1,5,1,114,137,0,0,0,99,1,0,0,
-    0,0,0,0,0,2,0,0,0,5,0,0,0,67,0,0,
-    0,115,129,0,0,0,100,1,0,125,1,0,116,0,0,124,
-    0,0,106,1,0,100,2,0,131,2,0,114,45,0,124,0,
-    0,106,1,0,106,2,0,124,0,0,131,1,0,125,1,0,
-    110,40,0,116,0,0,124,0,0,106,1,0,100,3,0,131,
-    2,0,114,85,0,116,3,0,106,4,0,100,4,0,116,5,
-    0,100,5,0,100,6,0,131,2,1,1,124,1,0,100,1,
-    0,107,8,0,114,112,0,116,6,0,124,0,0,106,7,0,
-    131,1,0,125,1,0,116,8,0,124,0,0,124,1,0,131,
+    0,0,0,0,0,2,0,0,0,6,0,0,0,67,0,0,
+    0,115,129,0,0,0,100,1,0,125,1,0,116,0,0,166,
+    0,0,106,1,0,100,2,0,131,2,0,114,45,0,166,0,
+    0,106,1,0,160,2,0,124,0,0,161,1,0,125,1,0,
+    110,40,0,116,0,0,166,0,0,106,1,0,100,3,0,131,
+    2,0,114,85,0,116,3,0,160,4,0,100,4,0,116,5,
+    0,100,5,0,100,6,0,161,2,1,1,124,1,0,100,1,
+    0,168,8,0,114,112,0,116,6,0,166,0,0,106,7,0,
+    131,1,0,125,1,0,116,8,0,165,0,0,124,1,0,131,
     2,0,1,124,1,0,83,41,7,122,43,67,114,101,97,116,
     101,32,97,32,109,111,100,117,108,101,32,98,97,115,101,100,
     32,111,110,32,116,104,101,32,112,114,111,118,105,100,101,100,
@@ -1068,17 +1068,17 @@ const unsigned char _Py_M__importlib[] = {
     111,100,117,108,101,95,102,114,111,109,95,115,112,101,99,58,
     2,0,0,115,20,0,0,0,0,3,6,1,18,3,21,1,
     18,1,9,2,13,1,12,1,15,1,13,1,114,144,0,0,
-    0,99,1,0,0,0,0,0,0,0,2,0,0,0,3,0,
-    0,0,67,0,0,0,115,149,0,0,0,124,0,0,106,0,
-    0,100,1,0,107,8,0,114,21,0,100,2,0,110,6,0,
-    124,0,0,106,0,0,125,1,0,124,0,0,106,1,0,100,
-    1,0,107,8,0,114,95,0,124,0,0,106,2,0,100,1,
-    0,107,8,0,114,73,0,100,3,0,106,3,0,124,1,0,
-    131,1,0,83,100,4,0,106,3,0,124,1,0,124,0,0,
-    106,2,0,131,2,0,83,110,50,0,124,0,0,106,4,0,
-    114,123,0,100,5,0,106,3,0,124,1,0,124,0,0,106,
-    1,0,131,2,0,83,100,6,0,106,3,0,124,0,0,106,
-    0,0,124,0,0,106,1,0,131,2,0,83,100,1,0,83,
+    0,99,1,0,0,0,0,0,0,0,2,0,0,0,4,0,
+    0,0,67,0,0,0,115,149,0,0,0,166,0,0,106,0,
+    0,100,1,0,168,8,0,114,21,0,100,2,0,110,6,0,
+    166,0,0,106,0,0,167,1,0,124,0,0,106,1,0,100,
+    1,0,168,8,0,114,95,0,166,0,0,106,2,0,100,1,
+    0,168,8,0,114,73,0,100,3,0,160,3,0,124,1,0,
+    161,1,0,83,100,4,0,160,3,0,165,1,0,124,0,0,
+    106,2,0,161,2,0,83,110,50,0,166,0,0,106,4,0,
+    114,123,0,100,5,0,160,3,0,165,1,0,124,0,0,106,
+    1,0,161,2,0,83,100,6,0,160,3,0,166,0,0,106,
+    0,0,166,0,0,106,1,0,161,2,0,83,100,1,0,83,
     41,7,122,38,82,101,116,117,114,110,32,116,104,101,32,114,
     101,112,114,32,116,111,32,117,115,101,32,102,111,114,32,116,
     104,101,32,109,111,100,117,108,101,46,78,114,93,0,0,0,
@@ -1094,21 +1094,21 @@ const unsigned char _Py_M__importlib[] = {
     0,115,16,0,0,0,0,3,30,1,15,1,15,1,13,2,
     22,2,9,1,19,2,114,97,0,0,0,99,2,0,0,0,
     0,0,0,0,4,0,0,0,12,0,0,0,67,0,0,0,
-    115,253,0,0,0,124,0,0,106,0,0,125,2,0,116,1,
-    0,106,2,0,131,0,0,1,116,3,0,124,2,0,131,1,
-    0,143,208,0,1,116,4,0,106,5,0,106,6,0,124,2,
-    0,131,1,0,124,1,0,107,9,0,114,89,0,100,1,0,
-    106,7,0,124,2,0,131,1,0,125,3,0,116,8,0,124,
-    3,0,100,2,0,124,2,0,131,1,1,130,1,0,124,0,
-    0,106,9,0,100,3,0,107,8,0,114,163,0,124,0,0,
-    106,10,0,100,3,0,107,8,0,114,140,0,116,8,0,100,
-    4,0,100,2,0,124,0,0,106,0,0,131,1,1,130,1,
-    0,116,11,0,124,0,0,124,1,0,100,5,0,100,6,0,
-    131,2,1,1,124,1,0,83,116,11,0,124,0,0,124,1,
-    0,100,5,0,100,6,0,131,2,1,1,116,12,0,124,0,
-    0,106,9,0,100,7,0,131,2,0,115,219,0,124,0,0,
-    106,9,0,106,13,0,124,2,0,131,1,0,1,110,16,0,
-    124,0,0,106,9,0,106,14,0,124,1,0,131,1,0,1,
+    115,253,0,0,0,166,0,0,106,0,0,125,2,0,116,1,
+    0,160,2,0,161,0,0,1,116,3,0,124,2,0,131,1,
+    0,143,208,0,1,116,4,0,106,5,0,160,6,0,124,2,
+    0,161,1,0,124,1,0,168,9,0,114,89,0,100,1,0,
+    160,7,0,124,2,0,161,1,0,125,3,0,116,8,0,124,
+    3,0,100,2,0,124,2,0,131,1,1,130,1,0,166,0,
+    0,106,9,0,100,3,0,168,8,0,114,163,0,166,0,0,
+    106,10,0,100,3,0,168,8,0,114,140,0,116,8,0,100,
+    4,0,100,2,0,166,0,0,106,0,0,131,1,1,130,1,
+    0,116,11,0,165,0,0,124,1,0,100,5,0,100,6,0,
+    131,2,1,1,124,1,0,83,116,11,0,165,0,0,124,1,
+    0,100,5,0,100,6,0,131,2,1,1,116,12,0,166,0,
+    0,106,9,0,100,7,0,131,2,0,115,219,0,166,0,0,
+    106,9,0,160,13,0,124,2,0,161,1,0,1,110,16,0,
+    166,0,0,106,9,0,160,14,0,124,1,0,161,1,0,1,
     87,100,3,0,81,82,88,116,4,0,106,5,0,124,2,0,
     25,83,41,8,122,51,69,120,101,99,117,116,101,32,116,104,
     101,32,115,112,101,99,32,105,110,32,97,110,32,101,120,105,
@@ -1130,22 +1130,22 @@ const unsigned char _Py_M__importlib[] = {
     1,13,1,24,1,15,1,18,1,15,1,15,1,21,2,19,
     1,4,1,19,1,18,4,19,2,23,1,114,86,0,0,0,
     99,1,0,0,0,0,0,0,0,2,0,0,0,27,0,0,
-    0,67,0,0,0,115,3,1,0,0,124,0,0,106,0,0,
-    106,1,0,124,0,0,106,2,0,131,1,0,1,116,3,0,
-    106,4,0,124,0,0,106,2,0,25,125,1,0,116,5,0,
-    124,1,0,100,1,0,100,0,0,131,3,0,100,0,0,107,
-    8,0,114,96,0,121,16,0,124,0,0,106,0,0,124,1,
-    0,95,6,0,87,110,18,0,4,116,7,0,107,10,0,114,
+    0,67,0,0,0,115,3,1,0,0,166,0,0,106,0,0,
+    160,1,0,166,0,0,106,2,0,161,1,0,1,116,3,0,
+    106,4,0,166,0,0,106,2,0,25,125,1,0,116,5,0,
+    124,1,0,100,1,0,100,0,0,131,3,0,100,0,0,168,
+    8,0,114,96,0,121,16,0,166,0,0,106,0,0,124,1,
+    0,95,6,0,87,110,18,0,4,116,7,0,168,10,0,114,
     95,0,1,1,1,89,110,1,0,88,116,5,0,124,1,0,
-    100,2,0,100,0,0,131,3,0,100,0,0,107,8,0,114,
-    197,0,121,56,0,124,1,0,106,8,0,124,1,0,95,9,
+    100,2,0,100,0,0,131,3,0,100,0,0,168,8,0,114,
+    197,0,121,56,0,166,1,0,106,8,0,124,1,0,95,9,
     0,116,10,0,124,1,0,100,3,0,131,2,0,115,175,0,
-    124,0,0,106,2,0,106,11,0,100,4,0,131,1,0,100,
+    166,0,0,106,2,0,160,11,0,100,4,0,161,1,0,100,
     5,0,25,124,1,0,95,9,0,87,110,18,0,4,116,7,
-    0,107,10,0,114,196,0,1,1,1,89,110,1,0,88,116,
+    0,168,10,0,114,196,0,1,1,1,89,110,1,0,88,116,
     5,0,124,1,0,100,6,0,100,0,0,131,3,0,100,0,
-    0,107,8,0,114,255,0,121,13,0,124,0,0,124,1,0,
-    95,12,0,87,110,18,0,4,116,7,0,107,10,0,114,254,
+    0,168,8,0,114,255,0,121,13,0,165,0,0,124,1,0,
+    95,12,0,87,110,18,0,4,116,7,0,168,10,0,114,254,
     0,1,1,1,89,110,1,0,88,124,1,0,83,41,7,78,
     114,91,0,0,0,114,134,0,0,0,114,131,0,0,0,114,
     121,0,0,0,114,33,0,0,0,114,95,0,0,0,41,13,
@@ -1161,16 +1161,16 @@ const unsigned char _Py_M__importlib[] = {
     24,1,3,4,12,1,15,1,29,1,13,1,5,1,24,1,
     3,1,13,1,13,1,5,1,114,148,0,0,0,99,1,0,
     0,0,0,0,0,0,2,0,0,0,11,0,0,0,67,0,
-    0,0,115,159,0,0,0,124,0,0,106,0,0,100,0,0,
-    107,9,0,114,43,0,116,1,0,124,0,0,106,0,0,100,
+    0,0,115,159,0,0,0,166,0,0,106,0,0,100,0,0,
+    168,9,0,114,43,0,116,1,0,166,0,0,106,0,0,100,
     1,0,131,2,0,115,43,0,116,2,0,124,0,0,131,1,
     0,83,116,3,0,124,0,0,131,1,0,125,1,0,116,4,
-    0,124,1,0,131,1,0,143,75,0,1,124,0,0,106,0,
-    0,100,0,0,107,8,0,114,122,0,124,0,0,106,5,0,
-    100,0,0,107,8,0,114,138,0,116,6,0,100,2,0,100,
-    3,0,124,0,0,106,7,0,131,1,1,130,1,0,110,16,
-    0,124,0,0,106,0,0,106,8,0,124,1,0,131,1,0,
-    1,87,100,0,0,81,82,88,116,9,0,106,10,0,124,0,
+    0,124,1,0,131,1,0,143,75,0,1,166,0,0,106,0,
+    0,100,0,0,168,8,0,114,122,0,166,0,0,106,5,0,
+    100,0,0,168,8,0,114,138,0,116,6,0,100,2,0,100,
+    3,0,166,0,0,106,7,0,131,1,1,130,1,0,110,16,
+    0,166,0,0,106,0,0,160,8,0,124,1,0,161,1,0,
+    1,87,100,0,0,81,82,88,116,9,0,106,10,0,166,0,
     0,106,7,0,25,83,41,4,78,114,139,0,0,0,122,14,
     109,105,115,115,105,110,103,32,108,111,97,100,101,114,114,15,
     0,0,0,41,11,114,99,0,0,0,114,4,0,0,0,114,
@@ -1183,8 +1183,8 @@ const unsigned char _Py_M__importlib[] = {
     0,2,15,2,18,1,10,2,12,1,13,1,15,1,15,1,
     24,3,23,5,114,149,0,0,0,99,1,0,0,0,0,0,
     0,0,1,0,0,0,9,0,0,0,67,0,0,0,115,47,
-    0,0,0,116,0,0,106,1,0,131,0,0,1,116,2,0,
-    124,0,0,106,3,0,131,1,0,143,15,0,1,116,4,0,
+    0,0,0,116,0,0,160,1,0,161,0,0,1,116,2,0,
+    166,0,0,106,3,0,131,1,0,143,15,0,1,116,4,0,
     124,0,0,131,1,0,83,87,100,1,0,81,82,88,100,1,
     0,83,41,2,122,191,82,101,116,117,114,110,32,97,32,110,
     101,119,32,109,111,100,117,108,101,32,111,98,106,101,99,116,
@@ -1228,9 +1228,9 @@ const unsigned char _Py_M__importlib[] = {
     116,104,101,32,110,101,101,100,32,116,111,10,32,32,32,32,
     105,110,115,116,97,110,116,105,97,116,101,32,116,104,101,32,
     99,108,97,115,115,46,10,10,32,32,32,32,99,1,0,0,
-    0,0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,
-    0,115,16,0,0,0,100,1,0,106,0,0,124,0,0,106,
-    1,0,131,1,0,83,41,2,122,115,82,101,116,117,114,110,
+    0,0,0,0,0,1,0,0,0,3,0,0,0,67,0,0,
+    0,115,16,0,0,0,100,1,0,160,0,0,166,0,0,106,
+    1,0,161,1,0,83,41,2,122,115,82,101,116,117,114,110,
     32,114,101,112,114,32,102,111,114,32,116,104,101,32,109,111,
     100,117,108,101,46,10,10,32,32,32,32,32,32,32,32,84,
     104,101,32,109,101,116,104,111,100,32,105,115,32,100,101,112,
@@ -1246,9 +1246,9 @@ const unsigned char _Py_M__importlib[] = {
     105,110,73,109,112,111,114,116,101,114,46,109,111,100,117,108,
     101,95,114,101,112,114,78,99,4,0,0,0,0,0,0,0,
     4,0,0,0,5,0,0,0,67,0,0,0,115,58,0,0,
-    0,124,2,0,100,0,0,107,9,0,114,16,0,100,0,0,
-    83,116,0,0,106,1,0,124,1,0,131,1,0,114,50,0,
-    116,2,0,124,1,0,124,0,0,100,1,0,100,2,0,131,
+    0,124,2,0,100,0,0,168,9,0,114,16,0,100,0,0,
+    83,116,0,0,160,1,0,124,1,0,161,1,0,114,50,0,
+    116,2,0,165,1,0,124,0,0,100,1,0,100,2,0,131,
     2,1,83,100,0,0,83,100,0,0,83,41,3,78,114,107,
     0,0,0,122,8,98,117,105,108,116,45,105,110,41,3,114,
     57,0,0,0,90,10,105,115,95,98,117,105,108,116,105,110,
@@ -1259,9 +1259,9 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,2,12,1,4,1,15,1,19,2,122,25,66,117,
     105,108,116,105,110,73,109,112,111,114,116,101,114,46,102,105,
     110,100,95,115,112,101,99,99,3,0,0,0,0,0,0,0,
-    4,0,0,0,3,0,0,0,67,0,0,0,115,41,0,0,
-    0,124,0,0,106,0,0,124,1,0,124,2,0,131,2,0,
-    125,3,0,124,3,0,100,1,0,107,9,0,114,37,0,124,
+    4,0,0,0,4,0,0,0,67,0,0,0,115,41,0,0,
+    0,124,0,0,160,0,0,165,1,0,124,2,0,161,2,0,
+    167,3,0,124,3,0,100,1,0,168,9,0,114,37,0,166,
     3,0,106,1,0,83,100,1,0,83,41,2,122,175,70,105,
     110,100,32,116,104,101,32,98,117,105,108,116,45,105,110,32,
     109,111,100,117,108,101,46,10,10,32,32,32,32,32,32,32,
@@ -1282,9 +1282,9 @@ const unsigned char _Py_M__importlib[] = {
     105,110,73,109,112,111,114,116,101,114,46,102,105,110,100,95,
     109,111,100,117,108,101,99,2,0,0,0,0,0,0,0,2,
     0,0,0,4,0,0,0,67,0,0,0,115,67,0,0,0,
-    124,1,0,106,0,0,116,1,0,106,2,0,107,7,0,114,
-    51,0,116,3,0,100,1,0,106,4,0,124,1,0,106,0,
-    0,131,1,0,100,2,0,124,1,0,106,0,0,131,1,1,
+    166,1,0,106,0,0,116,1,0,106,2,0,168,7,0,114,
+    51,0,116,3,0,100,1,0,160,4,0,166,1,0,106,0,
+    0,161,1,0,100,2,0,166,1,0,106,0,0,131,1,1,
     130,1,0,116,5,0,116,6,0,106,7,0,124,1,0,131,
     2,0,83,41,3,122,24,67,114,101,97,116,101,32,97,32,
     98,117,105,108,116,45,105,110,32,109,111,100,117,108,101,122,
@@ -1377,9 +1377,9 @@ const unsigned char _Py_M__importlib[] = {
     104,101,32,110,101,101,100,32,116,111,10,32,32,32,32,105,
     110,115,116,97,110,116,105,97,116,101,32,116,104,101,32,99,
     108,97,115,115,46,10,10,32,32,32,32,99,1,0,0,0,
-    0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,0,
-    115,16,0,0,0,100,1,0,106,0,0,124,0,0,106,1,
-    0,131,1,0,83,41,2,122,115,82,101,116,117,114,110,32,
+    0,0,0,0,1,0,0,0,3,0,0,0,67,0,0,0,
+    115,16,0,0,0,100,1,0,160,0,0,166,0,0,106,1,
+    0,161,1,0,83,41,2,122,115,82,101,116,117,114,110,32,
     114,101,112,114,32,102,111,114,32,116,104,101,32,109,111,100,
     117,108,101,46,10,10,32,32,32,32,32,32,32,32,84,104,
     101,32,109,101,116,104,111,100,32,105,115,32,100,101,112,114,
@@ -1394,8 +1394,8 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,7,122,26,70,114,111,122,101,110,73,109,112,111,
     114,116,101,114,46,109,111,100,117,108,101,95,114,101,112,114,
     78,99,4,0,0,0,0,0,0,0,4,0,0,0,5,0,
-    0,0,67,0,0,0,115,42,0,0,0,116,0,0,106,1,
-    0,124,1,0,131,1,0,114,34,0,116,2,0,124,1,0,
+    0,0,67,0,0,0,115,42,0,0,0,116,0,0,160,1,
+    0,124,1,0,161,1,0,114,34,0,116,2,0,165,1,0,
     124,0,0,100,1,0,100,2,0,131,2,1,83,100,0,0,
     83,100,0,0,83,41,3,78,114,107,0,0,0,90,6,102,
     114,111,122,101,110,41,3,114,57,0,0,0,114,82,0,0,
@@ -1405,8 +1405,8 @@ const unsigned char _Py_M__importlib[] = {
     21,3,0,0,115,6,0,0,0,0,2,15,1,19,2,122,
     24,70,114,111,122,101,110,73,109,112,111,114,116,101,114,46,
     102,105,110,100,95,115,112,101,99,99,3,0,0,0,0,0,
-    0,0,3,0,0,0,2,0,0,0,67,0,0,0,115,23,
-    0,0,0,116,0,0,106,1,0,124,1,0,131,1,0,114,
+    0,0,3,0,0,0,3,0,0,0,67,0,0,0,115,23,
+    0,0,0,116,0,0,160,1,0,124,1,0,161,1,0,114,
     19,0,124,0,0,83,100,1,0,83,41,2,122,93,70,105,
     110,100,32,97,32,102,114,111,122,101,110,32,109,111,100,117,
     108,101,46,10,10,32,32,32,32,32,32,32,32,84,104,105,
@@ -1430,12 +1430,12 @@ const unsigned char _Py_M__importlib[] = {
     28,70,114,111,122,101,110,73,109,112,111,114,116,101,114,46,
     99,114,101,97,116,101,95,109,111,100,117,108,101,99,1,0,
     0,0,0,0,0,0,3,0,0,0,4,0,0,0,67,0,
-    0,0,115,92,0,0,0,124,0,0,106,0,0,106,1,0,
-    125,1,0,116,2,0,106,3,0,124,1,0,131,1,0,115,
-    54,0,116,4,0,100,1,0,106,5,0,124,1,0,131,1,
+    0,0,115,92,0,0,0,166,0,0,106,0,0,106,1,0,
+    125,1,0,116,2,0,160,3,0,124,1,0,161,1,0,115,
+    54,0,116,4,0,100,1,0,160,5,0,124,1,0,161,1,
     0,100,2,0,124,1,0,131,1,1,130,1,0,116,6,0,
     116,2,0,106,7,0,124,1,0,131,2,0,125,2,0,116,
-    8,0,124,2,0,124,0,0,106,9,0,131,2,0,1,100,
+    8,0,165,2,0,124,0,0,106,9,0,131,2,0,1,100,
     0,0,83,41,3,78,122,27,123,33,114,125,32,105,115,32,
     110,111,116,32,97,32,102,114,111,122,101,110,32,109,111,100,
     117,108,101,114,15,0,0,0,41,10,114,95,0,0,0,114,
@@ -1449,7 +1449,7 @@ const unsigned char _Py_M__importlib[] = {
     18,1,9,1,18,1,122,26,70,114,111,122,101,110,73,109,
     112,111,114,116,101,114,46,101,120,101,99,95,109,111,100,117,
     108,101,99,2,0,0,0,0,0,0,0,2,0,0,0,3,
-    0,0,0,67,0,0,0,115,13,0,0,0,116,0,0,124,
+    0,0,0,67,0,0,0,115,13,0,0,0,116,0,0,165,
     0,0,124,1,0,131,2,0,83,41,1,122,95,76,111,97,
     100,32,97,32,102,114,111,122,101,110,32,109,111,100,117,108,
     101,46,10,10,32,32,32,32,32,32,32,32,84,104,105,115,
@@ -1462,8 +1462,8 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,50,3,0,0,115,2,0,0,0,0,7,122,26,
     70,114,111,122,101,110,73,109,112,111,114,116,101,114,46,108,
     111,97,100,95,109,111,100,117,108,101,99,2,0,0,0,0,
-    0,0,0,2,0,0,0,2,0,0,0,67,0,0,0,115,
-    13,0,0,0,116,0,0,106,1,0,124,1,0,131,1,0,
+    0,0,0,2,0,0,0,3,0,0,0,67,0,0,0,115,
+    13,0,0,0,116,0,0,160,1,0,124,1,0,161,1,0,
     83,41,1,122,45,82,101,116,117,114,110,32,116,104,101,32,
     99,111,100,101,32,111,98,106,101,99,116,32,102,111,114,32,
     116,104,101,32,102,114,111,122,101,110,32,109,111,100,117,108,
@@ -1483,8 +1483,8 @@ const unsigned char _Py_M__importlib[] = {
     65,3,0,0,115,2,0,0,0,0,4,122,25,70,114,111,
     122,101,110,73,109,112,111,114,116,101,114,46,103,101,116,95,
     115,111,117,114,99,101,99,2,0,0,0,0,0,0,0,2,
-    0,0,0,2,0,0,0,67,0,0,0,115,13,0,0,0,
-    116,0,0,106,1,0,124,1,0,131,1,0,83,41,1,122,
+    0,0,0,3,0,0,0,67,0,0,0,115,13,0,0,0,
+    116,0,0,160,1,0,124,1,0,161,1,0,83,41,1,122,
     46,82,101,116,117,114,110,32,84,114,117,101,32,105,102,32,
     116,104,101,32,102,114,111,122,101,110,32,109,111,100,117,108,
     101,32,105,115,32,97,32,112,97,99,107,97,103,101,46,41,
@@ -1512,8 +1512,8 @@ const unsigned char _Py_M__importlib[] = {
     116,101,120,116,122,36,67,111,110,116,101,120,116,32,109,97,
     110,97,103,101,114,32,102,111,114,32,116,104,101,32,105,109,
     112,111,114,116,32,108,111,99,107,46,99,1,0,0,0,0,
-    0,0,0,1,0,0,0,1,0,0,0,67,0,0,0,115,
-    14,0,0,0,116,0,0,106,1,0,131,0,0,1,100,1,
+    0,0,0,1,0,0,0,2,0,0,0,67,0,0,0,115,
+    14,0,0,0,116,0,0,160,1,0,161,0,0,1,100,1,
     0,83,41,2,122,24,65,99,113,117,105,114,101,32,116,104,
     101,32,105,109,112,111,114,116,32,108,111,99,107,46,78,41,
     2,114,57,0,0,0,114,145,0,0,0,41,1,114,19,0,
@@ -1521,8 +1521,8 @@ const unsigned char _Py_M__importlib[] = {
     0,114,23,0,0,0,84,3,0,0,115,2,0,0,0,0,
     2,122,28,95,73,109,112,111,114,116,76,111,99,107,67,111,
     110,116,101,120,116,46,95,95,101,110,116,101,114,95,95,99,
-    4,0,0,0,0,0,0,0,4,0,0,0,1,0,0,0,
-    67,0,0,0,115,14,0,0,0,116,0,0,106,1,0,131,
+    4,0,0,0,0,0,0,0,4,0,0,0,2,0,0,0,
+    67,0,0,0,115,14,0,0,0,116,0,0,160,1,0,161,
     0,0,1,100,1,0,83,41,2,122,60,82,101,108,101,97,
     115,101,32,116,104,101,32,105,109,112,111,114,116,32,108,111,
     99,107,32,114,101,103,97,114,100,108,101,115,115,32,111,102,
@@ -1540,13 +1540,13 @@ const unsigned char _Py_M__importlib[] = {
     0,114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,
     114,165,0,0,0,80,3,0,0,115,6,0,0,0,12,2,
     6,2,12,4,114,165,0,0,0,99,3,0,0,0,0,0,
-    0,0,5,0,0,0,4,0,0,0,67,0,0,0,115,88,
-    0,0,0,124,1,0,106,0,0,100,1,0,124,2,0,100,
-    2,0,24,131,2,0,125,3,0,116,1,0,124,3,0,131,
-    1,0,124,2,0,107,0,0,114,52,0,116,2,0,100,3,
-    0,131,1,0,130,1,0,124,3,0,100,4,0,25,125,4,
-    0,124,0,0,114,84,0,100,5,0,106,3,0,124,4,0,
-    124,0,0,131,2,0,83,124,4,0,83,41,6,122,50,82,
+    0,0,5,0,0,0,5,0,0,0,67,0,0,0,115,88,
+    0,0,0,124,1,0,160,0,0,100,1,0,124,2,0,100,
+    2,0,24,161,2,0,125,3,0,116,1,0,124,3,0,131,
+    1,0,124,2,0,168,0,0,114,52,0,116,2,0,100,3,
+    0,131,1,0,130,1,0,124,3,0,100,4,0,25,167,4,
+    0,124,0,0,114,84,0,100,5,0,160,3,0,165,4,0,
+    124,0,0,161,2,0,83,124,4,0,83,41,6,122,50,82,
     101,115,111,108,118,101,32,97,32,114,101,108,97,116,105,118,
     101,32,109,111,100,117,108,101,32,110,97,109,101,32,116,111,
     32,97,110,32,97,98,115,111,108,117,116,101,32,111,110,101,
@@ -1563,10 +1563,10 @@ const unsigned char _Py_M__importlib[] = {
     114,101,115,111,108,118,101,95,110,97,109,101,93,3,0,0,
     115,10,0,0,0,0,2,22,1,18,1,12,1,10,1,114,
     171,0,0,0,99,3,0,0,0,0,0,0,0,4,0,0,
-    0,3,0,0,0,67,0,0,0,115,47,0,0,0,124,0,
-    0,106,0,0,124,1,0,124,2,0,131,2,0,125,3,0,
-    124,3,0,100,0,0,107,8,0,114,34,0,100,0,0,83,
-    116,1,0,124,1,0,124,3,0,131,2,0,83,41,1,78,
+    0,4,0,0,0,67,0,0,0,115,47,0,0,0,124,0,
+    0,160,0,0,165,1,0,124,2,0,161,2,0,167,3,0,
+    124,3,0,100,0,0,168,8,0,114,34,0,100,0,0,83,
+    116,1,0,165,1,0,124,3,0,131,2,0,83,41,1,78,
     41,2,114,155,0,0,0,114,85,0,0,0,41,4,218,6,
     102,105,110,100,101,114,114,15,0,0,0,114,152,0,0,0,
     114,99,0,0,0,114,10,0,0,0,114,10,0,0,0,114,
@@ -1575,23 +1575,23 @@ const unsigned char _Py_M__importlib[] = {
     0,3,18,1,12,1,4,1,114,173,0,0,0,99,3,0,
     0,0,0,0,0,0,9,0,0,0,27,0,0,0,67,0,
     0,0,115,42,1,0,0,116,0,0,106,1,0,100,1,0,
-    107,9,0,114,41,0,116,0,0,106,1,0,12,114,41,0,
-    116,2,0,106,3,0,100,2,0,116,4,0,131,2,0,1,
+    168,9,0,114,41,0,116,0,0,106,1,0,12,114,41,0,
+    116,2,0,160,3,0,100,2,0,116,4,0,161,2,0,1,
     124,0,0,116,0,0,106,5,0,107,6,0,125,3,0,120,
     235,0,116,0,0,106,1,0,68,93,220,0,125,4,0,116,
-    6,0,131,0,0,143,90,0,1,121,13,0,124,4,0,106,
-    7,0,125,5,0,87,110,51,0,4,116,8,0,107,10,0,
-    114,148,0,1,1,1,116,9,0,124,4,0,124,0,0,124,
-    1,0,131,3,0,125,6,0,124,6,0,100,1,0,107,8,
-    0,114,144,0,119,66,0,89,110,19,0,88,124,5,0,124,
-    0,0,124,1,0,124,2,0,131,3,0,125,6,0,87,100,
-    1,0,81,82,88,124,6,0,100,1,0,107,9,0,114,66,
+    6,0,131,0,0,143,90,0,1,121,13,0,166,4,0,106,
+    7,0,125,5,0,87,110,51,0,4,116,8,0,168,10,0,
+    114,148,0,1,1,1,116,9,0,165,4,0,124,0,0,124,
+    1,0,131,3,0,167,6,0,124,6,0,100,1,0,168,8,
+    0,114,144,0,119,66,0,89,110,19,0,88,165,5,0,124,
+    0,0,165,1,0,124,2,0,131,3,0,125,6,0,87,100,
+    1,0,81,82,88,124,6,0,100,1,0,168,9,0,114,66,
     0,124,3,0,12,114,26,1,124,0,0,116,0,0,106,5,
-    0,107,6,0,114,26,1,116,0,0,106,5,0,124,0,0,
-    25,125,7,0,121,13,0,124,7,0,106,10,0,125,8,0,
-    87,110,22,0,4,116,8,0,107,10,0,114,2,1,1,1,
+    0,168,6,0,114,26,1,116,0,0,106,5,0,124,0,0,
+    25,125,7,0,121,13,0,166,7,0,106,10,0,125,8,0,
+    87,110,22,0,4,116,8,0,168,10,0,114,2,1,1,1,
     1,124,6,0,83,89,113,30,1,88,124,8,0,100,1,0,
-    107,8,0,114,19,1,124,6,0,83,124,8,0,83,113,66,
+    168,8,0,114,19,1,124,6,0,83,124,8,0,83,113,66,
     0,124,6,0,83,113,66,0,87,100,1,0,83,100,1,0,
     83,41,3,122,23,70,105,110,100,32,97,32,109,111,100,117,
     108,101,39,115,32,108,111,97,100,101,114,46,78,122,22,115,
@@ -1610,18 +1610,18 @@ const unsigned char _Py_M__importlib[] = {
     1,10,1,3,1,13,1,13,1,18,1,12,1,8,2,25,
     1,12,2,22,1,13,1,3,1,13,1,13,4,9,2,12,
     1,4,2,7,2,8,2,114,176,0,0,0,99,3,0,0,
-    0,0,0,0,0,4,0,0,0,4,0,0,0,67,0,0,
+    0,0,0,0,0,4,0,0,0,5,0,0,0,67,0,0,
     0,115,185,0,0,0,116,0,0,124,0,0,116,1,0,131,
-    2,0,115,42,0,116,2,0,100,1,0,106,3,0,116,4,
-    0,124,0,0,131,1,0,131,1,0,131,1,0,130,1,0,
-    124,2,0,100,2,0,107,0,0,114,66,0,116,5,0,100,
-    3,0,131,1,0,130,1,0,124,2,0,100,2,0,107,4,
+    2,0,115,42,0,116,2,0,100,1,0,160,3,0,116,4,
+    0,124,0,0,131,1,0,161,1,0,131,1,0,130,1,0,
+    124,2,0,100,2,0,168,0,0,114,66,0,116,5,0,100,
+    3,0,131,1,0,130,1,0,124,2,0,100,2,0,168,4,
     0,114,150,0,116,0,0,124,1,0,116,1,0,131,2,0,
     115,108,0,116,2,0,100,4,0,131,1,0,130,1,0,110,
-    42,0,124,1,0,116,6,0,106,7,0,107,7,0,114,150,
-    0,100,5,0,125,3,0,116,8,0,124,3,0,106,3,0,
-    124,1,0,131,1,0,131,1,0,130,1,0,124,0,0,12,
-    114,181,0,124,2,0,100,2,0,107,2,0,114,181,0,116,
+    42,0,124,1,0,116,6,0,106,7,0,168,7,0,114,150,
+    0,100,5,0,125,3,0,116,8,0,124,3,0,160,3,0,
+    124,1,0,161,1,0,131,1,0,130,1,0,124,0,0,12,
+    114,181,0,124,2,0,100,2,0,168,2,0,114,181,0,116,
     5,0,100,6,0,131,1,0,130,1,0,100,7,0,83,41,
     8,122,28,86,101,114,105,102,121,32,97,114,103,117,109,101,
     110,116,115,32,97,114,101,32,34,115,97,110,101,34,46,122,
@@ -1648,25 +1648,25 @@ const unsigned char _Py_M__importlib[] = {
     6,2,21,1,19,1,114,181,0,0,0,122,16,78,111,32,
     109,111,100,117,108,101,32,110,97,109,101,100,32,122,4,123,
     33,114,125,99,2,0,0,0,0,0,0,0,8,0,0,0,
-    12,0,0,0,67,0,0,0,115,40,1,0,0,100,0,0,
-    125,2,0,124,0,0,106,0,0,100,1,0,131,1,0,100,
-    2,0,25,125,3,0,124,3,0,114,175,0,124,3,0,116,
-    1,0,106,2,0,107,7,0,114,59,0,116,3,0,124,1,
+    13,0,0,0,67,0,0,0,115,40,1,0,0,100,0,0,
+    167,2,0,124,0,0,160,0,0,100,1,0,161,1,0,100,
+    2,0,25,167,3,0,124,3,0,114,175,0,124,3,0,116,
+    1,0,106,2,0,168,7,0,114,59,0,116,3,0,165,1,
     0,124,3,0,131,2,0,1,124,0,0,116,1,0,106,2,
-    0,107,6,0,114,85,0,116,1,0,106,2,0,124,0,0,
+    0,168,6,0,114,85,0,116,1,0,106,2,0,124,0,0,
     25,83,116,1,0,106,2,0,124,3,0,25,125,4,0,121,
-    13,0,124,4,0,106,4,0,125,2,0,87,110,61,0,4,
-    116,5,0,107,10,0,114,174,0,1,1,1,116,6,0,100,
-    3,0,23,106,7,0,124,0,0,124,3,0,131,2,0,125,
+    13,0,166,4,0,106,4,0,125,2,0,87,110,61,0,4,
+    116,5,0,168,10,0,114,174,0,1,1,1,116,6,0,100,
+    3,0,23,160,7,0,165,0,0,124,3,0,161,2,0,125,
     5,0,116,8,0,124,5,0,100,4,0,124,0,0,131,1,
-    1,100,0,0,130,2,0,89,110,1,0,88,116,9,0,124,
-    0,0,124,2,0,131,2,0,125,6,0,124,6,0,100,0,
-    0,107,8,0,114,232,0,116,8,0,116,6,0,106,7,0,
-    124,0,0,131,1,0,100,4,0,124,0,0,131,1,1,130,
-    1,0,110,12,0,116,10,0,124,6,0,131,1,0,125,7,
+    1,100,0,0,130,2,0,89,110,1,0,88,116,9,0,165,
+    0,0,124,2,0,131,2,0,167,6,0,124,6,0,100,0,
+    0,168,8,0,114,232,0,116,8,0,116,6,0,160,7,0,
+    124,0,0,161,1,0,100,4,0,124,0,0,131,1,1,130,
+    1,0,110,12,0,116,10,0,124,6,0,131,1,0,167,7,
     0,124,3,0,114,36,1,116,1,0,106,2,0,124,3,0,
-    25,125,4,0,116,11,0,124,4,0,124,0,0,106,0,0,
-    100,1,0,131,1,0,100,5,0,25,124,7,0,131,3,0,
+    25,125,4,0,116,11,0,165,4,0,124,0,0,160,0,0,
+    100,1,0,161,1,0,100,5,0,25,124,7,0,131,3,0,
     1,124,7,0,83,41,6,78,114,121,0,0,0,114,33,0,
     0,0,122,23,59,32,123,33,114,125,32,105,115,32,110,111,
     116,32,97,32,112,97,99,107,97,103,101,114,15,0,0,0,
@@ -1686,7 +1686,7 @@ const unsigned char _Py_M__importlib[] = {
     1,30,2,12,1,6,2,13,1,29,1,114,184,0,0,0,
     99,2,0,0,0,0,0,0,0,2,0,0,0,10,0,0,
     0,67,0,0,0,115,37,0,0,0,116,0,0,124,0,0,
-    131,1,0,143,18,0,1,116,1,0,124,0,0,124,1,0,
+    131,1,0,143,18,0,1,116,1,0,165,0,0,124,1,0,
     131,2,0,83,87,100,1,0,81,82,88,100,1,0,83,41,
     2,122,54,70,105,110,100,32,97,110,100,32,108,111,97,100,
     32,116,104,101,32,109,111,100,117,108,101,44,32,97,110,100,
@@ -1698,15 +1698,15 @@ const unsigned char _Py_M__importlib[] = {
     100,198,3,0,0,115,4,0,0,0,0,2,13,1,114,185,
     0,0,0,114,33,0,0,0,99,3,0,0,0,0,0,0,
     0,5,0,0,0,4,0,0,0,67,0,0,0,115,166,0,
-    0,0,116,0,0,124,0,0,124,1,0,124,2,0,131,3,
-    0,1,124,2,0,100,1,0,107,4,0,114,46,0,116,1,
-    0,124,0,0,124,1,0,124,2,0,131,3,0,125,0,0,
-    116,2,0,106,3,0,131,0,0,1,124,0,0,116,4,0,
-    106,5,0,107,7,0,114,84,0,116,6,0,124,0,0,116,
+    0,0,116,0,0,165,0,0,124,1,0,124,2,0,131,3,
+    0,1,124,2,0,100,1,0,168,4,0,114,46,0,116,1,
+    0,165,0,0,124,1,0,124,2,0,131,3,0,125,0,0,
+    116,2,0,160,3,0,161,0,0,1,124,0,0,116,4,0,
+    106,5,0,168,7,0,114,84,0,116,6,0,124,0,0,116,
     7,0,131,2,0,83,116,4,0,106,5,0,124,0,0,25,
-    125,3,0,124,3,0,100,2,0,107,8,0,114,152,0,116,
-    2,0,106,8,0,131,0,0,1,100,3,0,106,9,0,124,
-    0,0,131,1,0,125,4,0,116,10,0,124,4,0,100,4,
+    167,3,0,124,3,0,100,2,0,168,8,0,114,152,0,116,
+    2,0,160,8,0,161,0,0,1,100,3,0,160,9,0,124,
+    0,0,161,1,0,125,4,0,116,10,0,124,4,0,100,4,
     0,124,0,0,131,1,1,130,1,0,116,11,0,124,0,0,
     131,1,0,1,124,3,0,83,41,5,97,50,1,0,0,73,
     109,112,111,114,116,32,97,110,100,32,114,101,116,117,114,110,
@@ -1744,18 +1744,18 @@ const unsigned char _Py_M__importlib[] = {
     114,186,0,0,0,99,3,0,0,0,0,0,0,0,6,0,
     0,0,17,0,0,0,67,0,0,0,115,239,0,0,0,116,
     0,0,124,0,0,100,1,0,131,2,0,114,235,0,100,2,
-    0,124,1,0,107,6,0,114,83,0,116,1,0,124,1,0,
-    131,1,0,125,1,0,124,1,0,106,2,0,100,2,0,131,
+    0,124,1,0,168,6,0,114,83,0,116,1,0,124,1,0,
+    131,1,0,167,1,0,124,1,0,160,2,0,100,2,0,161,
     1,0,1,116,0,0,124,0,0,100,3,0,131,2,0,114,
-    83,0,124,1,0,106,3,0,124,0,0,106,4,0,131,1,
+    83,0,124,1,0,160,3,0,166,0,0,106,4,0,161,1,
     0,1,120,149,0,124,1,0,68,93,141,0,125,3,0,116,
-    0,0,124,0,0,124,3,0,131,2,0,115,90,0,100,4,
-    0,106,5,0,124,0,0,106,6,0,124,3,0,131,2,0,
-    125,4,0,121,17,0,116,7,0,124,2,0,124,4,0,131,
-    2,0,1,87,113,90,0,4,116,8,0,107,10,0,114,230,
+    0,0,165,0,0,124,3,0,131,2,0,115,90,0,100,4,
+    0,160,5,0,166,0,0,106,6,0,124,3,0,161,2,0,
+    125,4,0,121,17,0,116,7,0,165,2,0,124,4,0,131,
+    2,0,1,87,113,90,0,4,116,8,0,168,10,0,114,230,
     0,1,125,5,0,1,122,47,0,116,9,0,124,5,0,131,
-    1,0,106,10,0,116,11,0,131,1,0,114,209,0,124,5,
-    0,106,12,0,124,4,0,107,2,0,114,209,0,119,90,0,
+    1,0,160,10,0,116,11,0,161,1,0,114,209,0,166,5,
+    0,106,12,0,124,4,0,168,2,0,114,209,0,119,90,0,
     130,0,0,87,89,100,5,0,100,5,0,125,5,0,126,5,
     0,88,113,90,0,88,113,90,0,87,124,0,0,83,41,6,
     122,238,70,105,103,117,114,101,32,111,117,116,32,119,104,97,
@@ -1788,12 +1788,12 @@ const unsigned char _Py_M__importlib[] = {
     0,0,10,15,1,12,1,12,1,13,1,15,1,16,1,13,
     1,15,1,21,1,3,1,17,1,18,4,21,1,15,1,3,
     1,26,1,114,194,0,0,0,99,1,0,0,0,0,0,0,
-    0,2,0,0,0,2,0,0,0,67,0,0,0,115,72,0,
-    0,0,124,0,0,106,0,0,100,1,0,131,1,0,125,1,
-    0,124,1,0,100,2,0,107,8,0,114,68,0,124,0,0,
-    100,3,0,25,125,1,0,100,4,0,124,0,0,107,7,0,
-    114,68,0,124,1,0,106,1,0,100,5,0,131,1,0,100,
-    6,0,25,125,1,0,124,1,0,83,41,7,122,167,67,97,
+    0,2,0,0,0,3,0,0,0,67,0,0,0,115,72,0,
+    0,0,124,0,0,160,0,0,100,1,0,161,1,0,167,1,
+    0,124,1,0,100,2,0,168,8,0,114,68,0,124,0,0,
+    100,3,0,25,125,1,0,100,4,0,124,0,0,168,7,0,
+    114,68,0,124,1,0,160,1,0,100,5,0,161,1,0,100,
+    6,0,25,167,1,0,124,1,0,83,41,7,122,167,67,97,
     108,99,117,108,97,116,101,32,119,104,97,116,32,95,95,112,
     97,99,107,97,103,101,95,95,32,115,104,111,117,108,100,32,
     98,101,46,10,10,32,32,32,32,95,95,112,97,99,107,97,
@@ -1813,20 +1813,20 @@ const unsigned char _Py_M__importlib[] = {
     0,115,12,0,0,0,0,7,15,1,12,1,10,1,12,1,
     19,1,114,196,0,0,0,99,5,0,0,0,0,0,0,0,
     9,0,0,0,5,0,0,0,67,0,0,0,115,227,0,0,
-    0,124,4,0,100,1,0,107,2,0,114,27,0,116,0,0,
+    0,124,4,0,100,1,0,168,2,0,114,27,0,116,0,0,
     124,0,0,131,1,0,125,5,0,110,54,0,124,1,0,100,
-    2,0,107,9,0,114,45,0,124,1,0,110,3,0,105,0,
+    2,0,168,9,0,114,45,0,124,1,0,110,3,0,105,0,
     0,125,6,0,116,1,0,124,6,0,131,1,0,125,7,0,
-    116,0,0,124,0,0,124,7,0,124,4,0,131,3,0,125,
-    5,0,124,3,0,115,207,0,124,4,0,100,1,0,107,2,
-    0,114,122,0,116,0,0,124,0,0,106,2,0,100,3,0,
-    131,1,0,100,1,0,25,131,1,0,83,124,0,0,115,132,
+    116,0,0,165,0,0,124,7,0,124,4,0,131,3,0,167,
+    5,0,124,3,0,115,207,0,124,4,0,100,1,0,168,2,
+    0,114,122,0,116,0,0,124,0,0,160,2,0,100,3,0,
+    161,1,0,100,1,0,25,131,1,0,83,124,0,0,115,132,
     0,124,5,0,83,116,3,0,124,0,0,131,1,0,116,3,
-    0,124,0,0,106,2,0,100,3,0,131,1,0,100,1,0,
-    25,131,1,0,24,125,8,0,116,4,0,106,5,0,124,5,
-    0,106,6,0,100,2,0,116,3,0,124,5,0,106,6,0,
+    0,124,0,0,160,2,0,100,3,0,161,1,0,100,1,0,
+    25,131,1,0,24,125,8,0,116,4,0,106,5,0,166,5,
+    0,106,6,0,100,2,0,116,3,0,166,5,0,106,6,0,
     131,1,0,124,8,0,24,133,2,0,25,25,83,110,16,0,
-    116,7,0,124,5,0,124,3,0,116,0,0,131,3,0,83,
+    116,7,0,165,5,0,124,3,0,116,0,0,131,3,0,83,
     100,2,0,83,41,4,97,215,1,0,0,73,109,112,111,114,
     116,32,97,32,109,111,100,117,108,101,46,10,10,32,32,32,
     32,84,104,101,32,39,103,108,111,98,97,108,115,39,32,97,
@@ -1870,8 +1870,8 @@ const unsigned char _Py_M__importlib[] = {
     15,2,24,1,12,1,18,1,6,3,12,1,23,1,6,1,
     4,4,35,3,40,2,114,199,0,0,0,99,1,0,0,0,
     0,0,0,0,2,0,0,0,3,0,0,0,67,0,0,0,
-    115,53,0,0,0,116,0,0,106,1,0,124,0,0,131,1,
-    0,125,1,0,124,1,0,100,0,0,107,8,0,114,43,0,
+    115,53,0,0,0,116,0,0,160,1,0,124,0,0,161,1,
+    0,167,1,0,124,1,0,100,0,0,168,8,0,114,43,0,
     116,2,0,100,1,0,124,0,0,23,131,1,0,130,1,0,
     116,3,0,124,1,0,131,1,0,83,41,2,78,122,25,110,
     111,32,98,117,105,108,116,45,105,110,32,109,111,100,117,108,
@@ -1884,22 +1884,22 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,99,2,0,0,0,0,0,0,0,12,0,0,0,
     12,0,0,0,67,0,0,0,115,74,1,0,0,124,1,0,
     97,0,0,124,0,0,97,1,0,116,2,0,116,1,0,131,
-    1,0,125,2,0,120,123,0,116,1,0,106,3,0,106,4,
-    0,131,0,0,68,93,106,0,92,2,0,125,3,0,125,4,
-    0,116,5,0,124,4,0,124,2,0,131,2,0,114,40,0,
-    124,3,0,116,1,0,106,6,0,107,6,0,114,91,0,116,
-    7,0,125,5,0,110,27,0,116,0,0,106,8,0,124,3,
-    0,131,1,0,114,40,0,116,9,0,125,5,0,110,3,0,
-    113,40,0,116,10,0,124,4,0,124,5,0,131,2,0,125,
-    6,0,116,11,0,124,6,0,124,4,0,131,2,0,1,113,
+    1,0,125,2,0,120,123,0,116,1,0,106,3,0,160,4,
+    0,161,0,0,68,93,106,0,92,2,0,125,3,0,125,4,
+    0,116,5,0,165,4,0,124,2,0,131,2,0,114,40,0,
+    124,3,0,116,1,0,106,6,0,168,6,0,114,91,0,116,
+    7,0,125,5,0,110,27,0,116,0,0,160,8,0,124,3,
+    0,161,1,0,114,40,0,116,9,0,125,5,0,110,3,0,
+    113,40,0,116,10,0,165,4,0,124,5,0,131,2,0,125,
+    6,0,116,11,0,165,6,0,124,4,0,131,2,0,1,113,
     40,0,87,116,1,0,106,3,0,116,12,0,25,125,7,0,
-    120,73,0,100,5,0,68,93,65,0,125,8,0,124,8,0,
-    116,1,0,106,3,0,107,7,0,114,206,0,116,13,0,124,
+    120,73,0,100,5,0,68,93,65,0,167,8,0,124,8,0,
+    116,1,0,106,3,0,168,7,0,114,206,0,116,13,0,124,
     8,0,131,1,0,125,9,0,110,13,0,116,1,0,106,3,
-    0,124,8,0,25,125,9,0,116,14,0,124,7,0,124,8,
+    0,124,8,0,25,125,9,0,116,14,0,165,7,0,124,8,
     0,124,9,0,131,3,0,1,113,170,0,87,121,16,0,116,
     13,0,100,2,0,131,1,0,125,10,0,87,110,24,0,4,
-    116,15,0,107,10,0,114,25,1,1,1,1,100,3,0,125,
+    116,15,0,168,10,0,114,25,1,1,1,1,100,3,0,125,
     10,0,89,110,1,0,88,116,14,0,124,7,0,100,2,0,
     124,10,0,131,3,0,1,116,13,0,100,4,0,131,1,0,
     125,11,0,116,14,0,124,7,0,100,4,0,124,11,0,131,
@@ -1941,12 +1941,12 @@ const unsigned char _Py_M__importlib[] = {
     3,1,15,1,17,3,13,1,13,1,15,1,15,2,13,1,
     20,3,3,1,16,1,13,2,11,1,16,3,12,1,114,204,
     0,0,0,99,2,0,0,0,0,0,0,0,3,0,0,0,
-    3,0,0,0,67,0,0,0,115,87,0,0,0,116,0,0,
-    124,0,0,124,1,0,131,2,0,1,116,1,0,106,2,0,
-    106,3,0,116,4,0,131,1,0,1,116,1,0,106,2,0,
-    106,3,0,116,5,0,131,1,0,1,100,1,0,100,2,0,
-    108,6,0,125,2,0,124,2,0,97,7,0,124,2,0,106,
-    8,0,116,1,0,106,9,0,116,10,0,25,131,1,0,1,
+    4,0,0,0,67,0,0,0,115,87,0,0,0,116,0,0,
+    165,0,0,124,1,0,131,2,0,1,116,1,0,106,2,0,
+    160,3,0,116,4,0,161,1,0,1,116,1,0,106,2,0,
+    160,3,0,116,5,0,161,1,0,1,100,1,0,100,2,0,
+    108,6,0,167,2,0,124,2,0,97,7,0,124,2,0,160,
+    8,0,116,1,0,106,9,0,116,10,0,25,161,1,0,1,
     100,2,0,83,41,3,122,50,73,110,115,116,97,108,108,32,
     105,109,112,111,114,116,108,105,98,32,97,115,32,116,104,101,
     32,105,109,112,108,101,109,101,110,116,97,116,105,111,110,32,
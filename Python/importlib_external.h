@@ -11,9 +11,9 @@ const unsigned char _Py_M__importlib_external[] = {
     132,0,0,90,9,0,100,20,0,100,21,0,132,0,0,90,
     10,0,100,22,0,100,23,0,100,24,0,132,1,0,90,11,
     0,101,12,0,101,11,0,106,13,0,131,1,0,90,14,0,
-    100,25,0,106,15,0,100,26,0,100,27,0,131,2,0,100,
-    28,0,23,90,16,0,101,17,0,106,18,0,101,16,0,100,
-    27,0,131,2,0,90,19,0,100,29,0,90,20,0,100,30,
+    100,25,0,160,15,0,100,26,0,100,27,0,161,2,0,100,
+    28,0,23,90,16,0,101,17,0,160,18,0,101,16,0,100,
+    27,0,161,2,0,90,19,0,100,29,0,90,20,0,100,30,
     0,90,21,0,100,31,0,103,1,0,90,22,0,100,32,0,
     103,1,0,90,23,0,101,23,0,4,90,24,0,90,25,0,
     100,33,0,100,34,0,100,33,0,100,35,0,100,36,0,132,
@@ -72,10 +72,10 @@ const unsigned char _Py_M__importlib_external[] = {
     110,32,111,102,32,116,104,105,115,32,109,111,100,117,108,101,
     46,10,10,218,3,119,105,110,218,6,99,121,103,119,105,110,
     218,6,100,97,114,119,105,110,99,0,0,0,0,0,0,0,
-    0,1,0,0,0,2,0,0,0,67,0,0,0,115,49,0,
-    0,0,116,0,0,106,1,0,106,2,0,116,3,0,131,1,
+    0,1,0,0,0,3,0,0,0,67,0,0,0,115,49,0,
+    0,0,116,0,0,106,1,0,160,2,0,116,3,0,161,1,
     0,114,33,0,100,1,0,100,2,0,132,0,0,125,0,0,
-    110,12,0,100,3,0,100,2,0,132,0,0,125,0,0,124,
+    110,12,0,100,3,0,100,2,0,132,0,0,167,0,0,124,
     0,0,83,41,4,78,99,0,0,0,0,0,0,0,0,0,
     0,0,0,2,0,0,0,83,0,0,0,115,13,0,0,0,
     100,1,0,116,0,0,106,1,0,107,6,0,83,41,2,122,
@@ -108,9 +108,9 @@ const unsigned char _Py_M__importlib_external[] = {
     107,101,95,114,101,108,97,120,95,99,97,115,101,28,0,0,
     0,115,8,0,0,0,0,1,18,1,15,4,12,3,114,11,
     0,0,0,99,1,0,0,0,0,0,0,0,1,0,0,0,
-    3,0,0,0,67,0,0,0,115,26,0,0,0,116,0,0,
-    124,0,0,131,1,0,100,1,0,64,106,1,0,100,2,0,
-    100,3,0,131,2,0,83,41,4,122,42,67,111,110,118,101,
+    4,0,0,0,67,0,0,0,115,26,0,0,0,116,0,0,
+    124,0,0,131,1,0,100,1,0,64,160,1,0,100,2,0,
+    100,3,0,161,2,0,83,41,4,122,42,67,111,110,118,101,
     114,116,32,97,32,51,50,45,98,105,116,32,105,110,116,101,
     103,101,114,32,116,111,32,108,105,116,116,108,101,45,101,110,
     100,105,97,110,46,108,3,0,0,0,255,127,255,127,3,0,
@@ -119,9 +119,9 @@ const unsigned char _Py_M__importlib_external[] = {
     218,1,120,114,4,0,0,0,114,4,0,0,0,114,5,0,
     0,0,218,7,95,119,95,108,111,110,103,40,0,0,0,115,
     2,0,0,0,0,2,114,17,0,0,0,99,1,0,0,0,
-    0,0,0,0,1,0,0,0,3,0,0,0,67,0,0,0,
-    115,16,0,0,0,116,0,0,106,1,0,124,0,0,100,1,
-    0,131,2,0,83,41,2,122,47,67,111,110,118,101,114,116,
+    0,0,0,0,1,0,0,0,4,0,0,0,67,0,0,0,
+    115,16,0,0,0,116,0,0,160,1,0,124,0,0,100,1,
+    0,161,2,0,83,41,2,122,47,67,111,110,118,101,114,116,
     32,52,32,98,121,116,101,115,32,105,110,32,108,105,116,116,
     108,101,45,101,110,100,105,97,110,32,116,111,32,97,110,32,
     105,110,116,101,103,101,114,46,114,13,0,0,0,41,2,114,
@@ -130,15 +130,15 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,4,0,0,0,114,5,0,0,0,218,7,95,114,
     95,108,111,110,103,45,0,0,0,115,2,0,0,0,0,2,
     114,19,0,0,0,99,0,0,0,0,0,0,0,0,1,0,
-    0,0,3,0,0,0,71,0,0,0,115,26,0,0,0,116,
-    0,0,106,1,0,100,1,0,100,2,0,132,0,0,124,0,
-    0,68,131,1,0,131,1,0,83,41,3,122,31,82,101,112,
+    0,0,4,0,0,0,71,0,0,0,115,26,0,0,0,116,
+    0,0,160,1,0,100,1,0,100,2,0,132,0,0,124,0,
+    0,68,131,1,0,161,1,0,83,41,3,122,31,82,101,112,
     108,97,99,101,109,101,110,116,32,102,111,114,32,111,115,46,
     112,97,116,104,46,106,111,105,110,40,41,46,99,1,0,0,
-    0,0,0,0,0,2,0,0,0,4,0,0,0,83,0,0,
-    0,115,37,0,0,0,103,0,0,124,0,0,93,27,0,125,
-    1,0,124,1,0,114,6,0,124,1,0,106,0,0,116,1,
-    0,131,1,0,145,2,0,113,6,0,83,114,4,0,0,0,
+    0,0,0,0,0,2,0,0,0,5,0,0,0,83,0,0,
+    0,115,37,0,0,0,103,0,0,124,0,0,93,27,0,167,
+    1,0,124,1,0,114,6,0,124,1,0,160,0,0,116,1,
+    0,161,1,0,145,2,0,113,6,0,83,114,4,0,0,0,
     41,2,218,6,114,115,116,114,105,112,218,15,112,97,116,104,
     95,115,101,112,97,114,97,116,111,114,115,41,2,218,2,46,
     48,218,4,112,97,114,116,114,4,0,0,0,114,4,0,0,
@@ -151,14 +151,14 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,4,0,0,0,114,5,0,0,0,218,10,95,112,
     97,116,104,95,106,111,105,110,50,0,0,0,115,4,0,0,
     0,0,2,15,1,114,28,0,0,0,99,1,0,0,0,0,
-    0,0,0,5,0,0,0,5,0,0,0,67,0,0,0,115,
+    0,0,0,5,0,0,0,6,0,0,0,67,0,0,0,115,
     134,0,0,0,116,0,0,116,1,0,131,1,0,100,1,0,
-    107,2,0,114,52,0,124,0,0,106,2,0,116,3,0,131,
-    1,0,92,3,0,125,1,0,125,2,0,125,3,0,124,1,
+    168,2,0,114,52,0,124,0,0,160,2,0,116,3,0,161,
+    1,0,92,3,0,125,1,0,125,2,0,167,3,0,124,1,
     0,124,3,0,102,2,0,83,120,69,0,116,4,0,124,0,
-    0,131,1,0,68,93,55,0,125,4,0,124,4,0,116,1,
-    0,107,6,0,114,65,0,124,0,0,106,5,0,124,4,0,
-    100,2,0,100,1,0,131,1,1,92,2,0,125,1,0,125,
+    0,131,1,0,68,93,55,0,167,4,0,124,4,0,116,1,
+    0,168,6,0,114,65,0,124,0,0,160,5,0,124,4,0,
+    100,2,0,100,1,0,161,1,1,92,2,0,125,1,0,167,
     3,0,124,1,0,124,3,0,102,2,0,83,113,65,0,87,
     100,3,0,124,0,0,102,2,0,83,41,4,122,32,82,101,
     112,108,97,99,101,109,101,110,116,32,102,111,114,32,111,115,
@@ -173,8 +173,8 @@ const unsigned char _Py_M__importlib_external[] = {
     104,95,115,112,108,105,116,56,0,0,0,115,16,0,0,0,
     0,2,18,1,24,1,10,1,19,1,12,1,27,1,14,1,
     114,38,0,0,0,99,1,0,0,0,0,0,0,0,1,0,
-    0,0,2,0,0,0,67,0,0,0,115,13,0,0,0,116,
-    0,0,106,1,0,124,0,0,131,1,0,83,41,1,122,126,
+    0,0,3,0,0,0,67,0,0,0,115,13,0,0,0,116,
+    0,0,160,1,0,124,0,0,161,1,0,83,41,1,122,126,
     83,116,97,116,32,116,104,101,32,112,97,116,104,46,10,10,
     32,32,32,32,77,97,100,101,32,97,32,115,101,112,97,114,
     97,116,101,32,102,117,110,99,116,105,111,110,32,116,111,32,
@@ -189,9 +189,9 @@ const unsigned char _Py_M__importlib_external[] = {
     0,115,2,0,0,0,0,7,114,39,0,0,0,99,2,0,
     0,0,0,0,0,0,3,0,0,0,11,0,0,0,67,0,
     0,0,115,58,0,0,0,121,16,0,116,0,0,124,0,0,
-    131,1,0,125,2,0,87,110,22,0,4,116,1,0,107,10,
+    131,1,0,125,2,0,87,110,22,0,4,116,1,0,168,10,
     0,114,40,0,1,1,1,100,1,0,83,89,110,1,0,88,
-    124,2,0,106,2,0,100,2,0,64,124,1,0,107,2,0,
+    166,2,0,106,2,0,100,2,0,64,124,1,0,107,2,0,
     83,41,3,122,49,84,101,115,116,32,119,104,101,116,104,101,
     114,32,116,104,101,32,112,97,116,104,32,105,115,32,116,104,
     101,32,115,112,101,99,105,102,105,101,100,32,109,111,100,101,
@@ -213,7 +213,7 @@ const unsigned char _Py_M__importlib_external[] = {
     108,101,87,0,0,0,115,2,0,0,0,0,2,114,44,0,
     0,0,99,1,0,0,0,0,0,0,0,1,0,0,0,3,
     0,0,0,67,0,0,0,115,31,0,0,0,124,0,0,115,
-    18,0,116,0,0,106,1,0,131,0,0,125,0,0,116,2,
+    18,0,116,0,0,160,1,0,161,0,0,125,0,0,116,2,
     0,124,0,0,100,1,0,131,2,0,83,41,2,122,30,82,
     101,112,108,97,99,101,109,101,110,116,32,102,111,114,32,111,
     115,46,112,97,116,104,46,105,115,100,105,114,46,105,0,64,
@@ -223,18 +223,18 @@ const unsigned char _Py_M__importlib_external[] = {
     97,116,104,95,105,115,100,105,114,92,0,0,0,115,6,0,
     0,0,0,2,6,1,12,1,114,46,0,0,0,105,182,1,
     0,0,99,3,0,0,0,0,0,0,0,6,0,0,0,17,
-    0,0,0,67,0,0,0,115,193,0,0,0,100,1,0,106,
-    0,0,124,0,0,116,1,0,124,0,0,131,1,0,131,2,
-    0,125,3,0,116,2,0,106,3,0,124,3,0,116,2,0,
+    0,0,0,67,0,0,0,115,193,0,0,0,100,1,0,160,
+    0,0,124,0,0,116,1,0,124,0,0,131,1,0,161,2,
+    0,125,3,0,116,2,0,160,3,0,124,3,0,116,2,0,
     106,4,0,116,2,0,106,5,0,66,116,2,0,106,6,0,
-    66,124,2,0,100,2,0,64,131,3,0,125,4,0,121,61,
-    0,116,7,0,106,8,0,124,4,0,100,3,0,131,2,0,
-    143,20,0,125,5,0,124,5,0,106,9,0,124,1,0,131,
-    1,0,1,87,100,4,0,81,82,88,116,2,0,106,10,0,
-    124,3,0,124,0,0,131,2,0,1,87,110,59,0,4,116,
-    11,0,107,10,0,114,188,0,1,1,1,121,17,0,116,2,
-    0,106,12,0,124,3,0,131,1,0,1,87,110,18,0,4,
-    116,11,0,107,10,0,114,180,0,1,1,1,89,110,1,0,
+    66,124,2,0,100,2,0,64,161,3,0,125,4,0,121,61,
+    0,116,7,0,160,8,0,124,4,0,100,3,0,161,2,0,
+    143,20,0,167,5,0,124,5,0,160,9,0,124,1,0,161,
+    1,0,1,87,100,4,0,81,82,88,116,2,0,160,10,0,
+    165,3,0,124,0,0,161,2,0,1,87,110,59,0,4,116,
+    11,0,168,10,0,114,188,0,1,1,1,121,17,0,116,2,
+    0,160,12,0,124,3,0,161,1,0,1,87,110,18,0,4,
+    116,11,0,168,10,0,114,180,0,1,1,1,89,110,1,0,
     88,130,0,0,89,110,1,0,88,100,4,0,83,41,5,122,
     162,66,101,115,116,45,101,102,102,111,114,116,32,102,117,110,
     99,116,105,111,110,32,116,111,32,119,114,105,116,101,32,100,
@@ -259,33 +259,33 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,5,0,0,0,218,13,95,119,114,105,116,101,95,
     97,116,111,109,105,99,99,0,0,0,115,26,0,0,0,0,
     5,24,1,9,1,33,1,3,3,21,1,20,1,20,1,13,
-    1,3,1,17,1,13,1,5,1,114,55,0,0,0,105,22,
+    1,3,1,17,1,13,1,5,1,114,55,0,0,0,105,24,
     13,0,0,233,2,0,0,0,114,13,0,0,0,115,2,0,
     0,0,13,10,90,11,95,95,112,121,99,97,99,104,101,95,
     95,122,4,111,112,116,45,122,3,46,112,121,122,4,46,112,
     121,99,78,218,12,111,112,116,105,109,105,122,97,116,105,111,
     110,99,2,0,0,0,1,0,0,0,11,0,0,0,6,0,
     0,0,67,0,0,0,115,87,1,0,0,124,1,0,100,1,
-    0,107,9,0,114,76,0,116,0,0,106,1,0,100,2,0,
-    116,2,0,131,2,0,1,124,2,0,100,1,0,107,9,0,
+    0,168,9,0,114,76,0,116,0,0,160,1,0,100,2,0,
+    116,2,0,161,2,0,1,124,2,0,100,1,0,168,9,0,
     114,58,0,100,3,0,125,3,0,116,3,0,124,3,0,131,
     1,0,130,1,0,124,1,0,114,70,0,100,4,0,110,3,
     0,100,5,0,125,2,0,116,4,0,124,0,0,131,1,0,
-    92,2,0,125,4,0,125,5,0,124,5,0,106,5,0,100,
-    6,0,131,1,0,92,3,0,125,6,0,125,7,0,125,8,
-    0,116,6,0,106,7,0,106,8,0,125,9,0,124,9,0,
-    100,1,0,107,8,0,114,154,0,116,9,0,100,7,0,131,
-    1,0,130,1,0,100,4,0,106,10,0,124,6,0,114,172,
-    0,124,6,0,110,3,0,124,8,0,124,7,0,124,9,0,
-    103,3,0,131,1,0,125,10,0,124,2,0,100,1,0,107,
+    92,2,0,125,4,0,167,5,0,124,5,0,160,5,0,100,
+    6,0,161,1,0,92,3,0,125,6,0,125,7,0,125,8,
+    0,116,6,0,106,7,0,106,8,0,167,9,0,124,9,0,
+    100,1,0,168,8,0,114,154,0,116,9,0,100,7,0,131,
+    1,0,130,1,0,100,4,0,160,10,0,124,6,0,114,172,
+    0,124,6,0,110,3,0,165,8,0,124,7,0,124,9,0,
+    103,3,0,161,1,0,167,10,0,124,2,0,100,1,0,168,
     8,0,114,241,0,116,6,0,106,11,0,106,12,0,100,8,
-    0,107,2,0,114,229,0,100,4,0,125,2,0,110,12,0,
+    0,168,2,0,114,229,0,100,4,0,125,2,0,110,12,0,
     116,6,0,106,11,0,106,12,0,125,2,0,116,13,0,124,
-    2,0,131,1,0,125,2,0,124,2,0,100,4,0,107,3,
-    0,114,63,1,124,2,0,106,14,0,131,0,0,115,42,1,
-    116,15,0,100,9,0,106,16,0,124,2,0,131,1,0,131,
-    1,0,130,1,0,100,10,0,106,16,0,124,10,0,116,17,
-    0,124,2,0,131,3,0,125,10,0,116,18,0,124,4,0,
+    2,0,131,1,0,167,2,0,124,2,0,100,4,0,168,3,
+    0,114,63,1,124,2,0,160,14,0,161,0,0,115,42,1,
+    116,15,0,100,9,0,160,16,0,124,2,0,161,1,0,131,
+    1,0,130,1,0,100,10,0,160,16,0,124,10,0,116,17,
+    0,124,2,0,161,3,0,125,10,0,116,18,0,124,4,0,
     116,19,0,124,10,0,116,20,0,100,8,0,25,23,131,3,
     0,83,41,11,97,254,2,0,0,71,105,118,101,110,32,116,
     104,101,32,112,97,116,104,32,116,111,32,97,32,46,112,121,
@@ -369,31 +369,31 @@ const unsigned char _Py_M__importlib_external[] = {
     116,97,103,90,15,97,108,109,111,115,116,95,102,105,108,101,
     110,97,109,101,114,4,0,0,0,114,4,0,0,0,114,5,
     0,0,0,218,17,99,97,99,104,101,95,102,114,111,109,95,
-    115,111,117,114,99,101,246,0,0,0,115,46,0,0,0,0,
+    115,111,117,114,99,101,248,0,0,0,115,46,0,0,0,0,
     18,12,1,9,1,7,1,12,1,6,1,12,1,18,1,18,
     1,24,1,12,1,12,1,12,1,36,1,12,1,18,1,9,
     2,12,1,12,1,12,1,12,1,21,1,21,1,114,79,0,
     0,0,99,1,0,0,0,0,0,0,0,8,0,0,0,5,
     0,0,0,67,0,0,0,115,62,1,0,0,116,0,0,106,
-    1,0,106,2,0,100,1,0,107,8,0,114,30,0,116,3,
+    1,0,106,2,0,100,1,0,168,8,0,114,30,0,116,3,
     0,100,2,0,131,1,0,130,1,0,116,4,0,124,0,0,
     131,1,0,92,2,0,125,1,0,125,2,0,116,4,0,124,
-    1,0,131,1,0,92,2,0,125,1,0,125,3,0,124,3,
-    0,116,5,0,107,3,0,114,102,0,116,6,0,100,3,0,
-    106,7,0,116,5,0,124,0,0,131,2,0,131,1,0,130,
-    1,0,124,2,0,106,8,0,100,4,0,131,1,0,125,4,
-    0,124,4,0,100,11,0,107,7,0,114,153,0,116,6,0,
-    100,7,0,106,7,0,124,2,0,131,1,0,131,1,0,130,
-    1,0,110,125,0,124,4,0,100,6,0,107,2,0,114,22,
-    1,124,2,0,106,9,0,100,4,0,100,5,0,131,2,0,
-    100,12,0,25,125,5,0,124,5,0,106,10,0,116,11,0,
-    131,1,0,115,223,0,116,6,0,100,8,0,106,7,0,116,
-    11,0,131,1,0,131,1,0,130,1,0,124,5,0,116,12,
-    0,116,11,0,131,1,0,100,1,0,133,2,0,25,125,6,
-    0,124,6,0,106,13,0,131,0,0,115,22,1,116,6,0,
-    100,9,0,106,7,0,124,5,0,131,1,0,131,1,0,130,
-    1,0,124,2,0,106,14,0,100,4,0,131,1,0,100,10,
-    0,25,125,7,0,116,15,0,124,1,0,124,7,0,116,16,
+    1,0,131,1,0,92,2,0,125,1,0,167,3,0,124,3,
+    0,116,5,0,168,3,0,114,102,0,116,6,0,100,3,0,
+    160,7,0,116,5,0,124,0,0,161,2,0,131,1,0,130,
+    1,0,124,2,0,160,8,0,100,4,0,161,1,0,167,4,
+    0,124,4,0,100,11,0,168,7,0,114,153,0,116,6,0,
+    100,7,0,160,7,0,124,2,0,161,1,0,131,1,0,130,
+    1,0,110,125,0,124,4,0,100,6,0,168,2,0,114,22,
+    1,124,2,0,160,9,0,100,4,0,100,5,0,161,2,0,
+    100,12,0,25,167,5,0,124,5,0,160,10,0,116,11,0,
+    161,1,0,115,223,0,116,6,0,100,8,0,160,7,0,116,
+    11,0,161,1,0,131,1,0,130,1,0,124,5,0,116,12,
+    0,116,11,0,131,1,0,100,1,0,133,2,0,25,167,6,
+    0,124,6,0,160,13,0,161,0,0,115,22,1,116,6,0,
+    100,9,0,160,7,0,124,5,0,161,1,0,131,1,0,130,
+    1,0,124,2,0,160,14,0,100,4,0,161,1,0,100,10,
+    0,25,125,7,0,116,15,0,165,1,0,124,7,0,116,16,
     0,100,10,0,25,23,131,2,0,83,41,13,97,110,1,0,
     0,71,105,118,101,110,32,116,104,101,32,112,97,116,104,32,
     116,111,32,97,32,46,112,121,99,46,32,102,105,108,101,44,
@@ -448,19 +448,19 @@ const unsigned char _Py_M__importlib_external[] = {
     95,108,101,118,101,108,90,13,98,97,115,101,95,102,105,108,
     101,110,97,109,101,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,17,115,111,117,114,99,101,95,102,114,111,
-    109,95,99,97,99,104,101,34,1,0,0,115,44,0,0,0,
+    109,95,99,97,99,104,101,36,1,0,0,115,44,0,0,0,
     0,9,18,1,12,1,18,1,18,1,12,1,9,1,15,1,
     15,1,12,1,9,1,15,1,12,1,22,1,15,1,9,1,
     12,1,22,1,12,1,9,1,12,1,19,1,114,85,0,0,
     0,99,1,0,0,0,0,0,0,0,5,0,0,0,12,0,
     0,0,67,0,0,0,115,164,0,0,0,116,0,0,124,0,
-    0,131,1,0,100,1,0,107,2,0,114,22,0,100,2,0,
-    83,124,0,0,106,1,0,100,3,0,131,1,0,92,3,0,
-    125,1,0,125,2,0,125,3,0,124,1,0,12,115,81,0,
-    124,3,0,106,2,0,131,0,0,100,7,0,100,8,0,133,
-    2,0,25,100,6,0,107,3,0,114,85,0,124,0,0,83,
+    0,131,1,0,100,1,0,168,2,0,114,22,0,100,2,0,
+    83,124,0,0,160,1,0,100,3,0,161,1,0,92,3,0,
+    125,1,0,125,2,0,167,3,0,124,1,0,12,115,81,0,
+    124,3,0,160,2,0,161,0,0,100,7,0,100,8,0,133,
+    2,0,25,100,6,0,168,3,0,114,85,0,124,0,0,83,
     121,16,0,116,3,0,124,0,0,131,1,0,125,4,0,87,
-    110,40,0,4,116,4,0,116,5,0,102,2,0,107,10,0,
+    110,40,0,4,116,4,0,116,5,0,102,2,0,168,10,0,
     114,143,0,1,1,1,124,0,0,100,2,0,100,9,0,133,
     2,0,25,125,4,0,89,110,1,0,88,116,6,0,124,4,
     0,131,1,0,114,160,0,124,4,0,83,124,0,0,83,41,
@@ -486,28 +486,28 @@ const unsigned char _Py_M__importlib_external[] = {
     115,105,111,110,218,11,115,111,117,114,99,101,95,112,97,116,
     104,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
     218,15,95,103,101,116,95,115,111,117,114,99,101,102,105,108,
-    101,67,1,0,0,115,20,0,0,0,0,7,18,1,4,1,
+    101,69,1,0,0,115,20,0,0,0,0,7,18,1,4,1,
     24,1,35,1,4,1,3,1,16,1,19,1,21,1,114,91,
     0,0,0,99,1,0,0,0,0,0,0,0,1,0,0,0,
     11,0,0,0,67,0,0,0,115,92,0,0,0,124,0,0,
-    106,0,0,116,1,0,116,2,0,131,1,0,131,1,0,114,
+    160,0,0,116,1,0,116,2,0,131,1,0,161,1,0,114,
     59,0,121,14,0,116,3,0,124,0,0,131,1,0,83,87,
-    113,88,0,4,116,4,0,107,10,0,114,55,0,1,1,1,
-    89,113,88,0,88,110,29,0,124,0,0,106,0,0,116,1,
-    0,116,5,0,131,1,0,131,1,0,114,84,0,124,0,0,
+    113,88,0,4,116,4,0,168,10,0,114,55,0,1,1,1,
+    89,113,88,0,88,110,29,0,124,0,0,160,0,0,116,1,
+    0,116,5,0,131,1,0,161,1,0,114,84,0,124,0,0,
     83,100,0,0,83,100,0,0,83,41,1,78,41,6,218,8,
     101,110,100,115,119,105,116,104,218,5,116,117,112,108,101,114,
     84,0,0,0,114,79,0,0,0,114,66,0,0,0,114,74,
     0,0,0,41,1,218,8,102,105,108,101,110,97,109,101,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,11,
-    95,103,101,116,95,99,97,99,104,101,100,86,1,0,0,115,
+    95,103,101,116,95,99,97,99,104,101,100,88,1,0,0,115,
     16,0,0,0,0,1,21,1,3,1,14,1,13,1,8,1,
     21,1,4,2,114,95,0,0,0,99,1,0,0,0,0,0,
     0,0,2,0,0,0,11,0,0,0,67,0,0,0,115,60,
     0,0,0,121,19,0,116,0,0,124,0,0,131,1,0,106,
-    1,0,125,1,0,87,110,24,0,4,116,2,0,107,10,0,
+    1,0,125,1,0,87,110,24,0,4,116,2,0,168,10,0,
     114,45,0,1,1,1,100,1,0,125,1,0,89,110,1,0,
-    88,124,1,0,100,2,0,79,125,1,0,124,1,0,83,41,
+    88,124,1,0,100,2,0,79,167,1,0,124,1,0,83,41,
     3,122,51,67,97,108,99,117,108,97,116,101,32,116,104,101,
     32,109,111,100,101,32,112,101,114,109,105,115,115,105,111,110,
     115,32,102,111,114,32,97,32,98,121,116,101,99,111,100,101,
@@ -515,14 +515,14 @@ const unsigned char _Py_M__importlib_external[] = {
     41,3,114,39,0,0,0,114,41,0,0,0,114,40,0,0,
     0,41,2,114,35,0,0,0,114,42,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,218,10,95,99,
-    97,108,99,95,109,111,100,101,98,1,0,0,115,12,0,0,
+    97,108,99,95,109,111,100,101,100,1,0,0,115,12,0,0,
     0,0,2,3,1,19,1,13,1,11,3,10,1,114,97,0,
     0,0,218,9,118,101,114,98,111,115,105,116,121,114,29,0,
     0,0,99,1,0,0,0,1,0,0,0,3,0,0,0,4,
     0,0,0,71,0,0,0,115,75,0,0,0,116,0,0,106,
-    1,0,106,2,0,124,1,0,107,5,0,114,71,0,124,0,
-    0,106,3,0,100,6,0,131,1,0,115,43,0,100,3,0,
-    124,0,0,23,125,0,0,116,4,0,124,0,0,106,5,0,
+    1,0,106,2,0,124,1,0,168,5,0,114,71,0,124,0,
+    0,160,3,0,100,6,0,161,1,0,115,43,0,100,3,0,
+    124,0,0,23,125,0,0,116,4,0,166,0,0,106,5,0,
     124,2,0,140,0,0,100,4,0,116,0,0,106,6,0,131,
     1,1,1,100,5,0,83,41,7,122,61,80,114,105,110,116,
     32,116,104,101,32,109,101,115,115,97,103,101,32,116,111,32,
@@ -536,14 +536,14 @@ const unsigned char _Py_M__importlib_external[] = {
     218,6,115,116,100,101,114,114,41,3,114,75,0,0,0,114,
     98,0,0,0,218,4,97,114,103,115,114,4,0,0,0,114,
     4,0,0,0,114,5,0,0,0,218,16,95,118,101,114,98,
-    111,115,101,95,109,101,115,115,97,103,101,110,1,0,0,115,
+    111,115,101,95,109,101,115,115,97,103,101,112,1,0,0,115,
     8,0,0,0,0,2,18,1,15,1,10,1,114,105,0,0,
     0,99,1,0,0,0,0,0,0,0,3,0,0,0,11,0,
     0,0,3,0,0,0,115,84,0,0,0,100,1,0,135,0,
     0,102,1,0,100,2,0,100,3,0,134,1,0,125,1,0,
     121,13,0,116,0,0,106,1,0,125,2,0,87,110,30,0,
-    4,116,2,0,107,10,0,114,66,0,1,1,1,100,4,0,
-    100,5,0,132,0,0,125,2,0,89,110,1,0,88,124,2,
+    4,116,2,0,168,10,0,114,66,0,1,1,1,100,4,0,
+    100,5,0,132,0,0,125,2,0,89,110,1,0,88,165,2,
     0,124,1,0,136,0,0,131,2,0,1,124,1,0,83,41,
     6,122,252,68,101,99,111,114,97,116,111,114,32,116,111,32,
     118,101,114,105,102,121,32,116,104,97,116,32,116,104,101,32,
@@ -563,11 +563,11 @@ const unsigned char _Py_M__importlib_external[] = {
     115,32,114,97,105,115,101,100,46,10,10,32,32,32,32,78,
     99,2,0,0,0,0,0,0,0,4,0,0,0,5,0,0,
     0,31,0,0,0,115,89,0,0,0,124,1,0,100,0,0,
-    107,8,0,114,24,0,124,0,0,106,0,0,125,1,0,110,
-    46,0,124,0,0,106,0,0,124,1,0,107,3,0,114,70,
-    0,116,1,0,100,1,0,124,0,0,106,0,0,124,1,0,
+    168,8,0,114,24,0,166,0,0,106,0,0,125,1,0,110,
+    46,0,166,0,0,106,0,0,124,1,0,168,3,0,114,70,
+    0,116,1,0,100,1,0,166,0,0,106,0,0,124,1,0,
     102,2,0,22,100,2,0,124,1,0,131,1,1,130,1,0,
-    136,0,0,124,0,0,124,1,0,124,2,0,124,3,0,142,
+    136,0,0,165,0,0,124,1,0,165,2,0,124,3,0,142,
     2,0,83,41,3,78,122,30,108,111,97,100,101,114,32,102,
     111,114,32,37,115,32,99,97,110,110,111,116,32,104,97,110,
     100,108,101,32,37,115,218,4,110,97,109,101,41,2,114,106,
@@ -576,18 +576,18 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,90,6,107,119,97,114,103,115,41,1,218,6,109,101,
     116,104,111,100,114,4,0,0,0,114,5,0,0,0,218,19,
     95,99,104,101,99,107,95,110,97,109,101,95,119,114,97,112,
-    112,101,114,126,1,0,0,115,12,0,0,0,0,1,12,1,
+    112,101,114,128,1,0,0,115,12,0,0,0,0,1,12,1,
     12,1,15,1,6,1,25,1,122,40,95,99,104,101,99,107,
     95,110,97,109,101,46,60,108,111,99,97,108,115,62,46,95,
     99,104,101,99,107,95,110,97,109,101,95,119,114,97,112,112,
     101,114,99,2,0,0,0,0,0,0,0,3,0,0,0,7,
     0,0,0,83,0,0,0,115,92,0,0,0,120,66,0,100,
     1,0,100,2,0,100,3,0,100,4,0,103,4,0,68,93,
-    46,0,125,2,0,116,0,0,124,1,0,124,2,0,131,2,
-    0,114,19,0,116,1,0,124,0,0,124,2,0,116,2,0,
-    124,1,0,124,2,0,131,2,0,131,3,0,1,113,19,0,
-    87,124,0,0,106,3,0,106,4,0,124,1,0,106,3,0,
-    131,1,0,1,100,0,0,83,41,5,78,218,10,95,95,109,
+    46,0,125,2,0,116,0,0,165,1,0,124,2,0,131,2,
+    0,114,19,0,116,1,0,165,0,0,124,2,0,116,2,0,
+    165,1,0,124,2,0,131,2,0,131,3,0,1,113,19,0,
+    87,166,0,0,106,3,0,160,4,0,166,1,0,106,3,0,
+    161,1,0,1,100,0,0,83,41,5,78,218,10,95,95,109,
     111,100,117,108,101,95,95,218,8,95,95,110,97,109,101,95,
     95,218,12,95,95,113,117,97,108,110,97,109,101,95,95,218,
     7,95,95,100,111,99,95,95,41,5,218,7,104,97,115,97,
@@ -595,7 +595,7 @@ const unsigned char _Py_M__importlib_external[] = {
     116,97,116,116,114,218,8,95,95,100,105,99,116,95,95,218,
     6,117,112,100,97,116,101,41,3,90,3,110,101,119,90,3,
     111,108,100,114,52,0,0,0,114,4,0,0,0,114,4,0,
-    0,0,114,5,0,0,0,218,5,95,119,114,97,112,137,1,
+    0,0,114,5,0,0,0,218,5,95,119,114,97,112,139,1,
     0,0,115,8,0,0,0,0,1,25,1,15,1,29,1,122,
     26,95,99,104,101,99,107,95,110,97,109,101,46,60,108,111,
     99,97,108,115,62,46,95,119,114,97,112,41,3,218,10,95,
@@ -603,15 +603,15 @@ const unsigned char _Py_M__importlib_external[] = {
     78,97,109,101,69,114,114,111,114,41,3,114,109,0,0,0,
     114,110,0,0,0,114,120,0,0,0,114,4,0,0,0,41,
     1,114,109,0,0,0,114,5,0,0,0,218,11,95,99,104,
-    101,99,107,95,110,97,109,101,118,1,0,0,115,14,0,0,
+    101,99,107,95,110,97,109,101,120,1,0,0,115,14,0,0,
     0,0,8,21,7,3,1,13,1,13,2,17,5,13,1,114,
     123,0,0,0,99,2,0,0,0,0,0,0,0,5,0,0,
-    0,4,0,0,0,67,0,0,0,115,84,0,0,0,124,0,
-    0,106,0,0,124,1,0,131,1,0,92,2,0,125,2,0,
-    125,3,0,124,2,0,100,1,0,107,8,0,114,80,0,116,
+    0,6,0,0,0,67,0,0,0,115,84,0,0,0,124,0,
+    0,160,0,0,124,1,0,161,1,0,92,2,0,125,2,0,
+    167,3,0,124,2,0,100,1,0,168,8,0,114,80,0,116,
     1,0,124,3,0,131,1,0,114,80,0,100,2,0,125,4,
-    0,116,2,0,106,3,0,124,4,0,106,4,0,124,3,0,
-    100,3,0,25,131,1,0,116,5,0,131,2,0,1,124,2,
+    0,116,2,0,160,3,0,124,4,0,160,4,0,124,3,0,
+    100,3,0,25,161,1,0,116,5,0,161,2,0,1,124,2,
     0,83,41,4,122,155,84,114,121,32,116,111,32,102,105,110,
     100,32,97,32,108,111,97,100,101,114,32,102,111,114,32,116,
     104,101,32,115,112,101,99,105,102,105,101,100,32,109,111,100,
@@ -633,39 +633,39 @@ const unsigned char _Py_M__importlib_external[] = {
     218,8,112,111,114,116,105,111,110,115,218,3,109,115,103,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,17,
     95,102,105,110,100,95,109,111,100,117,108,101,95,115,104,105,
-    109,146,1,0,0,115,10,0,0,0,0,10,21,1,24,1,
+    109,148,1,0,0,115,10,0,0,0,0,10,21,1,24,1,
     6,1,29,1,114,130,0,0,0,99,4,0,0,0,0,0,
-    0,0,11,0,0,0,19,0,0,0,67,0,0,0,115,240,
-    1,0,0,105,0,0,125,4,0,124,2,0,100,1,0,107,
-    9,0,114,31,0,124,2,0,124,4,0,100,2,0,60,110,
-    6,0,100,3,0,125,2,0,124,3,0,100,1,0,107,9,
-    0,114,59,0,124,3,0,124,4,0,100,4,0,60,124,0,
-    0,100,1,0,100,5,0,133,2,0,25,125,5,0,124,0,
-    0,100,5,0,100,6,0,133,2,0,25,125,6,0,124,0,
-    0,100,6,0,100,7,0,133,2,0,25,125,7,0,124,5,
-    0,116,0,0,107,3,0,114,168,0,100,8,0,106,1,0,
-    124,2,0,124,5,0,131,2,0,125,8,0,116,2,0,100,
-    9,0,124,8,0,131,2,0,1,116,3,0,124,8,0,124,
+    0,0,11,0,0,0,20,0,0,0,67,0,0,0,115,240,
+    1,0,0,105,0,0,167,4,0,124,2,0,100,1,0,168,
+    9,0,114,31,0,165,2,0,124,4,0,100,2,0,60,110,
+    6,0,100,3,0,167,2,0,124,3,0,100,1,0,168,9,
+    0,114,59,0,165,3,0,124,4,0,100,4,0,60,124,0,
+    0,100,1,0,100,5,0,133,2,0,25,167,5,0,124,0,
+    0,100,5,0,100,6,0,133,2,0,25,167,6,0,124,0,
+    0,100,6,0,100,7,0,133,2,0,25,167,7,0,124,5,
+    0,116,0,0,168,3,0,114,168,0,100,8,0,160,1,0,
+    165,2,0,124,5,0,161,2,0,125,8,0,116,2,0,100,
+    9,0,124,8,0,131,2,0,1,116,3,0,165,8,0,124,
     4,0,141,1,0,130,1,0,110,119,0,116,4,0,124,6,
-    0,131,1,0,100,5,0,107,3,0,114,229,0,100,10,0,
-    106,1,0,124,2,0,131,1,0,125,8,0,116,2,0,100,
+    0,131,1,0,100,5,0,168,3,0,114,229,0,100,10,0,
+    160,1,0,124,2,0,161,1,0,125,8,0,116,2,0,100,
     9,0,124,8,0,131,2,0,1,116,5,0,124,8,0,131,
     1,0,130,1,0,110,58,0,116,4,0,124,7,0,131,1,
-    0,100,5,0,107,3,0,114,31,1,100,11,0,106,1,0,
-    124,2,0,131,1,0,125,8,0,116,2,0,100,9,0,124,
+    0,100,5,0,168,3,0,114,31,1,100,11,0,160,1,0,
+    124,2,0,161,1,0,125,8,0,116,2,0,100,9,0,124,
     8,0,131,2,0,1,116,5,0,124,8,0,131,1,0,130,
-    1,0,124,1,0,100,1,0,107,9,0,114,226,1,121,20,
+    1,0,124,1,0,100,1,0,168,9,0,114,226,1,121,20,
     0,116,6,0,124,1,0,100,12,0,25,131,1,0,125,9,
-    0,87,110,18,0,4,116,7,0,107,10,0,114,83,1,1,
+    0,87,110,18,0,4,116,7,0,168,10,0,114,83,1,1,
     1,1,89,110,62,0,88,116,8,0,124,6,0,131,1,0,
-    124,9,0,107,3,0,114,145,1,100,13,0,106,1,0,124,
-    2,0,131,1,0,125,8,0,116,2,0,100,9,0,124,8,
-    0,131,2,0,1,116,3,0,124,8,0,124,4,0,141,1,
+    124,9,0,168,3,0,114,145,1,100,13,0,160,1,0,124,
+    2,0,161,1,0,125,8,0,116,2,0,100,9,0,124,8,
+    0,131,2,0,1,116,3,0,165,8,0,124,4,0,141,1,
     0,130,1,0,121,18,0,124,1,0,100,14,0,25,100,15,
-    0,64,125,10,0,87,110,18,0,4,116,7,0,107,10,0,
+    0,64,125,10,0,87,110,18,0,4,116,7,0,168,10,0,
     114,183,1,1,1,1,89,110,43,0,88,116,8,0,124,7,
-    0,131,1,0,124,10,0,107,3,0,114,226,1,116,3,0,
-    100,13,0,106,1,0,124,2,0,131,1,0,124,4,0,141,
+    0,131,1,0,124,10,0,168,3,0,114,226,1,116,3,0,
+    100,13,0,160,1,0,124,2,0,161,1,0,124,4,0,141,
     1,0,130,1,0,124,0,0,100,7,0,100,1,0,133,2,
     0,25,83,41,16,97,122,1,0,0,86,97,108,105,100,97,
     116,101,32,116,104,101,32,104,101,97,100,101,114,32,111,102,
@@ -718,7 +718,7 @@ const unsigned char _Py_M__importlib_external[] = {
     109,101,218,11,115,111,117,114,99,101,95,115,105,122,101,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,25,
     95,118,97,108,105,100,97,116,101,95,98,121,116,101,99,111,
-    100,101,95,104,101,97,100,101,114,163,1,0,0,115,76,0,
+    100,101,95,104,101,97,100,101,114,165,1,0,0,115,76,0,
     0,0,0,11,6,1,12,1,13,3,6,1,12,1,10,1,
     16,1,16,1,16,1,12,1,18,1,13,1,18,1,18,1,
     15,1,13,1,15,1,18,1,15,1,13,1,12,1,12,1,
@@ -726,12 +726,12 @@ const unsigned char _Py_M__importlib_external[] = {
     3,1,18,1,13,1,5,2,18,1,15,1,9,1,114,141,
     0,0,0,99,4,0,0,0,0,0,0,0,5,0,0,0,
     6,0,0,0,67,0,0,0,115,112,0,0,0,116,0,0,
-    106,1,0,124,0,0,131,1,0,125,4,0,116,2,0,124,
+    160,1,0,124,0,0,161,1,0,125,4,0,116,2,0,124,
     4,0,116,3,0,131,2,0,114,75,0,116,4,0,100,1,
-    0,124,2,0,131,2,0,1,124,3,0,100,2,0,107,9,
-    0,114,71,0,116,5,0,106,6,0,124,4,0,124,3,0,
-    131,2,0,1,124,4,0,83,116,7,0,100,3,0,106,8,
-    0,124,2,0,131,1,0,100,4,0,124,1,0,100,5,0,
+    0,124,2,0,131,2,0,1,124,3,0,100,2,0,168,9,
+    0,114,71,0,116,5,0,160,6,0,165,4,0,124,3,0,
+    161,2,0,1,124,4,0,83,116,7,0,100,3,0,160,8,
+    0,124,2,0,161,1,0,100,4,0,124,1,0,100,5,0,
     124,2,0,131,1,2,130,1,0,100,2,0,83,41,6,122,
     60,67,111,109,112,105,108,101,32,98,121,116,101,99,111,100,
     101,32,97,115,32,114,101,116,117,114,110,101,100,32,98,121,
@@ -749,15 +749,15 @@ const unsigned char _Py_M__importlib_external[] = {
     114,106,0,0,0,114,89,0,0,0,114,90,0,0,0,218,
     4,99,111,100,101,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,17,95,99,111,109,112,105,108,101,95,98,
-    121,116,101,99,111,100,101,218,1,0,0,115,16,0,0,0,
+    121,116,101,99,111,100,101,220,1,0,0,115,16,0,0,0,
     0,2,15,1,15,1,13,1,12,1,16,1,4,2,18,1,
     114,147,0,0,0,114,59,0,0,0,99,3,0,0,0,0,
-    0,0,0,4,0,0,0,3,0,0,0,67,0,0,0,115,
-    76,0,0,0,116,0,0,116,1,0,131,1,0,125,3,0,
-    124,3,0,106,2,0,116,3,0,124,1,0,131,1,0,131,
-    1,0,1,124,3,0,106,2,0,116,3,0,124,2,0,131,
-    1,0,131,1,0,1,124,3,0,106,2,0,116,4,0,106,
-    5,0,124,0,0,131,1,0,131,1,0,1,124,3,0,83,
+    0,0,0,4,0,0,0,5,0,0,0,67,0,0,0,115,
+    76,0,0,0,116,0,0,116,1,0,131,1,0,167,3,0,
+    124,3,0,160,2,0,116,3,0,124,1,0,131,1,0,161,
+    1,0,1,124,3,0,160,2,0,116,3,0,124,2,0,131,
+    1,0,161,1,0,1,124,3,0,160,2,0,116,4,0,160,
+    5,0,124,0,0,161,1,0,161,1,0,1,124,3,0,83,
     41,1,122,80,67,111,109,112,105,108,101,32,97,32,99,111,
     100,101,32,111,98,106,101,99,116,32,105,110,116,111,32,98,
     121,116,101,99,111,100,101,32,102,111,114,32,119,114,105,116,
@@ -769,15 +769,15 @@ const unsigned char _Py_M__importlib_external[] = {
     4,114,146,0,0,0,114,133,0,0,0,114,140,0,0,0,
     114,53,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,17,95,99,111,100,101,95,116,111,95,98,
-    121,116,101,99,111,100,101,230,1,0,0,115,10,0,0,0,
+    121,116,101,99,111,100,101,232,1,0,0,115,10,0,0,0,
     0,3,12,1,19,1,19,1,22,1,114,150,0,0,0,99,
-    1,0,0,0,0,0,0,0,5,0,0,0,4,0,0,0,
+    1,0,0,0,0,0,0,0,5,0,0,0,6,0,0,0,
     67,0,0,0,115,89,0,0,0,100,1,0,100,2,0,108,
-    0,0,125,1,0,116,1,0,106,2,0,124,0,0,131,1,
-    0,106,3,0,125,2,0,124,1,0,106,4,0,124,2,0,
-    131,1,0,125,3,0,116,1,0,106,5,0,100,2,0,100,
-    3,0,131,2,0,125,4,0,124,4,0,106,6,0,124,0,
-    0,106,6,0,124,3,0,100,1,0,25,131,1,0,131,1,
+    0,0,125,1,0,116,1,0,160,2,0,124,0,0,161,1,
+    0,106,3,0,167,2,0,124,1,0,160,4,0,124,2,0,
+    161,1,0,125,3,0,116,1,0,160,5,0,100,2,0,100,
+    3,0,161,2,0,167,4,0,124,4,0,160,6,0,124,0,
+    0,160,6,0,124,3,0,100,1,0,25,161,1,0,161,1,
     0,83,41,4,122,121,68,101,99,111,100,101,32,98,121,116,
     101,115,32,114,101,112,114,101,115,101,110,116,105,110,103,32,
     115,111,117,114,99,101,32,99,111,100,101,32,97,110,100,32,
@@ -798,33 +798,33 @@ const unsigned char _Py_M__importlib_external[] = {
     100,105,110,103,90,15,110,101,119,108,105,110,101,95,100,101,
     99,111,100,101,114,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,13,100,101,99,111,100,101,95,115,111,117,
-    114,99,101,240,1,0,0,115,10,0,0,0,0,5,12,1,
+    114,99,101,242,1,0,0,115,10,0,0,0,0,5,12,1,
     18,1,15,1,18,1,114,155,0,0,0,114,127,0,0,0,
     218,26,115,117,98,109,111,100,117,108,101,95,115,101,97,114,
     99,104,95,108,111,99,97,116,105,111,110,115,99,2,0,0,
     0,2,0,0,0,9,0,0,0,19,0,0,0,67,0,0,
-    0,115,89,1,0,0,124,1,0,100,1,0,107,8,0,114,
+    0,115,89,1,0,0,124,1,0,100,1,0,168,8,0,114,
     73,0,100,2,0,125,1,0,116,0,0,124,2,0,100,3,
-    0,131,2,0,114,73,0,121,19,0,124,2,0,106,1,0,
-    124,0,0,131,1,0,125,1,0,87,110,18,0,4,116,2,
-    0,107,10,0,114,72,0,1,1,1,89,110,1,0,88,116,
-    3,0,106,4,0,124,0,0,124,2,0,100,4,0,124,1,
-    0,131,2,1,125,4,0,100,5,0,124,4,0,95,5,0,
-    124,2,0,100,1,0,107,8,0,114,194,0,120,73,0,116,
-    6,0,131,0,0,68,93,58,0,92,2,0,125,5,0,125,
-    6,0,124,1,0,106,7,0,116,8,0,124,6,0,131,1,
-    0,131,1,0,114,128,0,124,5,0,124,0,0,124,1,0,
-    131,2,0,125,2,0,124,2,0,124,4,0,95,9,0,80,
-    113,128,0,87,100,1,0,83,124,3,0,116,10,0,107,8,
+    0,131,2,0,114,73,0,121,19,0,124,2,0,160,1,0,
+    124,0,0,161,1,0,125,1,0,87,110,18,0,4,116,2,
+    0,168,10,0,114,72,0,1,1,1,89,110,1,0,88,116,
+    3,0,160,4,0,165,0,0,124,2,0,100,4,0,124,1,
+    0,161,2,1,125,4,0,100,5,0,124,4,0,95,5,0,
+    124,2,0,100,1,0,168,8,0,114,194,0,120,73,0,116,
+    6,0,131,0,0,68,93,58,0,92,2,0,125,5,0,167,
+    6,0,124,1,0,160,7,0,116,8,0,124,6,0,131,1,
+    0,161,1,0,114,128,0,165,5,0,124,0,0,124,1,0,
+    131,2,0,167,2,0,124,2,0,124,4,0,95,9,0,80,
+    113,128,0,87,100,1,0,83,124,3,0,116,10,0,168,8,
     0,114,23,1,116,0,0,124,2,0,100,6,0,131,2,0,
-    114,32,1,121,19,0,124,2,0,106,11,0,124,0,0,131,
-    1,0,125,7,0,87,110,18,0,4,116,2,0,107,10,0,
+    114,32,1,121,19,0,124,2,0,160,11,0,124,0,0,161,
+    1,0,125,7,0,87,110,18,0,4,116,2,0,168,10,0,
     114,4,1,1,1,1,89,113,32,1,88,124,7,0,114,32,
-    1,103,0,0,124,4,0,95,12,0,110,9,0,124,3,0,
-    124,4,0,95,12,0,124,4,0,106,12,0,103,0,0,107,
+    1,103,0,0,124,4,0,95,12,0,110,9,0,165,3,0,
+    124,4,0,95,12,0,166,4,0,106,12,0,103,0,0,168,
     2,0,114,85,1,124,1,0,114,85,1,116,13,0,124,1,
-    0,131,1,0,100,7,0,25,125,8,0,124,4,0,106,12,
-    0,106,14,0,124,8,0,131,1,0,1,124,4,0,83,41,
+    0,131,1,0,100,7,0,25,167,8,0,124,4,0,106,12,
+    0,160,14,0,124,8,0,161,1,0,1,124,4,0,83,41,
     8,97,61,1,0,0,82,101,116,117,114,110,32,97,32,109,
     111,100,117,108,101,32,115,112,101,99,32,98,97,115,101,100,
     32,111,110,32,97,32,102,105,108,101,32,108,111,99,97,116,
@@ -863,7 +863,7 @@ const unsigned char _Py_M__importlib_external[] = {
     159,0,0,0,90,7,100,105,114,110,97,109,101,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,218,23,115,112,
     101,99,95,102,114,111,109,95,102,105,108,101,95,108,111,99,
-    97,116,105,111,110,1,2,0,0,115,60,0,0,0,0,12,
+    97,116,105,111,110,3,2,0,0,115,60,0,0,0,0,12,
     12,4,6,1,15,2,3,1,19,1,13,1,5,8,24,1,
     9,3,12,1,22,1,21,1,15,1,9,1,5,2,4,3,
     12,2,15,1,3,1,19,1,13,1,5,2,6,1,12,2,
@@ -892,10 +892,10 @@ const unsigned char _Py_M__importlib_external[] = {
     110,125,92,77,111,100,117,108,101,115,92,123,102,117,108,108,
     110,97,109,101,125,92,68,101,98,117,103,70,99,2,0,0,
     0,0,0,0,0,2,0,0,0,11,0,0,0,67,0,0,
-    0,115,67,0,0,0,121,23,0,116,0,0,106,1,0,116,
-    0,0,106,2,0,124,1,0,131,2,0,83,87,110,37,0,
-    4,116,3,0,107,10,0,114,62,0,1,1,1,116,0,0,
-    106,1,0,116,0,0,106,4,0,124,1,0,131,2,0,83,
+    0,115,67,0,0,0,121,23,0,116,0,0,160,1,0,116,
+    0,0,106,2,0,124,1,0,161,2,0,83,87,110,37,0,
+    4,116,3,0,168,10,0,114,62,0,1,1,1,116,0,0,
+    160,1,0,116,0,0,106,4,0,124,1,0,161,2,0,83,
     89,110,1,0,88,100,0,0,83,41,1,78,41,5,218,7,
     95,119,105,110,114,101,103,90,7,79,112,101,110,75,101,121,
     90,17,72,75,69,89,95,67,85,82,82,69,78,84,95,85,
@@ -903,20 +903,20 @@ const unsigned char _Py_M__importlib_external[] = {
     79,67,65,76,95,77,65,67,72,73,78,69,41,2,218,3,
     99,108,115,218,3,107,101,121,114,4,0,0,0,114,4,0,
     0,0,114,5,0,0,0,218,14,95,111,112,101,110,95,114,
-    101,103,105,115,116,114,121,79,2,0,0,115,8,0,0,0,
+    101,103,105,115,116,114,121,81,2,0,0,115,8,0,0,0,
     0,2,3,1,23,1,13,1,122,36,87,105,110,100,111,119,
     115,82,101,103,105,115,116,114,121,70,105,110,100,101,114,46,
     95,111,112,101,110,95,114,101,103,105,115,116,114,121,99,2,
-    0,0,0,0,0,0,0,6,0,0,0,16,0,0,0,67,
-    0,0,0,115,143,0,0,0,124,0,0,106,0,0,114,21,
-    0,124,0,0,106,1,0,125,2,0,110,9,0,124,0,0,
-    106,2,0,125,2,0,124,2,0,106,3,0,100,1,0,124,
+    0,0,0,0,0,0,0,6,0,0,0,17,0,0,0,67,
+    0,0,0,115,143,0,0,0,166,0,0,106,0,0,114,21,
+    0,166,0,0,106,1,0,125,2,0,110,9,0,166,0,0,
+    106,2,0,167,2,0,124,2,0,160,3,0,100,1,0,124,
     1,0,100,2,0,116,4,0,106,5,0,100,0,0,100,3,
-    0,133,2,0,25,131,0,2,125,3,0,121,47,0,124,0,
-    0,106,6,0,124,3,0,131,1,0,143,25,0,125,4,0,
-    116,7,0,106,8,0,124,4,0,100,4,0,131,2,0,125,
+    0,133,2,0,25,161,0,2,125,3,0,121,47,0,124,0,
+    0,160,6,0,124,3,0,161,1,0,143,25,0,125,4,0,
+    116,7,0,160,8,0,124,4,0,100,4,0,161,2,0,125,
     5,0,87,100,0,0,81,82,88,87,110,22,0,4,116,9,
-    0,107,10,0,114,138,0,1,1,1,100,0,0,83,89,110,
+    0,168,10,0,114,138,0,1,1,1,100,0,0,83,89,110,
     1,0,88,124,5,0,83,41,5,78,114,126,0,0,0,90,
     11,115,121,115,95,118,101,114,115,105,111,110,114,80,0,0,
     0,114,30,0,0,0,41,10,218,11,68,69,66,85,71,95,
@@ -930,22 +930,22 @@ const unsigned char _Py_M__importlib_external[] = {
     171,0,0,0,90,4,104,107,101,121,218,8,102,105,108,101,
     112,97,116,104,114,4,0,0,0,114,4,0,0,0,114,5,
     0,0,0,218,16,95,115,101,97,114,99,104,95,114,101,103,
-    105,115,116,114,121,86,2,0,0,115,22,0,0,0,0,2,
+    105,115,116,114,121,88,2,0,0,115,22,0,0,0,0,2,
     9,1,12,2,9,1,15,1,22,1,3,1,18,1,29,1,
     13,1,9,1,122,38,87,105,110,100,111,119,115,82,101,103,
     105,115,116,114,121,70,105,110,100,101,114,46,95,115,101,97,
     114,99,104,95,114,101,103,105,115,116,114,121,78,99,4,0,
-    0,0,0,0,0,0,8,0,0,0,14,0,0,0,67,0,
-    0,0,115,158,0,0,0,124,0,0,106,0,0,124,1,0,
-    131,1,0,125,4,0,124,4,0,100,0,0,107,8,0,114,
+    0,0,0,0,0,0,8,0,0,0,15,0,0,0,67,0,
+    0,0,115,158,0,0,0,124,0,0,160,0,0,124,1,0,
+    161,1,0,167,4,0,124,4,0,100,0,0,168,8,0,114,
     31,0,100,0,0,83,121,14,0,116,1,0,124,4,0,131,
-    1,0,1,87,110,22,0,4,116,2,0,107,10,0,114,69,
+    1,0,1,87,110,22,0,4,116,2,0,168,10,0,114,69,
     0,1,1,1,100,0,0,83,89,110,1,0,88,120,81,0,
     116,3,0,131,0,0,68,93,70,0,92,2,0,125,5,0,
-    125,6,0,124,4,0,106,4,0,116,5,0,124,6,0,131,
-    1,0,131,1,0,114,80,0,116,6,0,106,7,0,124,1,
-    0,124,5,0,124,1,0,124,4,0,131,2,0,100,1,0,
-    124,4,0,131,2,1,125,7,0,124,7,0,83,113,80,0,
+    167,6,0,124,4,0,160,4,0,116,5,0,124,6,0,131,
+    1,0,161,1,0,114,80,0,116,6,0,160,7,0,165,1,
+    0,124,5,0,165,1,0,124,4,0,131,2,0,100,1,0,
+    124,4,0,161,2,1,167,7,0,124,7,0,83,113,80,0,
     87,100,0,0,83,41,2,78,114,158,0,0,0,41,8,114,
     178,0,0,0,114,39,0,0,0,114,40,0,0,0,114,161,
     0,0,0,114,92,0,0,0,114,93,0,0,0,114,121,0,
@@ -954,15 +954,15 @@ const unsigned char _Py_M__importlib_external[] = {
     114,35,0,0,0,218,6,116,97,114,103,101,116,114,177,0,
     0,0,114,127,0,0,0,114,166,0,0,0,114,164,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    218,9,102,105,110,100,95,115,112,101,99,101,2,0,0,115,
+    218,9,102,105,110,100,95,115,112,101,99,103,2,0,0,115,
     26,0,0,0,0,2,15,1,12,1,4,1,3,1,14,1,
     13,1,9,1,22,1,21,1,9,1,15,1,9,1,122,31,
     87,105,110,100,111,119,115,82,101,103,105,115,116,114,121,70,
     105,110,100,101,114,46,102,105,110,100,95,115,112,101,99,99,
-    3,0,0,0,0,0,0,0,4,0,0,0,3,0,0,0,
-    67,0,0,0,115,45,0,0,0,124,0,0,106,0,0,124,
-    1,0,124,2,0,131,2,0,125,3,0,124,3,0,100,1,
-    0,107,9,0,114,37,0,124,3,0,106,1,0,83,100,1,
+    3,0,0,0,0,0,0,0,4,0,0,0,4,0,0,0,
+    67,0,0,0,115,45,0,0,0,124,0,0,160,0,0,165,
+    1,0,124,2,0,161,2,0,167,3,0,124,3,0,100,1,
+    0,168,9,0,114,37,0,166,3,0,106,1,0,83,100,1,
     0,83,100,1,0,83,41,2,122,108,70,105,110,100,32,109,
     111,100,117,108,101,32,110,97,109,101,100,32,105,110,32,116,
     104,101,32,114,101,103,105,115,116,114,121,46,10,10,32,32,
@@ -974,7 +974,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,41,4,114,170,0,0,0,114,126,0,0,0,114,
     35,0,0,0,114,164,0,0,0,114,4,0,0,0,114,4,
     0,0,0,114,5,0,0,0,218,11,102,105,110,100,95,109,
-    111,100,117,108,101,117,2,0,0,115,8,0,0,0,0,7,
+    111,100,117,108,101,119,2,0,0,115,8,0,0,0,0,7,
     18,1,12,1,7,2,122,33,87,105,110,100,111,119,115,82,
     101,103,105,115,116,114,121,70,105,110,100,101,114,46,102,105,
     110,100,95,109,111,100,117,108,101,41,12,114,112,0,0,0,
@@ -983,7 +983,7 @@ const unsigned char _Py_M__importlib_external[] = {
     99,108,97,115,115,109,101,116,104,111,100,114,172,0,0,0,
     114,178,0,0,0,114,181,0,0,0,114,182,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
-    0,0,0,114,168,0,0,0,67,2,0,0,115,20,0,0,
+    0,0,0,114,168,0,0,0,69,2,0,0,115,20,0,0,
     0,12,2,6,3,6,3,6,2,6,2,18,7,18,15,3,
     1,21,15,3,1,114,168,0,0,0,99,0,0,0,0,0,
     0,0,0,0,0,0,0,2,0,0,0,64,0,0,0,115,
@@ -998,12 +998,12 @@ const unsigned char _Py_M__importlib_external[] = {
     32,98,111,116,104,32,83,111,117,114,99,101,76,111,97,100,
     101,114,32,97,110,100,10,32,32,32,32,83,111,117,114,99,
     101,108,101,115,115,70,105,108,101,76,111,97,100,101,114,46,
-    99,2,0,0,0,0,0,0,0,5,0,0,0,3,0,0,
+    99,2,0,0,0,0,0,0,0,5,0,0,0,4,0,0,
     0,67,0,0,0,115,88,0,0,0,116,0,0,124,0,0,
-    106,1,0,124,1,0,131,1,0,131,1,0,100,1,0,25,
-    125,2,0,124,2,0,106,2,0,100,2,0,100,1,0,131,
-    2,0,100,3,0,25,125,3,0,124,1,0,106,3,0,100,
-    2,0,131,1,0,100,4,0,25,125,4,0,124,3,0,100,
+    160,1,0,124,1,0,161,1,0,131,1,0,100,1,0,25,
+    167,2,0,124,2,0,160,2,0,100,2,0,100,1,0,161,
+    2,0,100,3,0,25,167,3,0,124,1,0,160,3,0,100,
+    2,0,161,1,0,100,4,0,25,167,4,0,124,3,0,100,
     5,0,107,2,0,111,87,0,124,4,0,100,5,0,107,3,
     0,83,41,6,122,141,67,111,110,99,114,101,116,101,32,105,
     109,112,108,101,109,101,110,116,97,116,105,111,110,32,111,102,
@@ -1021,7 +1021,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,114,94,0,0,0,90,13,102,105,108,101,110,97,
     109,101,95,98,97,115,101,90,9,116,97,105,108,95,110,97,
     109,101,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,159,0,0,0,136,2,0,0,115,8,0,0,0,0,
+    0,114,159,0,0,0,138,2,0,0,115,8,0,0,0,0,
     3,25,1,22,1,19,1,122,24,95,76,111,97,100,101,114,
     66,97,115,105,99,115,46,105,115,95,112,97,99,107,97,103,
     101,99,2,0,0,0,0,0,0,0,2,0,0,0,1,0,
@@ -1031,16 +1031,16 @@ const unsigned char _Py_M__importlib_external[] = {
     117,108,101,32,99,114,101,97,116,105,111,110,46,78,114,4,
     0,0,0,41,2,114,108,0,0,0,114,164,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,13,
-    99,114,101,97,116,101,95,109,111,100,117,108,101,144,2,0,
+    99,114,101,97,116,101,95,109,111,100,117,108,101,146,2,0,
     0,115,0,0,0,0,122,27,95,76,111,97,100,101,114,66,
     97,115,105,99,115,46,99,114,101,97,116,101,95,109,111,100,
     117,108,101,99,2,0,0,0,0,0,0,0,3,0,0,0,
-    4,0,0,0,67,0,0,0,115,80,0,0,0,124,0,0,
-    106,0,0,124,1,0,106,1,0,131,1,0,125,2,0,124,
-    2,0,100,1,0,107,8,0,114,54,0,116,2,0,100,2,
-    0,106,3,0,124,1,0,106,1,0,131,1,0,131,1,0,
-    130,1,0,116,4,0,106,5,0,116,6,0,124,2,0,124,
-    1,0,106,7,0,131,3,0,1,100,1,0,83,41,3,122,
+    5,0,0,0,67,0,0,0,115,80,0,0,0,124,0,0,
+    160,0,0,166,1,0,106,1,0,161,1,0,167,2,0,124,
+    2,0,100,1,0,168,8,0,114,54,0,116,2,0,100,2,
+    0,160,3,0,166,1,0,106,1,0,161,1,0,131,1,0,
+    130,1,0,116,4,0,160,5,0,116,6,0,165,2,0,124,
+    1,0,106,7,0,161,3,0,1,100,1,0,83,41,3,122,
     19,69,120,101,99,117,116,101,32,116,104,101,32,109,111,100,
     117,108,101,46,78,122,52,99,97,110,110,111,116,32,108,111,
     97,100,32,109,111,100,117,108,101,32,123,33,114,125,32,119,
@@ -1053,23 +1053,23 @@ const unsigned char _Py_M__importlib_external[] = {
     0,41,3,114,108,0,0,0,218,6,109,111,100,117,108,101,
     114,146,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,11,101,120,101,99,95,109,111,100,117,108,
-    101,147,2,0,0,115,10,0,0,0,0,2,18,1,12,1,
+    101,149,2,0,0,115,10,0,0,0,0,2,18,1,12,1,
     9,1,15,1,122,25,95,76,111,97,100,101,114,66,97,115,
     105,99,115,46,101,120,101,99,95,109,111,100,117,108,101,99,
-    2,0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,
-    67,0,0,0,115,16,0,0,0,116,0,0,106,1,0,124,
-    0,0,124,1,0,131,2,0,83,41,1,78,41,2,114,121,
+    2,0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,
+    67,0,0,0,115,16,0,0,0,116,0,0,160,1,0,165,
+    0,0,124,1,0,161,2,0,83,41,1,78,41,2,114,121,
     0,0,0,218,17,95,108,111,97,100,95,109,111,100,117,108,
     101,95,115,104,105,109,41,2,114,108,0,0,0,114,126,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,218,11,108,111,97,100,95,109,111,100,117,108,101,155,2,
+    0,218,11,108,111,97,100,95,109,111,100,117,108,101,157,2,
     0,0,115,2,0,0,0,0,1,122,25,95,76,111,97,100,
     101,114,66,97,115,105,99,115,46,108,111,97,100,95,109,111,
     100,117,108,101,78,41,8,114,112,0,0,0,114,111,0,0,
     0,114,113,0,0,0,114,114,0,0,0,114,159,0,0,0,
     114,186,0,0,0,114,191,0,0,0,114,193,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
-    0,0,0,114,184,0,0,0,131,2,0,0,115,10,0,0,
+    0,0,0,114,184,0,0,0,133,2,0,0,115,10,0,0,
     0,12,3,6,2,12,8,12,3,12,8,114,184,0,0,0,
     99,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,
     0,64,0,0,0,115,106,0,0,0,101,0,0,90,1,0,
@@ -1097,11 +1097,11 @@ const unsigned char _Py_M__importlib_external[] = {
     1,218,7,73,79,69,114,114,111,114,41,2,114,108,0,0,
     0,114,35,0,0,0,114,4,0,0,0,114,4,0,0,0,
     114,5,0,0,0,218,10,112,97,116,104,95,109,116,105,109,
-    101,161,2,0,0,115,2,0,0,0,0,6,122,23,83,111,
+    101,163,2,0,0,115,2,0,0,0,0,6,122,23,83,111,
     117,114,99,101,76,111,97,100,101,114,46,112,97,116,104,95,
     109,116,105,109,101,99,2,0,0,0,0,0,0,0,2,0,
-    0,0,3,0,0,0,67,0,0,0,115,19,0,0,0,100,
-    1,0,124,0,0,106,0,0,124,1,0,131,1,0,105,1,
+    0,0,4,0,0,0,67,0,0,0,115,19,0,0,0,100,
+    1,0,124,0,0,160,0,0,124,1,0,161,1,0,105,1,
     0,83,41,2,97,170,1,0,0,79,112,116,105,111,110,97,
     108,32,109,101,116,104,111,100,32,114,101,116,117,114,110,105,
     110,103,32,97,32,109,101,116,97,100,97,116,97,32,100,105,
@@ -1132,12 +1132,12 @@ const unsigned char _Py_M__importlib_external[] = {
     32,32,32,114,133,0,0,0,41,1,114,196,0,0,0,41,
     2,114,108,0,0,0,114,35,0,0,0,114,4,0,0,0,
     114,4,0,0,0,114,5,0,0,0,218,10,112,97,116,104,
-    95,115,116,97,116,115,169,2,0,0,115,2,0,0,0,0,
+    95,115,116,97,116,115,171,2,0,0,115,2,0,0,0,0,
     11,122,23,83,111,117,114,99,101,76,111,97,100,101,114,46,
     112,97,116,104,95,115,116,97,116,115,99,4,0,0,0,0,
-    0,0,0,4,0,0,0,3,0,0,0,67,0,0,0,115,
-    16,0,0,0,124,0,0,106,0,0,124,2,0,124,3,0,
-    131,2,0,83,41,1,122,228,79,112,116,105,111,110,97,108,
+    0,0,0,4,0,0,0,4,0,0,0,67,0,0,0,115,
+    16,0,0,0,124,0,0,160,0,0,165,2,0,124,3,0,
+    161,2,0,83,41,1,122,228,79,112,116,105,111,110,97,108,
     32,109,101,116,104,111,100,32,119,104,105,99,104,32,119,114,
     105,116,101,115,32,100,97,116,97,32,40,98,121,116,101,115,
     41,32,116,111,32,97,32,102,105,108,101,32,112,97,116,104,
@@ -1156,7 +1156,7 @@ const unsigned char _Py_M__importlib_external[] = {
     90,0,0,0,90,10,99,97,99,104,101,95,112,97,116,104,
     114,53,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,15,95,99,97,99,104,101,95,98,121,116,
-    101,99,111,100,101,182,2,0,0,115,2,0,0,0,0,8,
+    101,99,111,100,101,184,2,0,0,115,2,0,0,0,0,8,
     122,28,83,111,117,114,99,101,76,111,97,100,101,114,46,95,
     99,97,99,104,101,95,98,121,116,101,99,111,100,101,99,3,
     0,0,0,0,0,0,0,3,0,0,0,1,0,0,0,67,
@@ -1173,13 +1173,13 @@ const unsigned char _Py_M__importlib_external[] = {
     32,32,32,32,32,32,78,114,4,0,0,0,41,3,114,108,
     0,0,0,114,35,0,0,0,114,53,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,198,0,0,
-    0,192,2,0,0,115,0,0,0,0,122,21,83,111,117,114,
+    0,194,2,0,0,115,0,0,0,0,122,21,83,111,117,114,
     99,101,76,111,97,100,101,114,46,115,101,116,95,100,97,116,
     97,99,2,0,0,0,0,0,0,0,5,0,0,0,16,0,
-    0,0,67,0,0,0,115,105,0,0,0,124,0,0,106,0,
-    0,124,1,0,131,1,0,125,2,0,121,19,0,124,0,0,
-    106,1,0,124,2,0,131,1,0,125,3,0,87,110,58,0,
-    4,116,2,0,107,10,0,114,94,0,1,125,4,0,1,122,
+    0,0,67,0,0,0,115,105,0,0,0,124,0,0,160,0,
+    0,124,1,0,161,1,0,125,2,0,121,19,0,124,0,0,
+    160,1,0,124,2,0,161,1,0,125,3,0,87,110,58,0,
+    4,116,2,0,168,10,0,114,94,0,1,125,4,0,1,122,
     26,0,116,3,0,100,1,0,100,2,0,124,1,0,131,1,
     1,124,4,0,130,2,0,87,89,100,3,0,100,3,0,125,
     4,0,126,4,0,88,110,1,0,88,116,4,0,124,3,0,
@@ -1195,14 +1195,14 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,126,0,0,0,114,35,0,0,0,114,153,0,0,
     0,218,3,101,120,99,114,4,0,0,0,114,4,0,0,0,
     114,5,0,0,0,218,10,103,101,116,95,115,111,117,114,99,
-    101,199,2,0,0,115,14,0,0,0,0,2,15,1,3,1,
+    101,201,2,0,0,115,14,0,0,0,0,2,15,1,3,1,
     19,1,18,1,9,1,31,1,122,23,83,111,117,114,99,101,
     76,111,97,100,101,114,46,103,101,116,95,115,111,117,114,99,
     101,218,9,95,111,112,116,105,109,105,122,101,114,29,0,0,
-    0,99,3,0,0,0,1,0,0,0,4,0,0,0,9,0,
-    0,0,67,0,0,0,115,34,0,0,0,116,0,0,106,1,
-    0,116,2,0,124,1,0,124,2,0,100,1,0,100,2,0,
-    100,3,0,100,4,0,124,3,0,131,4,2,83,41,5,122,
+    0,99,3,0,0,0,1,0,0,0,4,0,0,0,10,0,
+    0,0,67,0,0,0,115,34,0,0,0,116,0,0,160,1,
+    0,116,2,0,165,1,0,124,2,0,100,1,0,100,2,0,
+    100,3,0,100,4,0,124,3,0,161,4,2,83,41,5,122,
     130,82,101,116,117,114,110,32,116,104,101,32,99,111,100,101,
     32,111,98,106,101,99,116,32,99,111,109,112,105,108,101,100,
     32,102,114,111,109,32,115,111,117,114,99,101,46,10,10,32,
@@ -1217,37 +1217,37 @@ const unsigned char _Py_M__importlib_external[] = {
     101,41,4,114,108,0,0,0,114,53,0,0,0,114,35,0,
     0,0,114,203,0,0,0,114,4,0,0,0,114,4,0,0,
     0,114,5,0,0,0,218,14,115,111,117,114,99,101,95,116,
-    111,95,99,111,100,101,209,2,0,0,115,4,0,0,0,0,
+    111,95,99,111,100,101,211,2,0,0,115,4,0,0,0,0,
     5,21,1,122,27,83,111,117,114,99,101,76,111,97,100,101,
     114,46,115,111,117,114,99,101,95,116,111,95,99,111,100,101,
     99,2,0,0,0,0,0,0,0,10,0,0,0,43,0,0,
-    0,67,0,0,0,115,174,1,0,0,124,0,0,106,0,0,
-    124,1,0,131,1,0,125,2,0,100,1,0,125,3,0,121,
+    0,67,0,0,0,115,174,1,0,0,124,0,0,160,0,0,
+    124,1,0,161,1,0,125,2,0,100,1,0,125,3,0,121,
     16,0,116,1,0,124,2,0,131,1,0,125,4,0,87,110,
-    24,0,4,116,2,0,107,10,0,114,63,0,1,1,1,100,
+    24,0,4,116,2,0,168,10,0,114,63,0,1,1,1,100,
     1,0,125,4,0,89,110,202,0,88,121,19,0,124,0,0,
-    106,3,0,124,2,0,131,1,0,125,5,0,87,110,18,0,
-    4,116,4,0,107,10,0,114,103,0,1,1,1,89,110,162,
+    160,3,0,124,2,0,161,1,0,125,5,0,87,110,18,0,
+    4,116,4,0,168,10,0,114,103,0,1,1,1,89,110,162,
     0,88,116,5,0,124,5,0,100,2,0,25,131,1,0,125,
-    3,0,121,19,0,124,0,0,106,6,0,124,4,0,131,1,
-    0,125,6,0,87,110,18,0,4,116,7,0,107,10,0,114,
+    3,0,121,19,0,124,0,0,160,6,0,124,4,0,161,1,
+    0,125,6,0,87,110,18,0,4,116,7,0,168,10,0,114,
     159,0,1,1,1,89,110,106,0,88,121,34,0,116,8,0,
     124,6,0,100,3,0,124,5,0,100,4,0,124,1,0,100,
     5,0,124,4,0,131,1,3,125,7,0,87,110,24,0,4,
-    116,9,0,116,10,0,102,2,0,107,10,0,114,220,0,1,
-    1,1,89,110,45,0,88,116,11,0,100,6,0,124,4,0,
+    116,9,0,116,10,0,102,2,0,168,10,0,114,220,0,1,
+    1,1,89,110,45,0,88,116,11,0,100,6,0,165,4,0,
     124,2,0,131,3,0,1,116,12,0,124,7,0,100,4,0,
     124,1,0,100,7,0,124,4,0,100,8,0,124,2,0,131,
-    1,3,83,124,0,0,106,6,0,124,2,0,131,1,0,125,
-    8,0,124,0,0,106,13,0,124,8,0,124,2,0,131,2,
+    1,3,83,124,0,0,160,6,0,124,2,0,161,1,0,167,
+    8,0,124,0,0,160,13,0,165,8,0,124,2,0,161,2,
     0,125,9,0,116,11,0,100,9,0,124,2,0,131,2,0,
     1,116,14,0,106,15,0,12,114,170,1,124,4,0,100,1,
-    0,107,9,0,114,170,1,124,3,0,100,1,0,107,9,0,
-    114,170,1,116,16,0,124,9,0,124,3,0,116,17,0,124,
+    0,168,9,0,114,170,1,124,3,0,100,1,0,168,9,0,
+    114,170,1,116,16,0,165,9,0,124,3,0,116,17,0,124,
     8,0,131,1,0,131,3,0,125,6,0,121,36,0,124,0,
-    0,106,18,0,124,2,0,124,4,0,124,6,0,131,3,0,
+    0,160,18,0,165,2,0,124,4,0,124,6,0,161,3,0,
     1,116,11,0,100,10,0,124,4,0,131,2,0,1,87,110,
-    18,0,4,116,2,0,107,10,0,114,169,1,1,1,1,89,
+    18,0,4,116,2,0,168,10,0,114,169,1,1,1,1,89,
     110,1,0,88,124,9,0,83,41,11,122,190,67,111,110,99,
     114,101,116,101,32,105,109,112,108,101,109,101,110,116,97,116,
     105,111,110,32,111,102,32,73,110,115,112,101,99,116,76,111,
@@ -1278,7 +1278,7 @@ const unsigned char _Py_M__importlib_external[] = {
     98,121,116,101,115,95,100,97,116,97,114,153,0,0,0,90,
     11,99,111,100,101,95,111,98,106,101,99,116,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,114,187,0,0,0,
-    217,2,0,0,115,78,0,0,0,0,7,15,1,6,1,3,
+    219,2,0,0,115,78,0,0,0,0,7,15,1,6,1,3,
     1,16,1,13,1,11,2,3,1,19,1,13,1,5,2,16,
     1,3,1,19,1,13,1,5,2,3,1,9,1,12,1,13,
     1,19,1,5,2,9,1,7,1,15,1,6,1,7,1,15,
@@ -1290,7 +1290,7 @@ const unsigned char _Py_M__importlib_external[] = {
     199,0,0,0,114,198,0,0,0,114,202,0,0,0,114,206,
     0,0,0,114,187,0,0,0,114,4,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,194,0,0,
-    0,159,2,0,0,115,14,0,0,0,12,2,12,8,12,13,
+    0,161,2,0,0,115,14,0,0,0,12,2,12,8,12,13,
     12,10,12,7,12,10,18,8,114,194,0,0,0,99,0,0,
     0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,
     0,0,115,112,0,0,0,101,0,0,90,1,0,100,0,0,
@@ -1309,8 +1309,8 @@ const unsigned char _Py_M__importlib_external[] = {
     32,32,32,32,114,101,113,117,105,114,101,32,102,105,108,101,
     32,115,121,115,116,101,109,32,117,115,97,103,101,46,99,3,
     0,0,0,0,0,0,0,3,0,0,0,2,0,0,0,67,
-    0,0,0,115,22,0,0,0,124,1,0,124,0,0,95,0,
-    0,124,2,0,124,0,0,95,1,0,100,1,0,83,41,2,
+    0,0,0,115,22,0,0,0,165,1,0,124,0,0,95,0,
+    0,165,2,0,124,0,0,95,1,0,100,1,0,83,41,2,
     122,75,67,97,99,104,101,32,116,104,101,32,109,111,100,117,
     108,101,32,110,97,109,101,32,97,110,100,32,116,104,101,32,
     112,97,116,104,32,116,111,32,116,104,101,32,102,105,108,101,
@@ -1318,30 +1318,30 @@ const unsigned char _Py_M__importlib_external[] = {
     32,32,32,32,32,32,102,105,110,100,101,114,46,78,41,2,
     114,106,0,0,0,114,35,0,0,0,41,3,114,108,0,0,
     0,114,126,0,0,0,114,35,0,0,0,114,4,0,0,0,
-    114,4,0,0,0,114,5,0,0,0,114,185,0,0,0,18,
+    114,4,0,0,0,114,5,0,0,0,114,185,0,0,0,20,
     3,0,0,115,4,0,0,0,0,3,9,1,122,19,70,105,
     108,101,76,111,97,100,101,114,46,95,95,105,110,105,116,95,
     95,99,2,0,0,0,0,0,0,0,2,0,0,0,2,0,
-    0,0,67,0,0,0,115,34,0,0,0,124,0,0,106,0,
-    0,124,1,0,106,0,0,107,2,0,111,33,0,124,0,0,
-    106,1,0,124,1,0,106,1,0,107,2,0,83,41,1,78,
+    0,0,67,0,0,0,115,34,0,0,0,166,0,0,106,0,
+    0,166,1,0,106,0,0,107,2,0,111,33,0,166,0,0,
+    106,1,0,166,1,0,106,1,0,107,2,0,83,41,1,78,
     41,2,218,9,95,95,99,108,97,115,115,95,95,114,118,0,
     0,0,41,2,114,108,0,0,0,218,5,111,116,104,101,114,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,
-    6,95,95,101,113,95,95,24,3,0,0,115,4,0,0,0,
+    6,95,95,101,113,95,95,26,3,0,0,115,4,0,0,0,
     0,1,18,1,122,17,70,105,108,101,76,111,97,100,101,114,
     46,95,95,101,113,95,95,99,1,0,0,0,0,0,0,0,
     1,0,0,0,3,0,0,0,67,0,0,0,115,26,0,0,
-    0,116,0,0,124,0,0,106,1,0,131,1,0,116,0,0,
-    124,0,0,106,2,0,131,1,0,65,83,41,1,78,41,3,
+    0,116,0,0,166,0,0,106,1,0,131,1,0,116,0,0,
+    166,0,0,106,2,0,131,1,0,65,83,41,1,78,41,3,
     218,4,104,97,115,104,114,106,0,0,0,114,35,0,0,0,
     41,1,114,108,0,0,0,114,4,0,0,0,114,4,0,0,
     0,114,5,0,0,0,218,8,95,95,104,97,115,104,95,95,
-    28,3,0,0,115,2,0,0,0,0,1,122,19,70,105,108,
+    30,3,0,0,115,2,0,0,0,0,1,122,19,70,105,108,
     101,76,111,97,100,101,114,46,95,95,104,97,115,104,95,95,
     99,2,0,0,0,0,0,0,0,2,0,0,0,3,0,0,
     0,3,0,0,0,115,22,0,0,0,116,0,0,116,1,0,
-    124,0,0,131,2,0,106,2,0,124,1,0,131,1,0,83,
+    124,0,0,131,2,0,160,2,0,124,1,0,161,1,0,83,
     41,1,122,100,76,111,97,100,32,97,32,109,111,100,117,108,
     101,32,102,114,111,109,32,97,32,102,105,108,101,46,10,10,
     32,32,32,32,32,32,32,32,84,104,105,115,32,109,101,116,
@@ -1351,23 +1351,23 @@ const unsigned char _Py_M__importlib_external[] = {
     32,32,32,32,32,32,32,32,41,3,218,5,115,117,112,101,
     114,114,210,0,0,0,114,193,0,0,0,41,2,114,108,0,
     0,0,114,126,0,0,0,41,1,114,211,0,0,0,114,4,
-    0,0,0,114,5,0,0,0,114,193,0,0,0,31,3,0,
+    0,0,0,114,5,0,0,0,114,193,0,0,0,33,3,0,
     0,115,2,0,0,0,0,10,122,22,70,105,108,101,76,111,
     97,100,101,114,46,108,111,97,100,95,109,111,100,117,108,101,
     99,2,0,0,0,0,0,0,0,2,0,0,0,1,0,0,
-    0,67,0,0,0,115,7,0,0,0,124,0,0,106,0,0,
+    0,67,0,0,0,115,7,0,0,0,166,0,0,106,0,0,
     83,41,1,122,58,82,101,116,117,114,110,32,116,104,101,32,
     112,97,116,104,32,116,111,32,116,104,101,32,115,111,117,114,
     99,101,32,102,105,108,101,32,97,115,32,102,111,117,110,100,
     32,98,121,32,116,104,101,32,102,105,110,100,101,114,46,41,
     1,114,35,0,0,0,41,2,114,108,0,0,0,114,126,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,157,0,0,0,43,3,0,0,115,2,0,0,0,0,
+    0,114,157,0,0,0,45,3,0,0,115,2,0,0,0,0,
     3,122,23,70,105,108,101,76,111,97,100,101,114,46,103,101,
     116,95,102,105,108,101,110,97,109,101,99,2,0,0,0,0,
     0,0,0,3,0,0,0,9,0,0,0,67,0,0,0,115,
-    42,0,0,0,116,0,0,106,1,0,124,1,0,100,1,0,
-    131,2,0,143,17,0,125,2,0,124,2,0,106,2,0,131,
+    42,0,0,0,116,0,0,160,1,0,124,1,0,100,1,0,
+    161,2,0,143,17,0,167,2,0,124,2,0,160,2,0,161,
     0,0,83,87,100,2,0,81,82,88,100,2,0,83,41,3,
     122,39,82,101,116,117,114,110,32,116,104,101,32,100,97,116,
     97,32,102,114,111,109,32,112,97,116,104,32,97,115,32,114,
@@ -1375,14 +1375,14 @@ const unsigned char _Py_M__importlib_external[] = {
     49,0,0,0,114,50,0,0,0,90,4,114,101,97,100,41,
     3,114,108,0,0,0,114,35,0,0,0,114,54,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
-    200,0,0,0,48,3,0,0,115,4,0,0,0,0,2,21,
+    200,0,0,0,50,3,0,0,115,4,0,0,0,0,2,21,
     1,122,19,70,105,108,101,76,111,97,100,101,114,46,103,101,
     116,95,100,97,116,97,41,11,114,112,0,0,0,114,111,0,
     0,0,114,113,0,0,0,114,114,0,0,0,114,185,0,0,
     0,114,213,0,0,0,114,215,0,0,0,114,123,0,0,0,
     114,193,0,0,0,114,157,0,0,0,114,200,0,0,0,114,
     4,0,0,0,114,4,0,0,0,41,1,114,211,0,0,0,
-    114,5,0,0,0,114,210,0,0,0,13,3,0,0,115,14,
+    114,5,0,0,0,114,210,0,0,0,15,3,0,0,115,14,
     0,0,0,12,3,6,2,12,6,12,4,12,3,24,12,18,
     5,114,210,0,0,0,99,0,0,0,0,0,0,0,0,0,
     0,0,0,4,0,0,0,64,0,0,0,115,64,0,0,0,
@@ -1397,26 +1397,26 @@ const unsigned char _Py_M__importlib_external[] = {
     105,110,103,32,116,104,101,32,102,105,108,101,32,115,121,115,
     116,101,109,46,99,2,0,0,0,0,0,0,0,3,0,0,
     0,4,0,0,0,67,0,0,0,115,34,0,0,0,116,0,
-    0,124,1,0,131,1,0,125,2,0,100,1,0,124,2,0,
-    106,1,0,100,2,0,124,2,0,106,2,0,105,2,0,83,
+    0,124,1,0,131,1,0,125,2,0,100,1,0,166,2,0,
+    106,1,0,100,2,0,166,2,0,106,2,0,105,2,0,83,
     41,3,122,33,82,101,116,117,114,110,32,116,104,101,32,109,
     101,116,97,100,97,116,97,32,102,111,114,32,116,104,101,32,
     112,97,116,104,46,114,133,0,0,0,114,134,0,0,0,41,
     3,114,39,0,0,0,218,8,115,116,95,109,116,105,109,101,
     90,7,115,116,95,115,105,122,101,41,3,114,108,0,0,0,
     114,35,0,0,0,114,208,0,0,0,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,197,0,0,0,58,3,
+    4,0,0,0,114,5,0,0,0,114,197,0,0,0,60,3,
     0,0,115,4,0,0,0,0,2,12,1,122,27,83,111,117,
     114,99,101,70,105,108,101,76,111,97,100,101,114,46,112,97,
     116,104,95,115,116,97,116,115,99,4,0,0,0,0,0,0,
-    0,5,0,0,0,5,0,0,0,67,0,0,0,115,34,0,
-    0,0,116,0,0,124,1,0,131,1,0,125,4,0,124,0,
-    0,106,1,0,124,2,0,124,3,0,100,1,0,124,4,0,
-    131,2,1,83,41,2,78,218,5,95,109,111,100,101,41,2,
+    0,5,0,0,0,6,0,0,0,67,0,0,0,115,34,0,
+    0,0,116,0,0,124,1,0,131,1,0,167,4,0,124,0,
+    0,160,1,0,165,2,0,124,3,0,100,1,0,124,4,0,
+    161,2,1,83,41,2,78,218,5,95,109,111,100,101,41,2,
     114,97,0,0,0,114,198,0,0,0,41,5,114,108,0,0,
     0,114,90,0,0,0,114,89,0,0,0,114,53,0,0,0,
     114,42,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,199,0,0,0,63,3,0,0,115,4,0,
+    5,0,0,0,114,199,0,0,0,65,3,0,0,115,4,0,
     0,0,0,2,12,1,122,32,83,111,117,114,99,101,70,105,
     108,101,76,111,97,100,101,114,46,95,99,97,99,104,101,95,
     98,121,116,101,99,111,100,101,114,220,0,0,0,105,182,1,
@@ -1425,21 +1425,21 @@ const unsigned char _Py_M__importlib_external[] = {
     1,0,131,1,0,92,2,0,125,4,0,125,5,0,103,0,
     0,125,6,0,120,54,0,124,4,0,114,80,0,116,1,0,
     124,4,0,131,1,0,12,114,80,0,116,0,0,124,4,0,
-    131,1,0,92,2,0,125,4,0,125,7,0,124,6,0,106,
-    2,0,124,7,0,131,1,0,1,113,27,0,87,120,132,0,
+    131,1,0,92,2,0,125,4,0,167,7,0,124,6,0,160,
+    2,0,124,7,0,161,1,0,1,113,27,0,87,120,132,0,
     116,3,0,124,6,0,131,1,0,68,93,118,0,125,7,0,
-    116,4,0,124,4,0,124,7,0,131,2,0,125,4,0,121,
-    17,0,116,5,0,106,6,0,124,4,0,131,1,0,1,87,
-    113,94,0,4,116,7,0,107,10,0,114,155,0,1,1,1,
-    119,94,0,89,113,94,0,4,116,8,0,107,10,0,114,211,
-    0,1,125,8,0,1,122,25,0,116,9,0,100,1,0,124,
+    116,4,0,165,4,0,124,7,0,131,2,0,125,4,0,121,
+    17,0,116,5,0,160,6,0,124,4,0,161,1,0,1,87,
+    113,94,0,4,116,7,0,168,10,0,114,155,0,1,1,1,
+    119,94,0,89,113,94,0,4,116,8,0,168,10,0,114,211,
+    0,1,125,8,0,1,122,25,0,116,9,0,100,1,0,165,
     4,0,124,8,0,131,3,0,1,100,2,0,83,87,89,100,
     2,0,100,2,0,125,8,0,126,8,0,88,113,94,0,88,
-    113,94,0,87,121,33,0,116,10,0,124,1,0,124,2,0,
+    113,94,0,87,121,33,0,116,10,0,165,1,0,124,2,0,
     124,3,0,131,3,0,1,116,9,0,100,3,0,124,1,0,
-    131,2,0,1,87,110,53,0,4,116,8,0,107,10,0,114,
+    131,2,0,1,87,110,53,0,4,116,8,0,168,10,0,114,
     48,1,1,125,8,0,1,122,21,0,116,9,0,100,1,0,
-    124,1,0,124,8,0,131,3,0,1,87,89,100,2,0,100,
+    165,1,0,124,8,0,131,3,0,1,87,89,100,2,0,100,
     2,0,125,8,0,126,8,0,88,110,1,0,88,100,2,0,
     83,41,4,122,27,87,114,105,116,101,32,98,121,116,101,115,
     32,100,97,116,97,32,116,111,32,97,32,102,105,108,101,46,
@@ -1454,7 +1454,7 @@ const unsigned char _Py_M__importlib_external[] = {
     53,0,0,0,114,220,0,0,0,218,6,112,97,114,101,110,
     116,114,94,0,0,0,114,27,0,0,0,114,23,0,0,0,
     114,201,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,198,0,0,0,68,3,0,0,115,38,0,
+    5,0,0,0,114,198,0,0,0,70,3,0,0,115,38,0,
     0,0,0,2,18,1,6,2,22,1,18,1,17,2,19,1,
     15,1,3,1,17,1,13,2,7,1,18,3,16,1,27,1,
     3,1,16,1,17,1,18,2,122,25,83,111,117,114,99,101,
@@ -1463,7 +1463,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,113,0,0,0,114,114,0,0,0,114,197,0,0,0,114,
     199,0,0,0,114,198,0,0,0,114,4,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,218,0,
-    0,0,54,3,0,0,115,8,0,0,0,12,2,6,2,12,
+    0,0,56,3,0,0,115,8,0,0,0,12,2,6,2,12,
     5,12,5,114,218,0,0,0,99,0,0,0,0,0,0,0,
     0,0,0,0,0,2,0,0,0,64,0,0,0,115,46,0,
     0,0,101,0,0,90,1,0,100,0,0,90,2,0,100,1,
@@ -1475,8 +1475,8 @@ const unsigned char _Py_M__importlib_external[] = {
     111,117,114,99,101,108,101,115,115,32,102,105,108,101,32,105,
     109,112,111,114,116,115,46,99,2,0,0,0,0,0,0,0,
     5,0,0,0,6,0,0,0,67,0,0,0,115,76,0,0,
-    0,124,0,0,106,0,0,124,1,0,131,1,0,125,2,0,
-    124,0,0,106,1,0,124,2,0,131,1,0,125,3,0,116,
+    0,124,0,0,160,0,0,124,1,0,161,1,0,167,2,0,
+    124,0,0,160,1,0,124,2,0,161,1,0,125,3,0,116,
     2,0,124,3,0,100,1,0,124,1,0,100,2,0,124,2,
     0,131,1,2,125,4,0,116,3,0,124,4,0,100,1,0,
     124,1,0,100,3,0,124,2,0,131,1,2,83,41,4,78,
@@ -1485,7 +1485,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,147,0,0,0,41,5,114,108,0,0,0,114,126,0,0,
     0,114,35,0,0,0,114,53,0,0,0,114,209,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
-    187,0,0,0,101,3,0,0,115,8,0,0,0,0,1,15,
+    187,0,0,0,103,3,0,0,115,8,0,0,0,0,1,15,
     1,15,1,24,1,122,29,83,111,117,114,99,101,108,101,115,
     115,70,105,108,101,76,111,97,100,101,114,46,103,101,116,95,
     99,111,100,101,99,2,0,0,0,0,0,0,0,2,0,0,
@@ -1495,13 +1495,13 @@ const unsigned char _Py_M__importlib_external[] = {
     32,115,111,117,114,99,101,32,99,111,100,101,46,78,114,4,
     0,0,0,41,2,114,108,0,0,0,114,126,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,202,
-    0,0,0,107,3,0,0,115,2,0,0,0,0,2,122,31,
+    0,0,0,109,3,0,0,115,2,0,0,0,0,2,122,31,
     83,111,117,114,99,101,108,101,115,115,70,105,108,101,76,111,
     97,100,101,114,46,103,101,116,95,115,111,117,114,99,101,78,
     41,6,114,112,0,0,0,114,111,0,0,0,114,113,0,0,
     0,114,114,0,0,0,114,187,0,0,0,114,202,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,223,0,0,0,97,3,0,0,115,6,0,
+    5,0,0,0,114,223,0,0,0,99,3,0,0,115,6,0,
     0,0,12,2,6,2,12,6,114,223,0,0,0,99,0,0,
     0,0,0,0,0,0,0,0,0,0,3,0,0,0,64,0,
     0,0,115,136,0,0,0,101,0,0,90,1,0,100,0,0,
@@ -1521,36 +1521,36 @@ const unsigned char _Py_M__importlib_external[] = {
     115,105,103,110,101,100,32,116,111,32,119,111,114,107,32,119,
     105,116,104,32,70,105,108,101,70,105,110,100,101,114,46,10,
     10,32,32,32,32,99,3,0,0,0,0,0,0,0,3,0,
-    0,0,2,0,0,0,67,0,0,0,115,22,0,0,0,124,
-    1,0,124,0,0,95,0,0,124,2,0,124,0,0,95,1,
+    0,0,2,0,0,0,67,0,0,0,115,22,0,0,0,165,
+    1,0,124,0,0,95,0,0,165,2,0,124,0,0,95,1,
     0,100,0,0,83,41,1,78,41,2,114,106,0,0,0,114,
     35,0,0,0,41,3,114,108,0,0,0,114,106,0,0,0,
     114,35,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,185,0,0,0,124,3,0,0,115,4,0,
+    5,0,0,0,114,185,0,0,0,126,3,0,0,115,4,0,
     0,0,0,1,9,1,122,28,69,120,116,101,110,115,105,111,
     110,70,105,108,101,76,111,97,100,101,114,46,95,95,105,110,
     105,116,95,95,99,2,0,0,0,0,0,0,0,2,0,0,
-    0,2,0,0,0,67,0,0,0,115,34,0,0,0,124,0,
-    0,106,0,0,124,1,0,106,0,0,107,2,0,111,33,0,
-    124,0,0,106,1,0,124,1,0,106,1,0,107,2,0,83,
+    0,2,0,0,0,67,0,0,0,115,34,0,0,0,166,0,
+    0,106,0,0,166,1,0,106,0,0,107,2,0,111,33,0,
+    166,0,0,106,1,0,166,1,0,106,1,0,107,2,0,83,
     41,1,78,41,2,114,211,0,0,0,114,118,0,0,0,41,
     2,114,108,0,0,0,114,212,0,0,0,114,4,0,0,0,
-    114,4,0,0,0,114,5,0,0,0,114,213,0,0,0,128,
+    114,4,0,0,0,114,5,0,0,0,114,213,0,0,0,130,
     3,0,0,115,4,0,0,0,0,1,18,1,122,26,69,120,
     116,101,110,115,105,111,110,70,105,108,101,76,111,97,100,101,
     114,46,95,95,101,113,95,95,99,1,0,0,0,0,0,0,
     0,1,0,0,0,3,0,0,0,67,0,0,0,115,26,0,
-    0,0,116,0,0,124,0,0,106,1,0,131,1,0,116,0,
-    0,124,0,0,106,2,0,131,1,0,65,83,41,1,78,41,
+    0,0,116,0,0,166,0,0,106,1,0,131,1,0,116,0,
+    0,166,0,0,106,2,0,131,1,0,65,83,41,1,78,41,
     3,114,214,0,0,0,114,106,0,0,0,114,35,0,0,0,
     41,1,114,108,0,0,0,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,114,215,0,0,0,132,3,0,0,115,
+    0,114,5,0,0,0,114,215,0,0,0,134,3,0,0,115,
     2,0,0,0,0,1,122,28,69,120,116,101,110,115,105,111,
     110,70,105,108,101,76,111,97,100,101,114,46,95,95,104,97,
     115,104,95,95,99,2,0,0,0,0,0,0,0,3,0,0,
     0,4,0,0,0,67,0,0,0,115,47,0,0,0,116,0,
-    0,106,1,0,116,2,0,106,3,0,124,1,0,131,2,0,
-    125,2,0,116,4,0,100,1,0,124,1,0,106,5,0,124,
+    0,160,1,0,116,2,0,106,3,0,124,1,0,161,2,0,
+    125,2,0,116,4,0,100,1,0,166,1,0,106,5,0,166,
     0,0,106,6,0,131,3,0,1,124,2,0,83,41,2,122,
     38,67,114,101,97,116,101,32,97,110,32,117,110,105,116,105,
     97,108,105,122,101,100,32,101,120,116,101,110,115,105,111,110,
@@ -1562,14 +1562,14 @@ const unsigned char _Py_M__importlib_external[] = {
     114,105,0,0,0,114,106,0,0,0,114,35,0,0,0,41,
     3,114,108,0,0,0,114,164,0,0,0,114,190,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
-    186,0,0,0,135,3,0,0,115,10,0,0,0,0,2,6,
+    186,0,0,0,137,3,0,0,115,10,0,0,0,0,2,6,
     1,15,1,6,1,16,1,122,33,69,120,116,101,110,115,105,
     111,110,70,105,108,101,76,111,97,100,101,114,46,99,114,101,
     97,116,101,95,109,111,100,117,108,101,99,2,0,0,0,0,
     0,0,0,2,0,0,0,4,0,0,0,67,0,0,0,115,
-    45,0,0,0,116,0,0,106,1,0,116,2,0,106,3,0,
-    124,1,0,131,2,0,1,116,4,0,100,1,0,124,0,0,
-    106,5,0,124,0,0,106,6,0,131,3,0,1,100,2,0,
+    45,0,0,0,116,0,0,160,1,0,116,2,0,106,3,0,
+    124,1,0,161,2,0,1,116,4,0,100,1,0,166,0,0,
+    106,5,0,166,0,0,106,6,0,131,3,0,1,100,2,0,
     83,41,3,122,30,73,110,105,116,105,97,108,105,122,101,32,
     97,110,32,101,120,116,101,110,115,105,111,110,32,109,111,100,
     117,108,101,122,40,101,120,116,101,110,115,105,111,110,32,109,
@@ -1579,12 +1579,12 @@ const unsigned char _Py_M__importlib_external[] = {
     12,101,120,101,99,95,100,121,110,97,109,105,99,114,105,0,
     0,0,114,106,0,0,0,114,35,0,0,0,41,2,114,108,
     0,0,0,114,190,0,0,0,114,4,0,0,0,114,4,0,
-    0,0,114,5,0,0,0,114,191,0,0,0,143,3,0,0,
+    0,0,114,5,0,0,0,114,191,0,0,0,145,3,0,0,
     115,6,0,0,0,0,2,19,1,6,1,122,31,69,120,116,
     101,110,115,105,111,110,70,105,108,101,76,111,97,100,101,114,
     46,101,120,101,99,95,109,111,100,117,108,101,99,2,0,0,
     0,0,0,0,0,2,0,0,0,4,0,0,0,3,0,0,
-    0,115,48,0,0,0,116,0,0,124,0,0,106,1,0,131,
+    0,115,48,0,0,0,116,0,0,166,0,0,106,1,0,131,
     1,0,100,1,0,25,137,0,0,116,2,0,135,0,0,102,
     1,0,100,2,0,100,3,0,134,0,0,116,3,0,68,131,
     1,0,131,1,0,83,41,4,122,49,82,101,116,117,114,110,
@@ -1598,7 +1598,7 @@ const unsigned char _Py_M__importlib_external[] = {
     78,114,4,0,0,0,41,2,114,22,0,0,0,218,6,115,
     117,102,102,105,120,41,1,218,9,102,105,108,101,95,110,97,
     109,101,114,4,0,0,0,114,5,0,0,0,250,9,60,103,
-    101,110,101,120,112,114,62,152,3,0,0,115,2,0,0,0,
+    101,110,101,120,112,114,62,154,3,0,0,115,2,0,0,0,
     6,1,122,49,69,120,116,101,110,115,105,111,110,70,105,108,
     101,76,111,97,100,101,114,46,105,115,95,112,97,99,107,97,
     103,101,46,60,108,111,99,97,108,115,62,46,60,103,101,110,
@@ -1606,7 +1606,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,218,3,97,110,121,218,18,69,88,84,69,78,83,73,79,
     78,95,83,85,70,70,73,88,69,83,41,2,114,108,0,0,
     0,114,126,0,0,0,114,4,0,0,0,41,1,114,226,0,
-    0,0,114,5,0,0,0,114,159,0,0,0,149,3,0,0,
+    0,0,114,5,0,0,0,114,159,0,0,0,151,3,0,0,
     115,6,0,0,0,0,2,19,1,18,1,122,30,69,120,116,
     101,110,115,105,111,110,70,105,108,101,76,111,97,100,101,114,
     46,105,115,95,112,97,99,107,97,103,101,99,2,0,0,0,
@@ -1618,7 +1618,7 @@ const unsigned char _Py_M__importlib_external[] = {
     99,111,100,101,32,111,98,106,101,99,116,46,78,114,4,0,
     0,0,41,2,114,108,0,0,0,114,126,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,187,0,
-    0,0,155,3,0,0,115,2,0,0,0,0,2,122,28,69,
+    0,0,157,3,0,0,115,2,0,0,0,0,2,122,28,69,
     120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,100,
     101,114,46,103,101,116,95,99,111,100,101,99,2,0,0,0,
     0,0,0,0,2,0,0,0,1,0,0,0,67,0,0,0,
@@ -1628,18 +1628,18 @@ const unsigned char _Py_M__importlib_external[] = {
     118,101,32,110,111,32,115,111,117,114,99,101,32,99,111,100,
     101,46,78,114,4,0,0,0,41,2,114,108,0,0,0,114,
     126,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
-    0,0,0,114,202,0,0,0,159,3,0,0,115,2,0,0,
+    0,0,0,114,202,0,0,0,161,3,0,0,115,2,0,0,
     0,0,2,122,30,69,120,116,101,110,115,105,111,110,70,105,
     108,101,76,111,97,100,101,114,46,103,101,116,95,115,111,117,
     114,99,101,99,2,0,0,0,0,0,0,0,2,0,0,0,
-    1,0,0,0,67,0,0,0,115,7,0,0,0,124,0,0,
+    1,0,0,0,67,0,0,0,115,7,0,0,0,166,0,0,
     106,0,0,83,41,1,122,58,82,101,116,117,114,110,32,116,
     104,101,32,112,97,116,104,32,116,111,32,116,104,101,32,115,
     111,117,114,99,101,32,102,105,108,101,32,97,115,32,102,111,
     117,110,100,32,98,121,32,116,104,101,32,102,105,110,100,101,
     114,46,41,1,114,35,0,0,0,41,2,114,108,0,0,0,
     114,126,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,157,0,0,0,163,3,0,0,115,2,0,
+    5,0,0,0,114,157,0,0,0,165,3,0,0,115,2,0,
     0,0,0,3,122,32,69,120,116,101,110,115,105,111,110,70,
     105,108,101,76,111,97,100,101,114,46,103,101,116,95,102,105,
     108,101,110,97,109,101,78,41,14,114,112,0,0,0,114,111,
@@ -1648,7 +1648,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,114,191,0,0,0,114,159,0,0,0,114,187,0,0,0,
     114,202,0,0,0,114,123,0,0,0,114,157,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
-    0,0,0,114,224,0,0,0,116,3,0,0,115,20,0,0,
+    0,0,0,114,224,0,0,0,118,3,0,0,115,20,0,0,
     0,12,6,6,2,12,4,12,4,12,3,12,8,12,6,12,
     6,12,4,12,4,114,224,0,0,0,99,0,0,0,0,0,
     0,0,0,0,0,0,0,2,0,0,0,64,0,0,0,115,
@@ -1681,10 +1681,10 @@ const unsigned char _Py_M__importlib_external[] = {
     114,101,110,116,32,109,111,100,117,108,101,39,115,32,112,97,
     116,104,10,32,32,32,32,105,115,32,115,121,115,46,112,97,
     116,104,46,99,4,0,0,0,0,0,0,0,4,0,0,0,
-    2,0,0,0,67,0,0,0,115,52,0,0,0,124,1,0,
-    124,0,0,95,0,0,124,2,0,124,0,0,95,1,0,116,
-    2,0,124,0,0,106,3,0,131,0,0,131,1,0,124,0,
-    0,95,4,0,124,3,0,124,0,0,95,5,0,100,0,0,
+    3,0,0,0,67,0,0,0,115,52,0,0,0,165,1,0,
+    124,0,0,95,0,0,165,2,0,124,0,0,95,1,0,116,
+    2,0,124,0,0,160,3,0,161,0,0,131,1,0,124,0,
+    0,95,4,0,165,3,0,124,0,0,95,5,0,100,0,0,
     83,41,1,78,41,6,218,5,95,110,97,109,101,218,5,95,
     112,97,116,104,114,93,0,0,0,218,16,95,103,101,116,95,
     112,97,114,101,110,116,95,112,97,116,104,218,17,95,108,97,
@@ -1692,14 +1692,14 @@ const unsigned char _Py_M__importlib_external[] = {
     95,112,97,116,104,95,102,105,110,100,101,114,41,4,114,108,
     0,0,0,114,106,0,0,0,114,35,0,0,0,218,11,112,
     97,116,104,95,102,105,110,100,101,114,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,185,0,0,0,176,3,
+    4,0,0,0,114,5,0,0,0,114,185,0,0,0,178,3,
     0,0,115,8,0,0,0,0,1,9,1,9,1,21,1,122,
     23,95,78,97,109,101,115,112,97,99,101,80,97,116,104,46,
     95,95,105,110,105,116,95,95,99,1,0,0,0,0,0,0,
     0,4,0,0,0,3,0,0,0,67,0,0,0,115,53,0,
-    0,0,124,0,0,106,0,0,106,1,0,100,1,0,131,1,
-    0,92,3,0,125,1,0,125,2,0,125,3,0,124,2,0,
-    100,2,0,107,2,0,114,43,0,100,6,0,83,124,1,0,
+    0,0,166,0,0,106,0,0,160,1,0,100,1,0,161,1,
+    0,92,3,0,125,1,0,125,2,0,167,3,0,124,2,0,
+    100,2,0,168,2,0,114,43,0,100,6,0,83,124,1,0,
     100,5,0,102,2,0,83,41,7,122,62,82,101,116,117,114,
     110,115,32,97,32,116,117,112,108,101,32,111,102,32,40,112,
     97,114,101,110,116,45,109,111,100,117,108,101,45,110,97,109,
@@ -1711,13 +1711,13 @@ const unsigned char _Py_M__importlib_external[] = {
     41,4,114,108,0,0,0,114,222,0,0,0,218,3,100,111,
     116,90,2,109,101,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,23,95,102,105,110,100,95,112,97,114,101,
-    110,116,95,112,97,116,104,95,110,97,109,101,115,182,3,0,
+    110,116,95,112,97,116,104,95,110,97,109,101,115,184,3,0,
     0,115,8,0,0,0,0,2,27,1,12,2,4,3,122,38,
     95,78,97,109,101,115,112,97,99,101,80,97,116,104,46,95,
     102,105,110,100,95,112,97,114,101,110,116,95,112,97,116,104,
     95,110,97,109,101,115,99,1,0,0,0,0,0,0,0,3,
     0,0,0,3,0,0,0,67,0,0,0,115,38,0,0,0,
-    124,0,0,106,0,0,131,0,0,92,2,0,125,1,0,125,
+    124,0,0,160,0,0,161,0,0,92,2,0,125,1,0,125,
     2,0,116,1,0,116,2,0,106,3,0,124,1,0,25,124,
     2,0,131,2,0,83,41,1,78,41,4,114,238,0,0,0,
     114,117,0,0,0,114,7,0,0,0,218,7,109,111,100,117,
@@ -1725,67 +1725,67 @@ const unsigned char _Py_M__importlib_external[] = {
     110,116,95,109,111,100,117,108,101,95,110,97,109,101,90,14,
     112,97,116,104,95,97,116,116,114,95,110,97,109,101,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,233,0,
-    0,0,192,3,0,0,115,4,0,0,0,0,1,18,1,122,
+    0,0,194,3,0,0,115,4,0,0,0,0,1,18,1,122,
     31,95,78,97,109,101,115,112,97,99,101,80,97,116,104,46,
     95,103,101,116,95,112,97,114,101,110,116,95,112,97,116,104,
-    99,1,0,0,0,0,0,0,0,3,0,0,0,3,0,0,
+    99,1,0,0,0,0,0,0,0,3,0,0,0,4,0,0,
     0,67,0,0,0,115,118,0,0,0,116,0,0,124,0,0,
-    106,1,0,131,0,0,131,1,0,125,1,0,124,1,0,124,
-    0,0,106,2,0,107,3,0,114,111,0,124,0,0,106,3,
-    0,124,0,0,106,4,0,124,1,0,131,2,0,125,2,0,
-    124,2,0,100,0,0,107,9,0,114,102,0,124,2,0,106,
-    5,0,100,0,0,107,8,0,114,102,0,124,2,0,106,6,
-    0,114,102,0,124,2,0,106,6,0,124,0,0,95,7,0,
-    124,1,0,124,0,0,95,2,0,124,0,0,106,7,0,83,
+    160,1,0,161,0,0,131,1,0,167,1,0,124,1,0,166,
+    0,0,106,2,0,168,3,0,114,111,0,124,0,0,160,3,
+    0,166,0,0,106,4,0,124,1,0,161,2,0,167,2,0,
+    124,2,0,100,0,0,168,9,0,114,102,0,166,2,0,106,
+    5,0,100,0,0,168,8,0,114,102,0,166,2,0,106,6,
+    0,114,102,0,166,2,0,106,6,0,124,0,0,95,7,0,
+    165,1,0,124,0,0,95,2,0,166,0,0,106,7,0,83,
     41,1,78,41,8,114,93,0,0,0,114,233,0,0,0,114,
     234,0,0,0,114,235,0,0,0,114,231,0,0,0,114,127,
     0,0,0,114,156,0,0,0,114,232,0,0,0,41,3,114,
     108,0,0,0,90,11,112,97,114,101,110,116,95,112,97,116,
     104,114,164,0,0,0,114,4,0,0,0,114,4,0,0,0,
     114,5,0,0,0,218,12,95,114,101,99,97,108,99,117,108,
-    97,116,101,196,3,0,0,115,16,0,0,0,0,2,18,1,
+    97,116,101,198,3,0,0,115,16,0,0,0,0,2,18,1,
     15,1,21,3,27,1,9,1,12,1,9,1,122,27,95,78,
     97,109,101,115,112,97,99,101,80,97,116,104,46,95,114,101,
     99,97,108,99,117,108,97,116,101,99,1,0,0,0,0,0,
-    0,0,1,0,0,0,2,0,0,0,67,0,0,0,115,16,
-    0,0,0,116,0,0,124,0,0,106,1,0,131,0,0,131,
+    0,0,1,0,0,0,3,0,0,0,67,0,0,0,115,16,
+    0,0,0,116,0,0,124,0,0,160,1,0,161,0,0,131,
     1,0,83,41,1,78,41,2,218,4,105,116,101,114,114,240,
     0,0,0,41,1,114,108,0,0,0,114,4,0,0,0,114,
     4,0,0,0,114,5,0,0,0,218,8,95,95,105,116,101,
-    114,95,95,209,3,0,0,115,2,0,0,0,0,1,122,23,
+    114,95,95,211,3,0,0,115,2,0,0,0,0,1,122,23,
     95,78,97,109,101,115,112,97,99,101,80,97,116,104,46,95,
     95,105,116,101,114,95,95,99,1,0,0,0,0,0,0,0,
-    1,0,0,0,2,0,0,0,67,0,0,0,115,16,0,0,
-    0,116,0,0,124,0,0,106,1,0,131,0,0,131,1,0,
+    1,0,0,0,3,0,0,0,67,0,0,0,115,16,0,0,
+    0,116,0,0,124,0,0,160,1,0,161,0,0,131,1,0,
     83,41,1,78,41,2,114,31,0,0,0,114,240,0,0,0,
     41,1,114,108,0,0,0,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,218,7,95,95,108,101,110,95,95,212,
+    0,114,5,0,0,0,218,7,95,95,108,101,110,95,95,214,
     3,0,0,115,2,0,0,0,0,1,122,22,95,78,97,109,
     101,115,112,97,99,101,80,97,116,104,46,95,95,108,101,110,
-    95,95,99,1,0,0,0,0,0,0,0,1,0,0,0,2,
-    0,0,0,67,0,0,0,115,16,0,0,0,100,1,0,106,
-    0,0,124,0,0,106,1,0,131,1,0,83,41,2,78,122,
+    95,95,99,1,0,0,0,0,0,0,0,1,0,0,0,3,
+    0,0,0,67,0,0,0,115,16,0,0,0,100,1,0,160,
+    0,0,166,0,0,106,1,0,161,1,0,83,41,2,78,122,
     20,95,78,97,109,101,115,112,97,99,101,80,97,116,104,40,
     123,33,114,125,41,41,2,114,47,0,0,0,114,232,0,0,
     0,41,1,114,108,0,0,0,114,4,0,0,0,114,4,0,
     0,0,114,5,0,0,0,218,8,95,95,114,101,112,114,95,
-    95,215,3,0,0,115,2,0,0,0,0,1,122,23,95,78,
+    95,217,3,0,0,115,2,0,0,0,0,1,122,23,95,78,
     97,109,101,115,112,97,99,101,80,97,116,104,46,95,95,114,
     101,112,114,95,95,99,2,0,0,0,0,0,0,0,2,0,
-    0,0,2,0,0,0,67,0,0,0,115,16,0,0,0,124,
-    1,0,124,0,0,106,0,0,131,0,0,107,6,0,83,41,
+    0,0,3,0,0,0,67,0,0,0,115,16,0,0,0,165,
+    1,0,124,0,0,160,0,0,161,0,0,107,6,0,83,41,
     1,78,41,1,114,240,0,0,0,41,2,114,108,0,0,0,
     218,4,105,116,101,109,114,4,0,0,0,114,4,0,0,0,
     114,5,0,0,0,218,12,95,95,99,111,110,116,97,105,110,
-    115,95,95,218,3,0,0,115,2,0,0,0,0,1,122,27,
+    115,95,95,220,3,0,0,115,2,0,0,0,0,1,122,27,
     95,78,97,109,101,115,112,97,99,101,80,97,116,104,46,95,
     95,99,111,110,116,97,105,110,115,95,95,99,2,0,0,0,
-    0,0,0,0,2,0,0,0,2,0,0,0,67,0,0,0,
-    115,20,0,0,0,124,0,0,106,0,0,106,1,0,124,1,
-    0,131,1,0,1,100,0,0,83,41,1,78,41,2,114,232,
+    0,0,0,0,2,0,0,0,3,0,0,0,67,0,0,0,
+    115,20,0,0,0,166,0,0,106,0,0,160,1,0,124,1,
+    0,161,1,0,1,100,0,0,83,41,1,78,41,2,114,232,
     0,0,0,114,163,0,0,0,41,2,114,108,0,0,0,114,
     245,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
-    0,0,0,114,163,0,0,0,221,3,0,0,115,2,0,0,
+    0,0,0,114,163,0,0,0,223,3,0,0,115,2,0,0,
     0,0,1,122,21,95,78,97,109,101,115,112,97,99,101,80,
     97,116,104,46,97,112,112,101,110,100,78,41,13,114,112,0,
     0,0,114,111,0,0,0,114,113,0,0,0,114,114,0,0,
@@ -1793,7 +1793,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,240,0,0,0,114,242,0,0,0,114,243,0,0,0,114,
     244,0,0,0,114,246,0,0,0,114,163,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,
-    0,0,114,230,0,0,0,169,3,0,0,115,20,0,0,0,
+    0,0,114,230,0,0,0,171,3,0,0,115,20,0,0,0,
     12,5,6,2,12,6,12,10,12,4,12,13,12,3,12,3,
     12,3,12,3,114,230,0,0,0,99,0,0,0,0,0,0,
     0,0,0,0,0,0,3,0,0,0,64,0,0,0,115,118,
@@ -1807,17 +1807,17 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,90,11,0,100,17,0,83,41,18,218,16,95,78,97,
     109,101,115,112,97,99,101,76,111,97,100,101,114,99,4,0,
     0,0,0,0,0,0,4,0,0,0,4,0,0,0,67,0,
-    0,0,115,25,0,0,0,116,0,0,124,1,0,124,2,0,
+    0,0,115,25,0,0,0,116,0,0,165,1,0,124,2,0,
     124,3,0,131,3,0,124,0,0,95,1,0,100,0,0,83,
     41,1,78,41,2,114,230,0,0,0,114,232,0,0,0,41,
     4,114,108,0,0,0,114,106,0,0,0,114,35,0,0,0,
     114,236,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,185,0,0,0,227,3,0,0,115,2,0,
+    5,0,0,0,114,185,0,0,0,229,3,0,0,115,2,0,
     0,0,0,1,122,25,95,78,97,109,101,115,112,97,99,101,
     76,111,97,100,101,114,46,95,95,105,110,105,116,95,95,99,
-    2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,
-    67,0,0,0,115,16,0,0,0,100,1,0,106,0,0,124,
-    1,0,106,1,0,131,1,0,83,41,2,122,115,82,101,116,
+    2,0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,
+    67,0,0,0,115,16,0,0,0,100,1,0,160,0,0,166,
+    1,0,106,1,0,161,1,0,83,41,2,122,115,82,101,116,
     117,114,110,32,114,101,112,114,32,102,111,114,32,116,104,101,
     32,109,111,100,117,108,101,46,10,10,32,32,32,32,32,32,
     32,32,84,104,101,32,109,101,116,104,111,100,32,105,115,32,
@@ -1829,14 +1829,14 @@ const unsigned char _Py_M__importlib_external[] = {
     110,97,109,101,115,112,97,99,101,41,62,41,2,114,47,0,
     0,0,114,112,0,0,0,41,2,114,170,0,0,0,114,190,
     0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,
-    0,0,218,11,109,111,100,117,108,101,95,114,101,112,114,230,
+    0,0,218,11,109,111,100,117,108,101,95,114,101,112,114,232,
     3,0,0,115,2,0,0,0,0,7,122,28,95,78,97,109,
     101,115,112,97,99,101,76,111,97,100,101,114,46,109,111,100,
     117,108,101,95,114,101,112,114,99,2,0,0,0,0,0,0,
     0,2,0,0,0,1,0,0,0,67,0,0,0,115,4,0,
     0,0,100,1,0,83,41,2,78,84,114,4,0,0,0,41,
     2,114,108,0,0,0,114,126,0,0,0,114,4,0,0,0,
-    114,4,0,0,0,114,5,0,0,0,114,159,0,0,0,239,
+    114,4,0,0,0,114,5,0,0,0,114,159,0,0,0,241,
     3,0,0,115,2,0,0,0,0,1,122,27,95,78,97,109,
     101,115,112,97,99,101,76,111,97,100,101,114,46,105,115,95,
     112,97,99,107,97,103,101,99,2,0,0,0,0,0,0,0,
@@ -1844,7 +1844,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,100,1,0,83,41,2,78,114,30,0,0,0,114,4,0,
     0,0,41,2,114,108,0,0,0,114,126,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,202,0,
-    0,0,242,3,0,0,115,2,0,0,0,0,1,122,27,95,
+    0,0,244,3,0,0,115,2,0,0,0,0,1,122,27,95,
     78,97,109,101,115,112,97,99,101,76,111,97,100,101,114,46,
     103,101,116,95,115,111,117,114,99,101,99,2,0,0,0,0,
     0,0,0,2,0,0,0,6,0,0,0,67,0,0,0,115,
@@ -1853,7 +1853,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,122,8,60,115,116,114,105,110,103,62,114,189,0,0,
     0,114,204,0,0,0,84,41,1,114,205,0,0,0,41,2,
     114,108,0,0,0,114,126,0,0,0,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,187,0,0,0,245,3,
+    4,0,0,0,114,5,0,0,0,114,187,0,0,0,247,3,
     0,0,115,2,0,0,0,0,1,122,25,95,78,97,109,101,
     115,112,97,99,101,76,111,97,100,101,114,46,103,101,116,95,
     99,111,100,101,99,2,0,0,0,0,0,0,0,2,0,0,
@@ -1863,20 +1863,20 @@ const unsigned char _Py_M__importlib_external[] = {
     109,111,100,117,108,101,32,99,114,101,97,116,105,111,110,46,
     78,114,4,0,0,0,41,2,114,108,0,0,0,114,164,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,186,0,0,0,248,3,0,0,115,0,0,0,0,122,
+    0,114,186,0,0,0,250,3,0,0,115,0,0,0,0,122,
     30,95,78,97,109,101,115,112,97,99,101,76,111,97,100,101,
     114,46,99,114,101,97,116,101,95,109,111,100,117,108,101,99,
     2,0,0,0,0,0,0,0,2,0,0,0,1,0,0,0,
     67,0,0,0,115,4,0,0,0,100,0,0,83,41,1,78,
     114,4,0,0,0,41,2,114,108,0,0,0,114,190,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    114,191,0,0,0,251,3,0,0,115,2,0,0,0,0,1,
+    114,191,0,0,0,253,3,0,0,115,2,0,0,0,0,1,
     122,28,95,78,97,109,101,115,112,97,99,101,76,111,97,100,
     101,114,46,101,120,101,99,95,109,111,100,117,108,101,99,2,
-    0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,67,
-    0,0,0,115,32,0,0,0,116,0,0,100,1,0,124,0,
-    0,106,1,0,131,2,0,1,116,2,0,106,3,0,124,0,
-    0,124,1,0,131,2,0,83,41,2,122,98,76,111,97,100,
+    0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,67,
+    0,0,0,115,32,0,0,0,116,0,0,100,1,0,166,0,
+    0,106,1,0,131,2,0,1,116,2,0,160,3,0,165,0,
+    0,124,1,0,161,2,0,83,41,2,122,98,76,111,97,100,
     32,97,32,110,97,109,101,115,112,97,99,101,32,109,111,100,
     117,108,101,46,10,10,32,32,32,32,32,32,32,32,84,104,
     105,115,32,109,101,116,104,111,100,32,105,115,32,100,101,112,
@@ -1888,7 +1888,7 @@ const unsigned char _Py_M__importlib_external[] = {
     104,32,123,33,114,125,41,4,114,105,0,0,0,114,232,0,
     0,0,114,121,0,0,0,114,192,0,0,0,41,2,114,108,
     0,0,0,114,126,0,0,0,114,4,0,0,0,114,4,0,
-    0,0,114,5,0,0,0,114,193,0,0,0,254,3,0,0,
+    0,0,114,5,0,0,0,114,193,0,0,0,0,4,0,0,
     115,4,0,0,0,0,7,16,1,122,28,95,78,97,109,101,
     115,112,97,99,101,76,111,97,100,101,114,46,108,111,97,100,
     95,109,111,100,117,108,101,78,41,12,114,112,0,0,0,114,
@@ -1896,7 +1896,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,114,248,0,0,0,114,159,0,0,0,114,202,0,
     0,0,114,187,0,0,0,114,186,0,0,0,114,191,0,0,
     0,114,193,0,0,0,114,4,0,0,0,114,4,0,0,0,
-    114,4,0,0,0,114,5,0,0,0,114,247,0,0,0,226,
+    114,4,0,0,0,114,5,0,0,0,114,247,0,0,0,228,
     3,0,0,115,16,0,0,0,12,1,12,3,18,9,12,3,
     12,3,12,3,12,3,12,3,114,247,0,0,0,99,0,0,
     0,0,0,0,0,0,0,0,0,0,5,0,0,0,64,0,
@@ -1917,9 +1917,9 @@ const unsigned char _Py_M__importlib_external[] = {
     32,95,95,112,97,116,104,95,95,32,97,116,116,114,105,98,
     117,116,101,115,46,99,1,0,0,0,0,0,0,0,2,0,
     0,0,4,0,0,0,67,0,0,0,115,55,0,0,0,120,
-    48,0,116,0,0,106,1,0,106,2,0,131,0,0,68,93,
+    48,0,116,0,0,106,1,0,160,2,0,161,0,0,68,93,
     31,0,125,1,0,116,3,0,124,1,0,100,1,0,131,2,
-    0,114,16,0,124,1,0,106,4,0,131,0,0,1,113,16,
+    0,114,16,0,124,1,0,160,4,0,161,0,0,1,113,16,
     0,87,100,2,0,83,41,3,122,125,67,97,108,108,32,116,
     104,101,32,105,110,118,97,108,105,100,97,116,101,95,99,97,
     99,104,101,115,40,41,32,109,101,116,104,111,100,32,111,110,
@@ -1934,17 +1934,17 @@ const unsigned char _Py_M__importlib_external[] = {
     114,95,99,97,99,104,101,218,6,118,97,108,117,101,115,114,
     115,0,0,0,114,250,0,0,0,41,2,114,170,0,0,0,
     218,6,102,105,110,100,101,114,114,4,0,0,0,114,4,0,
-    0,0,114,5,0,0,0,114,250,0,0,0,15,4,0,0,
+    0,0,114,5,0,0,0,114,250,0,0,0,17,4,0,0,
     115,6,0,0,0,0,4,22,1,15,1,122,28,80,97,116,
     104,70,105,110,100,101,114,46,105,110,118,97,108,105,100,97,
     116,101,95,99,97,99,104,101,115,99,2,0,0,0,0,0,
     0,0,3,0,0,0,12,0,0,0,67,0,0,0,115,107,
-    0,0,0,116,0,0,106,1,0,100,1,0,107,9,0,114,
-    41,0,116,0,0,106,1,0,12,114,41,0,116,2,0,106,
-    3,0,100,2,0,116,4,0,131,2,0,1,120,59,0,116,
-    0,0,106,1,0,68,93,44,0,125,2,0,121,14,0,124,
+    0,0,0,116,0,0,106,1,0,100,1,0,168,9,0,114,
+    41,0,116,0,0,106,1,0,12,114,41,0,116,2,0,160,
+    3,0,100,2,0,116,4,0,161,2,0,1,120,59,0,116,
+    0,0,106,1,0,68,93,44,0,125,2,0,121,14,0,165,
     2,0,124,1,0,131,1,0,83,87,113,51,0,4,116,5,
-    0,107,10,0,114,94,0,1,1,1,119,51,0,89,113,51,
+    0,168,10,0,114,94,0,1,1,1,119,51,0,89,113,51,
     0,88,113,51,0,87,100,1,0,83,100,1,0,83,41,3,
     122,113,83,101,97,114,99,104,32,115,101,113,117,101,110,99,
     101,32,111,102,32,104,111,111,107,115,32,102,111,114,32,97,
@@ -1960,17 +1960,17 @@ const unsigned char _Py_M__importlib_external[] = {
     107,0,0,0,41,3,114,170,0,0,0,114,35,0,0,0,
     90,4,104,111,111,107,114,4,0,0,0,114,4,0,0,0,
     114,5,0,0,0,218,11,95,112,97,116,104,95,104,111,111,
-    107,115,23,4,0,0,115,16,0,0,0,0,7,25,1,16,
+    107,115,25,4,0,0,115,16,0,0,0,0,7,25,1,16,
     1,16,1,3,1,14,1,13,1,12,2,122,22,80,97,116,
     104,70,105,110,100,101,114,46,95,112,97,116,104,95,104,111,
     111,107,115,99,2,0,0,0,0,0,0,0,3,0,0,0,
     19,0,0,0,67,0,0,0,115,123,0,0,0,124,1,0,
-    100,1,0,107,2,0,114,53,0,121,16,0,116,0,0,106,
-    1,0,131,0,0,125,1,0,87,110,22,0,4,116,2,0,
-    107,10,0,114,52,0,1,1,1,100,2,0,83,89,110,1,
+    100,1,0,168,2,0,114,53,0,121,16,0,116,0,0,160,
+    1,0,161,0,0,125,1,0,87,110,22,0,4,116,2,0,
+    168,10,0,114,52,0,1,1,1,100,2,0,83,89,110,1,
     0,88,121,17,0,116,3,0,106,4,0,124,1,0,25,125,
-    2,0,87,110,46,0,4,116,5,0,107,10,0,114,118,0,
-    1,1,1,124,0,0,106,6,0,124,1,0,131,1,0,125,
+    2,0,87,110,46,0,4,116,5,0,168,10,0,114,118,0,
+    1,1,1,124,0,0,160,6,0,124,1,0,161,1,0,167,
     2,0,124,2,0,116,3,0,106,4,0,124,1,0,60,89,
     110,1,0,88,124,2,0,83,41,3,122,210,71,101,116,32,
     116,104,101,32,102,105,110,100,101,114,32,102,111,114,32,116,
@@ -1992,19 +1992,19 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,255,0,0,0,41,3,114,170,0,0,0,114,35,
     0,0,0,114,253,0,0,0,114,4,0,0,0,114,4,0,
     0,0,114,5,0,0,0,218,20,95,112,97,116,104,95,105,
-    109,112,111,114,116,101,114,95,99,97,99,104,101,40,4,0,
+    109,112,111,114,116,101,114,95,99,97,99,104,101,42,4,0,
     0,115,22,0,0,0,0,8,12,1,3,1,16,1,13,3,
     9,1,3,1,17,1,13,1,15,1,18,1,122,31,80,97,
     116,104,70,105,110,100,101,114,46,95,112,97,116,104,95,105,
     109,112,111,114,116,101,114,95,99,97,99,104,101,99,3,0,
-    0,0,0,0,0,0,6,0,0,0,3,0,0,0,67,0,
+    0,0,0,0,0,0,6,0,0,0,4,0,0,0,67,0,
     0,0,115,119,0,0,0,116,0,0,124,2,0,100,1,0,
-    131,2,0,114,39,0,124,2,0,106,1,0,124,1,0,131,
+    131,2,0,114,39,0,124,2,0,160,1,0,124,1,0,161,
     1,0,92,2,0,125,3,0,125,4,0,110,21,0,124,2,
-    0,106,2,0,124,1,0,131,1,0,125,3,0,103,0,0,
-    125,4,0,124,3,0,100,0,0,107,9,0,114,88,0,116,
-    3,0,106,4,0,124,1,0,124,3,0,131,2,0,83,116,
-    3,0,106,5,0,124,1,0,100,0,0,131,2,0,125,5,
+    0,160,2,0,124,1,0,161,1,0,125,3,0,103,0,0,
+    167,4,0,124,3,0,100,0,0,168,9,0,114,88,0,116,
+    3,0,160,4,0,165,1,0,124,3,0,161,2,0,83,116,
+    3,0,160,5,0,124,1,0,100,0,0,161,2,0,167,5,
     0,124,4,0,124,5,0,95,6,0,124,5,0,83,41,2,
     78,114,124,0,0,0,41,7,114,115,0,0,0,114,124,0,
     0,0,114,182,0,0,0,114,121,0,0,0,114,179,0,0,
@@ -2012,7 +2012,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,126,0,0,0,114,253,0,0,0,114,127,0,0,
     0,114,128,0,0,0,114,164,0,0,0,114,4,0,0,0,
     114,4,0,0,0,114,5,0,0,0,218,16,95,108,101,103,
-    97,99,121,95,103,101,116,95,115,112,101,99,62,4,0,0,
+    97,99,121,95,103,101,116,95,115,112,101,99,64,4,0,0,
     115,18,0,0,0,0,4,15,1,24,2,15,1,6,1,12,
     1,16,1,18,1,9,1,122,27,80,97,116,104,70,105,110,
     100,101,114,46,95,108,101,103,97,99,121,95,103,101,116,95,
@@ -2020,18 +2020,18 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,5,0,0,0,67,0,0,0,115,243,0,0,0,103,
     0,0,125,4,0,120,230,0,124,2,0,68,93,191,0,125,
     5,0,116,0,0,124,5,0,116,1,0,116,2,0,102,2,
-    0,131,2,0,115,43,0,113,13,0,124,0,0,106,3,0,
-    124,5,0,131,1,0,125,6,0,124,6,0,100,1,0,107,
+    0,131,2,0,115,43,0,113,13,0,124,0,0,160,3,0,
+    124,5,0,161,1,0,167,6,0,124,6,0,100,1,0,168,
     9,0,114,13,0,116,4,0,124,6,0,100,2,0,131,2,
-    0,114,106,0,124,6,0,106,5,0,124,1,0,124,3,0,
-    131,2,0,125,7,0,110,18,0,124,0,0,106,6,0,124,
-    1,0,124,6,0,131,2,0,125,7,0,124,7,0,100,1,
-    0,107,8,0,114,139,0,113,13,0,124,7,0,106,7,0,
-    100,1,0,107,9,0,114,158,0,124,7,0,83,124,7,0,
-    106,8,0,125,8,0,124,8,0,100,1,0,107,8,0,114,
+    0,114,106,0,124,6,0,160,5,0,165,1,0,124,3,0,
+    161,2,0,125,7,0,110,18,0,124,0,0,160,6,0,165,
+    1,0,124,6,0,161,2,0,167,7,0,124,7,0,100,1,
+    0,168,8,0,114,139,0,113,13,0,166,7,0,106,7,0,
+    100,1,0,168,9,0,114,158,0,124,7,0,83,166,7,0,
+    106,8,0,167,8,0,124,8,0,100,1,0,168,8,0,114,
     191,0,116,9,0,100,3,0,131,1,0,130,1,0,124,4,
-    0,106,10,0,124,8,0,131,1,0,1,113,13,0,87,116,
-    11,0,106,12,0,124,1,0,100,1,0,131,2,0,125,7,
+    0,160,10,0,124,8,0,161,1,0,1,113,13,0,87,116,
+    11,0,160,12,0,124,1,0,100,1,0,161,2,0,167,7,
     0,124,4,0,124,7,0,95,8,0,124,7,0,83,100,1,
     0,83,41,4,122,63,70,105,110,100,32,116,104,101,32,108,
     111,97,100,101,114,32,111,114,32,110,97,109,101,115,112,97,
@@ -2048,20 +2048,20 @@ const unsigned char _Py_M__importlib_external[] = {
     101,115,112,97,99,101,95,112,97,116,104,90,5,101,110,116,
     114,121,114,253,0,0,0,114,164,0,0,0,114,128,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    218,9,95,103,101,116,95,115,112,101,99,77,4,0,0,115,
+    218,9,95,103,101,116,95,115,112,101,99,79,4,0,0,115,
     40,0,0,0,0,5,6,1,13,1,21,1,3,1,15,1,
     12,1,15,1,21,2,18,1,12,1,3,1,15,1,4,1,
     9,1,12,1,12,5,17,2,18,1,9,1,122,20,80,97,
     116,104,70,105,110,100,101,114,46,95,103,101,116,95,115,112,
-    101,99,99,4,0,0,0,0,0,0,0,6,0,0,0,4,
+    101,99,99,4,0,0,0,0,0,0,0,6,0,0,0,5,
     0,0,0,67,0,0,0,115,140,0,0,0,124,2,0,100,
-    1,0,107,8,0,114,21,0,116,0,0,106,1,0,125,2,
-    0,124,0,0,106,2,0,124,1,0,124,2,0,124,3,0,
-    131,3,0,125,4,0,124,4,0,100,1,0,107,8,0,114,
-    58,0,100,1,0,83,124,4,0,106,3,0,100,1,0,107,
-    8,0,114,132,0,124,4,0,106,4,0,125,5,0,124,5,
+    1,0,168,8,0,114,21,0,116,0,0,106,1,0,167,2,
+    0,124,0,0,160,2,0,165,1,0,124,2,0,124,3,0,
+    161,3,0,167,4,0,124,4,0,100,1,0,168,8,0,114,
+    58,0,100,1,0,83,166,4,0,106,3,0,100,1,0,168,
+    8,0,114,132,0,166,4,0,106,4,0,167,5,0,124,5,
     0,114,125,0,100,2,0,124,4,0,95,5,0,116,6,0,
-    124,1,0,124,5,0,124,0,0,106,2,0,131,3,0,124,
+    165,1,0,124,5,0,166,0,0,106,2,0,131,3,0,124,
     4,0,95,4,0,124,4,0,83,100,1,0,83,110,4,0,
     124,4,0,83,100,1,0,83,41,3,122,98,102,105,110,100,
     32,116,104,101,32,109,111,100,117,108,101,32,111,110,32,115,
@@ -2076,14 +2076,14 @@ const unsigned char _Py_M__importlib_external[] = {
     6,114,170,0,0,0,114,126,0,0,0,114,35,0,0,0,
     114,180,0,0,0,114,164,0,0,0,114,4,1,0,0,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,181,
-    0,0,0,109,4,0,0,115,26,0,0,0,0,4,12,1,
+    0,0,0,111,4,0,0,115,26,0,0,0,0,4,12,1,
     9,1,21,1,12,1,4,1,15,1,9,1,6,3,9,1,
     24,1,4,2,7,2,122,20,80,97,116,104,70,105,110,100,
     101,114,46,102,105,110,100,95,115,112,101,99,99,3,0,0,
-    0,0,0,0,0,4,0,0,0,3,0,0,0,67,0,0,
-    0,115,41,0,0,0,124,0,0,106,0,0,124,1,0,124,
-    2,0,131,2,0,125,3,0,124,3,0,100,1,0,107,8,
-    0,114,34,0,100,1,0,83,124,3,0,106,1,0,83,41,
+    0,0,0,0,0,4,0,0,0,4,0,0,0,67,0,0,
+    0,115,41,0,0,0,124,0,0,160,0,0,165,1,0,124,
+    2,0,161,2,0,167,3,0,124,3,0,100,1,0,168,8,
+    0,114,34,0,100,1,0,83,166,3,0,106,1,0,83,41,
     2,122,170,102,105,110,100,32,116,104,101,32,109,111,100,117,
     108,101,32,111,110,32,115,121,115,46,112,97,116,104,32,111,
     114,32,39,112,97,116,104,39,32,98,97,115,101,100,32,111,
@@ -2098,7 +2098,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,181,0,0,0,114,127,0,0,0,41,4,114,170,0,0,
     0,114,126,0,0,0,114,35,0,0,0,114,164,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
-    182,0,0,0,131,4,0,0,115,8,0,0,0,0,8,18,
+    182,0,0,0,133,4,0,0,115,8,0,0,0,0,8,18,
     1,12,1,4,1,122,22,80,97,116,104,70,105,110,100,101,
     114,46,102,105,110,100,95,109,111,100,117,108,101,41,12,114,
     112,0,0,0,114,111,0,0,0,114,113,0,0,0,114,114,
@@ -2106,7 +2106,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,1,1,0,0,114,2,1,0,0,114,5,1,0,
     0,114,181,0,0,0,114,182,0,0,0,114,4,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
-    249,0,0,0,11,4,0,0,115,22,0,0,0,12,2,6,
+    249,0,0,0,13,4,0,0,115,22,0,0,0,12,2,6,
     2,18,8,18,17,18,22,18,15,3,1,18,31,3,1,21,
     21,3,1,114,249,0,0,0,99,0,0,0,0,0,0,0,
     0,0,0,0,0,3,0,0,0,64,0,0,0,115,133,0,
@@ -2131,11 +2131,11 @@ const unsigned char _Py_M__importlib_external[] = {
     115,32,104,97,110,100,108,105,110,103,32,104,97,115,32,98,
     101,101,110,32,109,111,100,105,102,105,101,100,46,10,10,32,
     32,32,32,99,2,0,0,0,0,0,0,0,5,0,0,0,
-    5,0,0,0,7,0,0,0,115,122,0,0,0,103,0,0,
+    6,0,0,0,7,0,0,0,115,122,0,0,0,103,0,0,
     125,3,0,120,52,0,124,2,0,68,93,44,0,92,2,0,
-    137,0,0,125,4,0,124,3,0,106,0,0,135,0,0,102,
+    137,0,0,167,4,0,124,3,0,160,0,0,135,0,0,102,
     1,0,100,1,0,100,2,0,134,0,0,124,4,0,68,131,
-    1,0,131,1,0,1,113,13,0,87,124,3,0,124,0,0,
+    1,0,161,1,0,1,113,13,0,87,165,3,0,124,0,0,
     95,1,0,124,1,0,112,79,0,100,3,0,124,0,0,95,
     2,0,100,6,0,124,0,0,95,3,0,116,4,0,131,0,
     0,124,0,0,95,5,0,116,4,0,131,0,0,124,0,0,
@@ -2151,11 +2151,11 @@ const unsigned char _Py_M__importlib_external[] = {
     114,10,32,32,32,32,32,32,32,32,114,101,99,111,103,110,
     105,122,101,115,46,99,1,0,0,0,0,0,0,0,2,0,
     0,0,3,0,0,0,51,0,0,0,115,27,0,0,0,124,
-    0,0,93,17,0,125,1,0,124,1,0,136,0,0,102,2,
+    0,0,93,17,0,167,1,0,124,1,0,136,0,0,102,2,
     0,86,1,113,3,0,100,0,0,83,41,1,78,114,4,0,
     0,0,41,2,114,22,0,0,0,114,225,0,0,0,41,1,
     114,127,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
-    227,0,0,0,160,4,0,0,115,2,0,0,0,6,0,122,
+    227,0,0,0,162,4,0,0,115,2,0,0,0,6,0,122,
     38,70,105,108,101,70,105,110,100,101,114,46,95,95,105,110,
     105,116,95,95,46,60,108,111,99,97,108,115,62,46,60,103,
     101,110,101,120,112,114,62,114,58,0,0,0,114,29,0,0,
@@ -2168,7 +2168,7 @@ const unsigned char _Py_M__importlib_external[] = {
     111,97,100,101,114,95,100,101,116,97,105,108,115,90,7,108,
     111,97,100,101,114,115,114,166,0,0,0,114,4,0,0,0,
     41,1,114,127,0,0,0,114,5,0,0,0,114,185,0,0,
-    0,154,4,0,0,115,16,0,0,0,0,4,6,1,19,1,
+    0,156,4,0,0,115,16,0,0,0,0,4,6,1,19,1,
     36,1,9,2,15,1,9,1,12,1,122,19,70,105,108,101,
     70,105,110,100,101,114,46,95,95,105,110,105,116,95,95,99,
     1,0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,
@@ -2178,14 +2178,14 @@ const unsigned char _Py_M__importlib_external[] = {
     114,121,32,109,116,105,109,101,46,114,29,0,0,0,78,114,
     87,0,0,0,41,1,114,8,1,0,0,41,1,114,108,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,250,0,0,0,168,4,0,0,115,2,0,0,0,0,
+    0,114,250,0,0,0,170,4,0,0,115,2,0,0,0,0,
     2,122,28,70,105,108,101,70,105,110,100,101,114,46,105,110,
     118,97,108,105,100,97,116,101,95,99,97,99,104,101,115,99,
-    2,0,0,0,0,0,0,0,3,0,0,0,2,0,0,0,
-    67,0,0,0,115,59,0,0,0,124,0,0,106,0,0,124,
-    1,0,131,1,0,125,2,0,124,2,0,100,1,0,107,8,
-    0,114,37,0,100,1,0,103,0,0,102,2,0,83,124,2,
-    0,106,1,0,124,2,0,106,2,0,112,55,0,103,0,0,
+    2,0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,
+    67,0,0,0,115,59,0,0,0,124,0,0,160,0,0,124,
+    1,0,161,1,0,167,2,0,124,2,0,100,1,0,168,8,
+    0,114,37,0,100,1,0,103,0,0,102,2,0,83,166,2,
+    0,106,1,0,166,2,0,106,2,0,112,55,0,103,0,0,
     102,2,0,83,41,2,122,197,84,114,121,32,116,111,32,102,
     105,110,100,32,97,32,108,111,97,100,101,114,32,102,111,114,
     32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,109,
@@ -2202,52 +2202,52 @@ const unsigned char _Py_M__importlib_external[] = {
     114,181,0,0,0,114,127,0,0,0,114,156,0,0,0,41,
     3,114,108,0,0,0,114,126,0,0,0,114,164,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
-    124,0,0,0,174,4,0,0,115,8,0,0,0,0,7,15,
+    124,0,0,0,176,4,0,0,115,8,0,0,0,0,7,15,
     1,12,1,10,1,122,22,70,105,108,101,70,105,110,100,101,
     114,46,102,105,110,100,95,108,111,97,100,101,114,99,6,0,
     0,0,0,0,0,0,7,0,0,0,7,0,0,0,67,0,
-    0,0,115,40,0,0,0,124,1,0,124,2,0,124,3,0,
-    131,2,0,125,6,0,116,0,0,124,2,0,124,3,0,100,
+    0,0,115,40,0,0,0,165,1,0,124,2,0,124,3,0,
+    131,2,0,125,6,0,116,0,0,165,2,0,124,3,0,100,
     1,0,124,6,0,100,2,0,124,4,0,131,2,2,83,41,
     3,78,114,127,0,0,0,114,156,0,0,0,41,1,114,167,
     0,0,0,41,7,114,108,0,0,0,114,165,0,0,0,114,
     126,0,0,0,114,35,0,0,0,90,4,115,109,115,108,114,
     180,0,0,0,114,127,0,0,0,114,4,0,0,0,114,4,
-    0,0,0,114,5,0,0,0,114,5,1,0,0,186,4,0,
+    0,0,0,114,5,0,0,0,114,5,1,0,0,188,4,0,
     0,115,6,0,0,0,0,1,15,1,18,1,122,20,70,105,
     108,101,70,105,110,100,101,114,46,95,103,101,116,95,115,112,
     101,99,78,99,3,0,0,0,0,0,0,0,14,0,0,0,
-    15,0,0,0,67,0,0,0,115,234,1,0,0,100,1,0,
-    125,3,0,124,1,0,106,0,0,100,2,0,131,1,0,100,
-    3,0,25,125,4,0,121,34,0,116,1,0,124,0,0,106,
-    2,0,112,49,0,116,3,0,106,4,0,131,0,0,131,1,
-    0,106,5,0,125,5,0,87,110,24,0,4,116,6,0,107,
+    16,0,0,0,67,0,0,0,115,234,1,0,0,100,1,0,
+    167,3,0,124,1,0,160,0,0,100,2,0,161,1,0,100,
+    3,0,25,125,4,0,121,34,0,116,1,0,166,0,0,106,
+    2,0,112,49,0,116,3,0,160,4,0,161,0,0,131,1,
+    0,106,5,0,125,5,0,87,110,24,0,4,116,6,0,168,
     10,0,114,85,0,1,1,1,100,10,0,125,5,0,89,110,
-    1,0,88,124,5,0,124,0,0,106,7,0,107,3,0,114,
-    120,0,124,0,0,106,8,0,131,0,0,1,124,5,0,124,
-    0,0,95,7,0,116,9,0,131,0,0,114,153,0,124,0,
-    0,106,10,0,125,6,0,124,4,0,106,11,0,131,0,0,
-    125,7,0,110,15,0,124,0,0,106,12,0,125,6,0,124,
-    4,0,125,7,0,124,7,0,124,6,0,107,6,0,114,45,
-    1,116,13,0,124,0,0,106,2,0,124,4,0,131,2,0,
-    125,8,0,120,100,0,124,0,0,106,14,0,68,93,77,0,
+    1,0,88,165,5,0,124,0,0,106,7,0,168,3,0,114,
+    120,0,124,0,0,160,8,0,161,0,0,1,165,5,0,124,
+    0,0,95,7,0,116,9,0,131,0,0,114,153,0,166,0,
+    0,106,10,0,167,6,0,124,4,0,160,11,0,161,0,0,
+    125,7,0,110,15,0,166,0,0,106,12,0,167,6,0,124,
+    4,0,167,7,0,124,7,0,124,6,0,168,6,0,114,45,
+    1,116,13,0,166,0,0,106,2,0,124,4,0,131,2,0,
+    125,8,0,120,100,0,166,0,0,106,14,0,68,93,77,0,
     92,2,0,125,9,0,125,10,0,100,5,0,124,9,0,23,
-    125,11,0,116,13,0,124,8,0,124,11,0,131,2,0,125,
+    125,11,0,116,13,0,165,8,0,124,11,0,131,2,0,125,
     12,0,116,15,0,124,12,0,131,1,0,114,208,0,124,0,
-    0,106,16,0,124,10,0,124,1,0,124,12,0,124,8,0,
-    103,1,0,124,2,0,131,5,0,83,113,208,0,87,116,17,
-    0,124,8,0,131,1,0,125,3,0,120,123,0,124,0,0,
+    0,160,16,0,165,10,0,124,1,0,165,12,0,124,8,0,
+    103,1,0,124,2,0,161,5,0,83,113,208,0,87,116,17,
+    0,124,8,0,131,1,0,125,3,0,120,123,0,166,0,0,
     106,14,0,68,93,112,0,92,2,0,125,9,0,125,10,0,
-    116,13,0,124,0,0,106,2,0,124,4,0,124,9,0,23,
-    131,2,0,125,12,0,116,18,0,100,6,0,106,19,0,124,
-    12,0,131,1,0,100,7,0,100,3,0,131,1,1,1,124,
-    7,0,124,9,0,23,124,6,0,107,6,0,114,55,1,116,
-    15,0,124,12,0,131,1,0,114,55,1,124,0,0,106,16,
-    0,124,10,0,124,1,0,124,12,0,100,8,0,124,2,0,
-    131,5,0,83,113,55,1,87,124,3,0,114,230,1,116,18,
-    0,100,9,0,106,19,0,124,8,0,131,1,0,131,1,0,
-    1,116,20,0,106,21,0,124,1,0,100,8,0,131,2,0,
-    125,13,0,124,8,0,103,1,0,124,13,0,95,22,0,124,
+    116,13,0,166,0,0,106,2,0,165,4,0,124,9,0,23,
+    131,2,0,125,12,0,116,18,0,100,6,0,160,19,0,124,
+    12,0,161,1,0,100,7,0,100,3,0,131,1,1,1,165,
+    7,0,124,9,0,23,124,6,0,168,6,0,114,55,1,116,
+    15,0,124,12,0,131,1,0,114,55,1,124,0,0,160,16,
+    0,165,10,0,124,1,0,124,12,0,100,8,0,124,2,0,
+    161,5,0,83,113,55,1,87,124,3,0,114,230,1,116,18,
+    0,100,9,0,160,19,0,124,8,0,161,1,0,131,1,0,
+    1,116,20,0,160,21,0,124,1,0,100,8,0,161,2,0,
+    167,13,0,124,8,0,103,1,0,124,13,0,95,22,0,124,
     13,0,83,100,8,0,83,41,11,122,102,84,114,121,32,116,
     111,32,102,105,110,100,32,97,32,115,112,101,99,32,102,111,
     114,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,
@@ -2276,29 +2276,29 @@ const unsigned char _Py_M__importlib_external[] = {
     13,105,110,105,116,95,102,105,108,101,110,97,109,101,90,9,
     102,117,108,108,95,112,97,116,104,114,164,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,181,0,
-    0,0,191,4,0,0,115,68,0,0,0,0,3,6,1,19,
+    0,0,193,4,0,0,115,68,0,0,0,0,3,6,1,19,
     1,3,1,34,1,13,1,11,1,15,1,10,1,9,2,9,
     1,9,1,15,2,9,1,6,2,12,1,18,1,22,1,10,
     1,15,1,12,1,32,4,12,2,22,1,22,1,25,1,16,
     1,12,1,29,1,6,1,19,1,18,1,12,1,4,1,122,
     20,70,105,108,101,70,105,110,100,101,114,46,102,105,110,100,
     95,115,112,101,99,99,1,0,0,0,0,0,0,0,9,0,
-    0,0,13,0,0,0,67,0,0,0,115,11,1,0,0,124,
-    0,0,106,0,0,125,1,0,121,31,0,116,1,0,106,2,
-    0,124,1,0,112,33,0,116,1,0,106,3,0,131,0,0,
-    131,1,0,125,2,0,87,110,33,0,4,116,4,0,116,5,
-    0,116,6,0,102,3,0,107,10,0,114,75,0,1,1,1,
+    0,0,14,0,0,0,67,0,0,0,115,11,1,0,0,166,
+    0,0,106,0,0,125,1,0,121,31,0,116,1,0,160,2,
+    0,124,1,0,112,33,0,116,1,0,160,3,0,161,0,0,
+    161,1,0,125,2,0,87,110,33,0,4,116,4,0,116,5,
+    0,116,6,0,102,3,0,168,10,0,114,75,0,1,1,1,
     103,0,0,125,2,0,89,110,1,0,88,116,7,0,106,8,
-    0,106,9,0,100,1,0,131,1,0,115,112,0,116,10,0,
+    0,160,9,0,100,1,0,161,1,0,115,112,0,116,10,0,
     124,2,0,131,1,0,124,0,0,95,11,0,110,111,0,116,
     10,0,131,0,0,125,3,0,120,90,0,124,2,0,68,93,
-    82,0,125,4,0,124,4,0,106,12,0,100,2,0,131,1,
-    0,92,3,0,125,5,0,125,6,0,125,7,0,124,6,0,
-    114,191,0,100,3,0,106,13,0,124,5,0,124,7,0,106,
-    14,0,131,0,0,131,2,0,125,8,0,110,6,0,124,5,
-    0,125,8,0,124,3,0,106,15,0,124,8,0,131,1,0,
-    1,113,128,0,87,124,3,0,124,0,0,95,11,0,116,7,
-    0,106,8,0,106,9,0,116,16,0,131,1,0,114,7,1,
+    82,0,167,4,0,124,4,0,160,12,0,100,2,0,161,1,
+    0,92,3,0,125,5,0,125,6,0,167,7,0,124,6,0,
+    114,191,0,100,3,0,160,13,0,165,5,0,124,7,0,160,
+    14,0,161,0,0,161,2,0,125,8,0,110,6,0,124,5,
+    0,167,8,0,124,3,0,160,15,0,124,8,0,161,1,0,
+    1,113,128,0,87,165,3,0,124,0,0,95,11,0,116,7,
+    0,106,8,0,160,9,0,116,16,0,161,1,0,114,7,1,
     100,4,0,100,5,0,132,0,0,124,2,0,68,131,1,0,
     124,0,0,95,17,0,100,6,0,83,41,7,122,68,70,105,
     108,108,32,116,104,101,32,99,97,99,104,101,32,111,102,32,
@@ -2307,12 +2307,12 @@ const unsigned char _Py_M__importlib_external[] = {
     111,114,32,116,104,105,115,32,100,105,114,101,99,116,111,114,
     121,46,114,0,0,0,0,114,58,0,0,0,122,5,123,125,
     46,123,125,99,1,0,0,0,0,0,0,0,2,0,0,0,
-    3,0,0,0,83,0,0,0,115,28,0,0,0,104,0,0,
-    124,0,0,93,18,0,125,1,0,124,1,0,106,0,0,131,
+    4,0,0,0,83,0,0,0,115,28,0,0,0,104,0,0,
+    124,0,0,93,18,0,167,1,0,124,1,0,160,0,0,161,
     0,0,146,2,0,113,6,0,83,114,4,0,0,0,41,1,
     114,88,0,0,0,41,2,114,22,0,0,0,90,2,102,110,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,250,
-    9,60,115,101,116,99,111,109,112,62,9,5,0,0,115,2,
+    9,60,115,101,116,99,111,109,112,62,11,5,0,0,115,2,
     0,0,0,9,0,122,41,70,105,108,101,70,105,110,100,101,
     114,46,95,102,105,108,108,95,99,97,99,104,101,46,60,108,
     111,99,97,108,115,62,46,60,115,101,116,99,111,109,112,62,
@@ -2329,14 +2329,14 @@ const unsigned char _Py_M__importlib_external[] = {
     95,99,111,110,116,101,110,116,115,114,245,0,0,0,114,106,
     0,0,0,114,237,0,0,0,114,225,0,0,0,90,8,110,
     101,119,95,110,97,109,101,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,114,13,1,0,0,236,4,0,0,115,
+    0,114,5,0,0,0,114,13,1,0,0,238,4,0,0,115,
     34,0,0,0,0,2,9,1,3,1,31,1,22,3,11,3,
     18,1,18,7,9,1,13,1,24,1,6,1,27,2,6,1,
     17,1,9,1,18,1,122,22,70,105,108,101,70,105,110,100,
     101,114,46,95,102,105,108,108,95,99,97,99,104,101,99,1,
     0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,7,
     0,0,0,115,25,0,0,0,135,0,0,135,1,0,102,2,
-    0,100,1,0,100,2,0,134,0,0,125,2,0,124,2,0,
+    0,100,1,0,100,2,0,134,0,0,167,2,0,124,2,0,
     83,41,3,97,20,1,0,0,65,32,99,108,97,115,115,32,
     109,101,116,104,111,100,32,119,104,105,99,104,32,114,101,116,
     117,114,110,115,32,97,32,99,108,111,115,117,114,101,32,116,
@@ -2368,7 +2368,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,41,1,114,35,0,0,0,41,2,114,170,0,0,
     0,114,12,1,0,0,114,4,0,0,0,114,5,0,0,0,
     218,24,112,97,116,104,95,104,111,111,107,95,102,111,114,95,
-    70,105,108,101,70,105,110,100,101,114,21,5,0,0,115,6,
+    70,105,108,101,70,105,110,100,101,114,23,5,0,0,115,6,
     0,0,0,0,2,12,1,18,1,122,54,70,105,108,101,70,
     105,110,100,101,114,46,112,97,116,104,95,104,111,111,107,46,
     60,108,111,99,97,108,115,62,46,112,97,116,104,95,104,111,
@@ -2376,16 +2376,16 @@ const unsigned char _Py_M__importlib_external[] = {
     114,114,4,0,0,0,41,3,114,170,0,0,0,114,12,1,
     0,0,114,18,1,0,0,114,4,0,0,0,41,2,114,170,
     0,0,0,114,12,1,0,0,114,5,0,0,0,218,9,112,
-    97,116,104,95,104,111,111,107,11,5,0,0,115,4,0,0,
+    97,116,104,95,104,111,111,107,13,5,0,0,115,4,0,0,
     0,0,10,21,6,122,20,70,105,108,101,70,105,110,100,101,
     114,46,112,97,116,104,95,104,111,111,107,99,1,0,0,0,
-    0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,0,
-    115,16,0,0,0,100,1,0,106,0,0,124,0,0,106,1,
-    0,131,1,0,83,41,2,78,122,16,70,105,108,101,70,105,
+    0,0,0,0,1,0,0,0,3,0,0,0,67,0,0,0,
+    115,16,0,0,0,100,1,0,160,0,0,166,0,0,106,1,
+    0,161,1,0,83,41,2,78,122,16,70,105,108,101,70,105,
     110,100,101,114,40,123,33,114,125,41,41,2,114,47,0,0,
     0,114,35,0,0,0,41,1,114,108,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,244,0,0,
-    0,29,5,0,0,115,2,0,0,0,0,1,122,19,70,105,
+    0,31,5,0,0,115,2,0,0,0,0,1,122,19,70,105,
     108,101,70,105,110,100,101,114,46,95,95,114,101,112,114,95,
     95,41,15,114,112,0,0,0,114,111,0,0,0,114,113,0,
     0,0,114,114,0,0,0,114,185,0,0,0,114,250,0,0,
@@ -2393,22 +2393,22 @@ const unsigned char _Py_M__importlib_external[] = {
     114,5,1,0,0,114,181,0,0,0,114,13,1,0,0,114,
     183,0,0,0,114,19,1,0,0,114,244,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,
-    0,0,114,6,1,0,0,145,4,0,0,115,20,0,0,0,
+    0,0,114,6,1,0,0,147,4,0,0,115,20,0,0,0,
     12,7,6,2,12,14,12,4,6,2,12,12,12,5,15,45,
     12,31,18,18,114,6,1,0,0,99,4,0,0,0,0,0,
     0,0,6,0,0,0,11,0,0,0,67,0,0,0,115,195,
-    0,0,0,124,0,0,106,0,0,100,1,0,131,1,0,125,
-    4,0,124,0,0,106,0,0,100,2,0,131,1,0,125,5,
-    0,124,4,0,115,99,0,124,5,0,114,54,0,124,5,0,
-    106,1,0,125,4,0,110,45,0,124,2,0,124,3,0,107,
-    2,0,114,84,0,116,2,0,124,1,0,124,2,0,131,2,
-    0,125,4,0,110,15,0,116,3,0,124,1,0,124,2,0,
-    131,2,0,125,4,0,124,5,0,115,126,0,116,4,0,124,
+    0,0,0,124,0,0,160,0,0,100,1,0,161,1,0,167,
+    4,0,124,0,0,160,0,0,100,2,0,161,1,0,167,5,
+    0,124,4,0,115,99,0,124,5,0,114,54,0,166,5,0,
+    106,1,0,125,4,0,110,45,0,165,2,0,124,3,0,168,
+    2,0,114,84,0,116,2,0,165,1,0,124,2,0,131,2,
+    0,125,4,0,110,15,0,116,3,0,165,1,0,124,2,0,
+    131,2,0,167,4,0,124,5,0,115,126,0,116,4,0,165,
     1,0,124,2,0,100,3,0,124,4,0,131,2,1,125,5,
-    0,121,44,0,124,5,0,124,0,0,100,2,0,60,124,4,
-    0,124,0,0,100,1,0,60,124,2,0,124,0,0,100,4,
-    0,60,124,3,0,124,0,0,100,5,0,60,87,110,18,0,
-    4,116,5,0,107,10,0,114,190,0,1,1,1,89,110,1,
+    0,121,44,0,165,5,0,124,0,0,100,2,0,60,165,4,
+    0,124,0,0,100,1,0,60,165,2,0,124,0,0,100,4,
+    0,60,165,3,0,124,0,0,100,5,0,60,87,110,18,0,
+    4,116,5,0,168,10,0,114,190,0,1,1,1,89,110,1,
     0,88,100,0,0,83,41,6,78,218,10,95,95,108,111,97,
     100,101,114,95,95,218,8,95,95,115,112,101,99,95,95,114,
     127,0,0,0,90,8,95,95,102,105,108,101,95,95,90,10,
@@ -2419,15 +2419,15 @@ const unsigned char _Py_M__importlib_external[] = {
     104,110,97,109,101,90,9,99,112,97,116,104,110,97,109,101,
     114,127,0,0,0,114,164,0,0,0,114,4,0,0,0,114,
     4,0,0,0,114,5,0,0,0,218,14,95,102,105,120,95,
-    117,112,95,109,111,100,117,108,101,35,5,0,0,115,34,0,
+    117,112,95,109,111,100,117,108,101,37,5,0,0,115,34,0,
     0,0,0,2,15,1,15,1,6,1,6,1,12,1,12,1,
     18,2,15,1,6,1,21,1,3,1,10,1,10,1,10,1,
     14,1,13,2,114,24,1,0,0,99,0,0,0,0,0,0,
     0,0,3,0,0,0,3,0,0,0,67,0,0,0,115,55,
-    0,0,0,116,0,0,116,1,0,106,2,0,131,0,0,102,
+    0,0,0,116,0,0,116,1,0,160,2,0,161,0,0,102,
     2,0,125,0,0,116,3,0,116,4,0,102,2,0,125,1,
-    0,116,5,0,116,6,0,102,2,0,125,2,0,124,0,0,
-    124,1,0,124,2,0,103,3,0,83,41,1,122,95,82,101,
+    0,116,5,0,116,6,0,102,2,0,167,2,0,124,0,0,
+    165,1,0,124,2,0,103,3,0,83,41,1,122,95,82,101,
     116,117,114,110,115,32,97,32,108,105,115,116,32,111,102,32,
     102,105,108,101,45,98,97,115,101,100,32,109,111,100,117,108,
     101,32,108,111,97,100,101,114,115,46,10,10,32,32,32,32,
@@ -2440,45 +2440,45 @@ const unsigned char _Py_M__importlib_external[] = {
     0,41,3,90,10,101,120,116,101,110,115,105,111,110,115,90,
     6,115,111,117,114,99,101,90,8,98,121,116,101,99,111,100,
     101,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    114,161,0,0,0,58,5,0,0,115,8,0,0,0,0,5,
+    114,161,0,0,0,60,5,0,0,115,8,0,0,0,0,5,
     18,1,12,1,12,1,114,161,0,0,0,99,1,0,0,0,
     0,0,0,0,12,0,0,0,12,0,0,0,67,0,0,0,
     115,70,2,0,0,124,0,0,97,0,0,116,0,0,106,1,
     0,97,1,0,116,0,0,106,2,0,97,2,0,116,1,0,
     106,3,0,116,4,0,25,125,1,0,120,76,0,100,26,0,
-    68,93,68,0,125,2,0,124,2,0,116,1,0,106,3,0,
-    107,7,0,114,83,0,116,0,0,106,5,0,124,2,0,131,
+    68,93,68,0,167,2,0,124,2,0,116,1,0,106,3,0,
+    168,7,0,114,83,0,116,0,0,160,5,0,124,2,0,161,
     1,0,125,3,0,110,13,0,116,1,0,106,3,0,124,2,
-    0,25,125,3,0,116,6,0,124,1,0,124,2,0,124,3,
+    0,25,125,3,0,116,6,0,165,1,0,124,2,0,124,3,
     0,131,3,0,1,113,44,0,87,100,5,0,100,6,0,103,
     1,0,102,2,0,100,7,0,100,8,0,100,6,0,103,2,
     0,102,2,0,102,2,0,125,4,0,120,149,0,124,4,0,
     68,93,129,0,92,2,0,125,5,0,125,6,0,116,7,0,
     100,9,0,100,10,0,132,0,0,124,6,0,68,131,1,0,
     131,1,0,115,199,0,116,8,0,130,1,0,124,6,0,100,
-    11,0,25,125,7,0,124,5,0,116,1,0,106,3,0,107,
+    11,0,25,167,7,0,124,5,0,116,1,0,106,3,0,168,
     6,0,114,241,0,116,1,0,106,3,0,124,5,0,25,125,
-    8,0,80,113,156,0,121,20,0,116,0,0,106,5,0,124,
-    5,0,131,1,0,125,8,0,80,87,113,156,0,4,116,9,
-    0,107,10,0,114,28,1,1,1,1,119,156,0,89,113,156,
+    8,0,80,113,156,0,121,20,0,116,0,0,160,5,0,124,
+    5,0,161,1,0,125,8,0,80,87,113,156,0,4,116,9,
+    0,168,10,0,114,28,1,1,1,1,119,156,0,89,113,156,
     0,88,113,156,0,87,116,9,0,100,12,0,131,1,0,130,
     1,0,116,6,0,124,1,0,100,13,0,124,8,0,131,3,
     0,1,116,6,0,124,1,0,100,14,0,124,7,0,131,3,
-    0,1,116,6,0,124,1,0,100,15,0,100,16,0,106,10,
-    0,124,6,0,131,1,0,131,3,0,1,121,19,0,116,0,
-    0,106,5,0,100,17,0,131,1,0,125,9,0,87,110,24,
-    0,4,116,9,0,107,10,0,114,147,1,1,1,1,100,18,
+    0,1,116,6,0,124,1,0,100,15,0,100,16,0,160,10,
+    0,124,6,0,161,1,0,131,3,0,1,121,19,0,116,0,
+    0,160,5,0,100,17,0,161,1,0,125,9,0,87,110,24,
+    0,4,116,9,0,168,10,0,114,147,1,1,1,1,100,18,
     0,125,9,0,89,110,1,0,88,116,6,0,124,1,0,100,
-    17,0,124,9,0,131,3,0,1,116,0,0,106,5,0,100,
-    19,0,131,1,0,125,10,0,116,6,0,124,1,0,100,19,
-    0,124,10,0,131,3,0,1,124,5,0,100,7,0,107,2,
-    0,114,238,1,116,0,0,106,5,0,100,20,0,131,1,0,
+    17,0,124,9,0,131,3,0,1,116,0,0,160,5,0,100,
+    19,0,161,1,0,125,10,0,116,6,0,124,1,0,100,19,
+    0,124,10,0,131,3,0,1,124,5,0,100,7,0,168,2,
+    0,114,238,1,116,0,0,160,5,0,100,20,0,161,1,0,
     125,11,0,116,6,0,124,1,0,100,21,0,124,11,0,131,
     3,0,1,116,6,0,124,1,0,100,22,0,116,11,0,131,
-    0,0,131,3,0,1,116,12,0,106,13,0,116,2,0,106,
-    14,0,131,0,0,131,1,0,1,124,5,0,100,7,0,107,
-    2,0,114,66,2,116,15,0,106,16,0,100,23,0,131,1,
-    0,1,100,24,0,116,12,0,107,6,0,114,66,2,100,25,
+    0,0,131,3,0,1,116,12,0,160,13,0,116,2,0,160,
+    14,0,161,0,0,161,1,0,1,124,5,0,100,7,0,168,
+    2,0,114,66,2,116,15,0,160,16,0,100,23,0,161,1,
+    0,1,100,24,0,116,12,0,168,6,0,114,66,2,100,25,
     0,116,17,0,95,18,0,100,18,0,83,41,27,122,205,83,
     101,116,117,112,32,116,104,101,32,112,97,116,104,45,98,97,
     115,101,100,32,105,109,112,111,114,116,101,114,115,32,102,111,
@@ -2502,7 +2502,7 @@ const unsigned char _Py_M__importlib_external[] = {
     83,41,2,114,29,0,0,0,78,41,1,114,31,0,0,0,
     41,2,114,22,0,0,0,114,77,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,114,227,0,0,0,
-    94,5,0,0,115,2,0,0,0,6,0,122,25,95,115,101,
+    96,5,0,0,115,2,0,0,0,6,0,122,25,95,115,101,
     116,117,112,46,60,108,111,99,97,108,115,62,46,60,103,101,
     110,101,120,112,114,62,114,59,0,0,0,122,30,105,109,112,
     111,114,116,108,105,98,32,114,101,113,117,105,114,101,115,32,
@@ -2532,20 +2532,20 @@ const unsigned char _Py_M__importlib_external[] = {
     90,14,119,101,97,107,114,101,102,95,109,111,100,117,108,101,
     90,13,119,105,110,114,101,103,95,109,111,100,117,108,101,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,6,
-    95,115,101,116,117,112,69,5,0,0,115,82,0,0,0,0,
+    95,115,101,116,117,112,71,5,0,0,115,82,0,0,0,0,
     8,6,1,9,1,9,3,13,1,13,1,15,1,18,2,13,
     1,20,3,33,1,19,2,31,1,10,1,15,1,13,1,4,
     2,3,1,15,1,5,1,13,1,12,2,12,1,16,1,16,
     1,25,3,3,1,19,1,13,2,11,1,16,3,15,1,16,
     3,12,1,15,1,16,3,19,1,19,1,12,1,13,1,12,
     1,114,33,1,0,0,99,1,0,0,0,0,0,0,0,2,
-    0,0,0,3,0,0,0,67,0,0,0,115,116,0,0,0,
+    0,0,0,4,0,0,0,67,0,0,0,115,116,0,0,0,
     116,0,0,124,0,0,131,1,0,1,116,1,0,131,0,0,
-    125,1,0,116,2,0,106,3,0,106,4,0,116,5,0,106,
-    6,0,124,1,0,140,0,0,103,1,0,131,1,0,1,116,
-    7,0,106,8,0,100,1,0,107,2,0,114,78,0,116,2,
-    0,106,9,0,106,10,0,116,11,0,131,1,0,1,116,2,
-    0,106,9,0,106,10,0,116,12,0,131,1,0,1,116,5,
+    125,1,0,116,2,0,106,3,0,160,4,0,116,5,0,106,
+    6,0,124,1,0,140,0,0,103,1,0,161,1,0,1,116,
+    7,0,106,8,0,100,1,0,168,2,0,114,78,0,116,2,
+    0,106,9,0,160,10,0,116,11,0,161,1,0,1,116,2,
+    0,106,9,0,160,10,0,116,12,0,161,1,0,1,116,5,
     0,124,0,0,95,5,0,116,13,0,124,0,0,95,13,0,
     100,2,0,83,41,3,122,41,73,110,115,116,97,108,108,32,
     116,104,101,32,112,97,116,104,45,98,97,115,101,100,32,105,
@@ -2558,7 +2558,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,218,0,0,0,41,2,114,32,1,0,0,90,17,115,117,
     112,112,111,114,116,101,100,95,108,111,97,100,101,114,115,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,8,
-    95,105,110,115,116,97,108,108,137,5,0,0,115,16,0,0,
+    95,105,110,115,116,97,108,108,139,5,0,0,115,16,0,0,
     0,0,2,10,1,9,1,28,1,15,1,16,1,16,4,9,
     1,114,35,1,0,0,41,3,122,3,119,105,110,114,1,0,
     0,0,114,2,0,0,0,41,57,114,114,0,0,0,114,10,
@@ -2587,7 +2587,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,114,4,0,0,0,114,5,0,0,0,218,8,60,
     109,111,100,117,108,101,62,8,0,0,0,115,100,0,0,0,
     6,17,6,3,12,12,12,5,12,5,12,6,12,12,12,10,
-    12,9,12,5,12,7,15,22,15,113,22,1,18,2,6,1,
+    12,9,12,5,12,7,15,22,15,115,22,1,18,2,6,1,
     6,2,9,2,9,2,10,2,21,44,12,33,12,19,12,12,
     12,12,18,8,12,28,12,17,21,55,21,12,18,10,12,14,
     9,3,12,1,15,65,19,64,19,28,22,110,19,41,25,43,
@@ -4,7 +4,10 @@
    even though dicts, lists, sets and frozensets, not commonly seen in
    code objects, are supported.
    Version 3 of this protocol properly supports circular links
-   and sharing. */
+   and sharing.  Version 5 adds dense records for lists and tuples
+   of ints or floats (TYPE_INT_ARRAY, TYPE_FLOAT_ARRAY), which only
+   bitpacked builds write; Py_MARSHAL_VERSION stays 4, so .pyc files
+   remain readable by every build. */
 
 #define PY_SSIZE_T_CLEAN
 
@@ -55,6 +58,9 @@
 #define TYPE_SMALL_TUPLE        ')'
 #define TYPE_SHORT_ASCII        'z'
 #define TYPE_SHORT_ASCII_INTERNED 'Z'
+/* version 5 */
+#define TYPE_INT_ARRAY          'q'
+#define TYPE_FLOAT_ARRAY        'd'
 
 #define WFERR_OK 0
 #define WFERR_UNMARSHALLABLE 1
@@ -207,13 +213,37 @@ w_short_pstring(const char *s, Py_ssize_t n, WFILE *p)
     w_byte((t) | flag, (p)); \
 } while(0)
 
+#ifdef BITPACKED
+/* Bitpacked ints wider than TYPE_INT are written as TYPE_LONG directly
+   from their value, without boxing them first. */
+static void
+w_bitpacked_PyLong(long x, char flag, WFILE *p)
+{
+    unsigned long ux, t;
+    long l = 0;
+
+    ux = x < 0 ? 0UL - (unsigned long)x : (unsigned long)x;
+    W_TYPE(TYPE_LONG, p);
+    for (t = ux; t != 0; t >>= PyLong_MARSHAL_SHIFT)
+        l++;
+    w_long(x < 0 ? -l : l, p);
+    for (t = ux; t != 0; t >>= PyLong_MARSHAL_SHIFT)
+        w_short((int)(t & PyLong_MARSHAL_MASK), p);
+}
+#endif
+
 static void
 w_PyLong(const PyLongObject *ob, char flag, WFILE *p)
 {
     Py_ssize_t i, j, n, l;
     digit d;
 
-    assert(!BITPACKED_CHECK(ob));
+#ifdef BITPACKED
+    if (BITPACKED_LONG_CHECK(ob)) {
+        w_bitpacked_PyLong(BITPACKED_LONG_VALUE(ob), flag, p);
+        return;
+    }
+#endif
 
     W_TYPE(TYPE_LONG, p);
     if (Py_SIZE(ob) == 0) {
@@ -252,6 +282,103 @@ w_PyLong(const PyLongObject *ob, char flag, WFILE *p)
     } while (d != 0);
 }
 
+#ifdef BITPACKED
+/* Lists and tuples of at least this many tagged ints, or tagged floats,
+   are written as TYPE_INT_ARRAY or TYPE_FLOAT_ARRAY from version 5 on.
+   TYPE_INT_ARRAY stores each int in the fewest bytes (1, 2, 4 or 8) that
+   hold them all:
+
+       'q' | flag, '(' or '[', width, size (4 bytes), size * width bytes
+
+   An int array is only written when it is shorter than the items written
+   one by one.  TYPE_FLOAT_ARRAY stores each float as in TYPE_BINARY_FLOAT:
+
+       'd' | flag, '(' or '[', size (4 bytes), size * 8 bytes
+*/
+#define BITPACKED_MARSHAL_VERSION 5
+#define BITPACKED_MARSHAL_ARRAY_MIN 4
+
+/* Write v, an exact list or tuple, as an array record if its items allow.
+   Return 1 if it was written, 0 if the caller has to write it. */
+static int
+w_bitpacked_array(PyObject *v, char flag, WFILE *p)
+{
+    Py_ssize_t i, k, n = PySequence_Fast_GET_SIZE(v);
+    PyObject **items = PySequence_Fast_ITEMS(v);
+    unsigned char buf[512];
+    int width;
+
+    if (n < BITPACKED_MARSHAL_ARRAY_MIN || n > SIZE32_MAX)
+        return 0;
+    if (BITPACKED_LONG_CHECKEXACT(items[0])) {
+        long lo = 0, hi = 0;
+        Py_ssize_t itemsize = 0;    /* as TYPE_INT and TYPE_LONG records */
+        for (i = 0; i < n; i++) {
+            long x, y;
+            if (!BITPACKED_LONG_CHECKEXACT(items[i]))
+                return 0;
+            x = BITPACKED_LONG_VALUE(items[i]);
+            lo = x < lo ? x : lo;
+            hi = x > hi ? x : hi;
+            itemsize += 5;
+            y = Py_ARITHMETIC_RIGHT_SHIFT(long, x, 31);
+            if (y && y != -1) {
+                unsigned long ux = x < 0 ? 0UL - (unsigned long)x
+                                         : (unsigned long)x;
+                for (; ux != 0; ux >>= PyLong_MARSHAL_SHIFT)
+                    itemsize += 2;
+            }
+        }
+        for (width = 1; width < 8; width *= 2) {
+            long lim = 1L << (8 * width - 1);
+            if (-lim <= lo && hi < lim)
+                break;
+        }
+        if (7 + n * width >= itemsize + 2)
+            return 0;
+        W_TYPE(TYPE_INT_ARRAY, p);
+        w_byte(PyTuple_CheckExact(v) ? TYPE_TUPLE : TYPE_LIST, p);
+        w_byte(width, p);
+        w_long((long)n, p);
+        for (i = 0, k = 0; i < n; i++) {
+            unsigned long x = (unsigned long)BITPACKED_LONG_VALUE(items[i]);
+            int j;
+            for (j = 0; j < width; j++, x >>= 8)
+                buf[k++] = (unsigned char)(x & 0xff);
+            if (k > (Py_ssize_t)sizeof(buf) - 8) {
+                w_string((char *)buf, k, p);
+                k = 0;
+            }
+        }
+        w_string((char *)buf, k, p);
+        return 1;
+    }
+    if (BITPACKED_FLOAT_CHECK(items[0])) {
+        for (i = 1; i < n; i++)
+            if (!BITPACKED_FLOAT_CHECK(items[i]))
+                return 0;
+        W_TYPE(TYPE_FLOAT_ARRAY, p);
+        w_byte(PyTuple_CheckExact(v) ? TYPE_TUPLE : TYPE_LIST, p);
+        w_long((long)n, p);
+        for (i = 0, k = 0; i < n; i++) {
+            if (_PyFloat_Pack8(_PyBitpacked_FloatValue(items[i]),
+                               buf + k, 1) < 0) {
+                p->error = WFERR_UNMARSHALLABLE;
+                return 1;
+            }
+            k += 8;
+            if (k > (Py_ssize_t)sizeof(buf) - 8) {
+                w_string((char *)buf, k, p);
+                k = 0;
+            }
+        }
+        w_string((char *)buf, k, p);
+        return 1;
+    }
+    return 0;
+}
+#endif
+
 static int
 w_ref(PyObject *v, char *flag, WFILE *p)
 {
@@ -326,6 +453,13 @@ w_object(PyObject *v, WFILE *p)
     else if (v == Py_True) {
         w_byte(TYPE_TRUE, p);
     }
+#ifdef BITPACKED
+    else if (BITPACKED_CHECK(v)) {
+        /* tagged values are not shared objects; writing them again costs
+           no more than a TYPE_REF, and saves the hash table */
+        w_complex_object(v, flag, p);
+    }
+#endif
     else if (!w_ref(v, &flag, p))
         w_complex_object(v, flag, p);
 
@@ -466,6 +600,13 @@ w_complex_object(PyObject *v, char flag, WFILE *p)
             Py_DECREF(utf8);
         }
     }
+#ifdef BITPACKED
+    else if (p->version >= BITPACKED_MARSHAL_VERSION &&
+             (PyTuple_CheckExact(v) || PyList_CheckExact(v)) &&
+             w_bitpacked_array(v, flag, p)) {
+        /* written as TYPE_INT_ARRAY or TYPE_FLOAT_ARRAY */
+    }
+#endif
     else if (PyTuple_CheckExact(v)) {
         n = PyTuple_Size(v);
         if (p->version >= 4 && n < 256) {
@@ -786,7 +927,7 @@ r_PyLong(RFILE *p)
     if (PyErr_Occurred())
         return NULL;
     if (n == 0)
-        return (PyObject *)_PyLong_New(0);
+        return PyLong_FromLong(0);
     if (n < -SIZE32_MAX || n > SIZE32_MAX) {
         PyErr_SetString(PyExc_ValueError,
                        "bad marshal data (long size out of range)");
@@ -841,6 +982,16 @@ r_PyLong(RFILE *p)
     /* top digit should be nonzero, else the resulting PyLong won't be
        normalized */
     ob->ob_digit[size-1] = d;
+#ifdef BITPACKED
+    if (size <= 2) {
+        /* may fit in a bitpacked int */
+        long x = PyLong_AsLong((PyObject *)ob);
+        if (BITPACKED_LONG_RANGE_CHECK(x)) {
+            Py_DECREF(ob);
+            return PyLong_FromLong(x);
+        }
+    }
+#endif
     return (PyObject *)ob;
   bad_digit:
     Py_DECREF(ob);
@@ -903,6 +1054,78 @@ r_ref(PyObject *o, int flag, RFILE *p)
     return o;
 }
 
+/* Read the rest of a TYPE_INT_ARRAY or TYPE_FLOAT_ARRAY record: a new
+   list or tuple, which is entered into the reflist if flag is set. */
+static PyObject *
+r_array(int type, int flag, RFILE *p)
+{
+    PyObject *v, *item;
+    unsigned char *buf;
+    Py_ssize_t i;
+    long n;
+    int container, width = 8;
+
+    container = r_byte(p);
+    if (type == TYPE_INT_ARRAY)
+        width = r_byte(p);
+    n = r_long(p);
+    if (PyErr_Occurred())
+        return NULL;
+    if (container != TYPE_TUPLE && container != TYPE_LIST) {
+        PyErr_SetString(PyExc_ValueError,
+                        "bad marshal data (unknown array container)");
+        return NULL;
+    }
+    if (width != 1 && width != 2 && width != 4 && width != 8) {
+        PyErr_SetString(PyExc_ValueError,
+                        "bad marshal data (int array width out of range)");
+        return NULL;
+    }
+    if (n < 0 || n > SIZE32_MAX || n > PY_SSIZE_T_MAX / width) {
+        PyErr_SetString(PyExc_ValueError,
+                        "bad marshal data (array size out of range)");
+        return NULL;
+    }
+    v = container == TYPE_TUPLE ? PyTuple_New(n) : PyList_New(n);
+    if (v == NULL)
+        return NULL;
+    if (flag) {
+        v = r_ref(v, flag, p);
+        if (v == NULL)
+            return NULL;
+    }
+    buf = (unsigned char *) r_string(n * width, p);
+    if (buf == NULL)
+        goto error;
+    for (i = 0; i < n; i++, buf += width) {
+        if (type == TYPE_INT_ARRAY) {
+            unsigned PY_LONG_LONG x = 0;
+            int j;
+            for (j = width - 1; j >= 0; j--)
+                x = (x << 8) | buf[j];
+            if (width < 8 && (x >> (8 * width - 1)))
+                x |= ~(unsigned PY_LONG_LONG)0 << (8 * width);
+            item = PyLong_FromLongLong((PY_LONG_LONG)x);
+        }
+        else {
+            double d = _PyFloat_Unpack8(buf, 1);
+            if (d == -1.0 && PyErr_Occurred())
+                goto error;
+            item = PyFloat_FromDouble(d);
+        }
+        if (item == NULL)
+            goto error;
+        if (container == TYPE_TUPLE)
+            PyTuple_SET_ITEM(v, i, item);
+        else
+            PyList_SET_ITEM(v, i, item);
+    }
+    return v;
+  error:
+    Py_DECREF(v);
+    return NULL;
+}
+
 static PyObject *
 r_object(RFILE *p)
 {
@@ -1200,6 +1423,11 @@ r_object(RFILE *p)
         retval = v;
         break;
 
+    case TYPE_INT_ARRAY:
+    case TYPE_FLOAT_ARRAY:
+        retval = r_array(type, flag, p);
+        break;
+
     case TYPE_LIST:
         n = r_long(p);
         if (PyErr_Occurred())
@@ -29,7 +29,7 @@ static void *opcode_targets[256] = {
     &&TARGET_BINARY_TRUE_DIVIDE,
     &&TARGET_INPLACE_FLOOR_DIVIDE,
     &&TARGET_INPLACE_TRUE_DIVIDE,
-    &&_unknown_opcode,
+    &&TARGET_BINARY_ADD_TAGGED_INT,
     &&_unknown_opcode,
     &&_unknown_opcode,
     &&_unknown_opcode,
@@ -159,15 +159,15 @@ static void *opcode_targets[256] = {
     &&_unknown_opcode,
     &&_unknown_opcode,
     &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
+    &&TARGET_LOAD_METHOD,
+    &&TARGET_CALL_METHOD,
+    &&TARGET_LOAD_ATTR_INSTANCE_DICT,
+    &&TARGET_LOAD_GLOBAL_CACHED,
+    &&TARGET_COMPARE_OP_FLOAT,
+    &&TARGET_LOAD_FAST__LOAD_FAST,
+    &&TARGET_LOAD_FAST__LOAD_ATTR,
+    &&TARGET_STORE_FAST__LOAD_FAST,
+    &&TARGET_COMPARE_OP__POP_JUMP_IF_FALSE,
     &&_unknown_opcode,
     &&_unknown_opcode,
     &&_unknown_opcode,
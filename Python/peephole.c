@@ -333,6 +333,55 @@ markblocks(unsigned char *code, Py_ssize_t len)
     return blocks;
 }
 
+/* Replaces the first instruction of each pair below with the
+   superinstruction that does the work of both, which saves a dispatch.
+   The second instruction stays where it was, so no address changes and
+   jumps to it still work, and it runs on its own while tracing (see
+   SECOND_INSTRUCTION() in ceval.c).  COMPARE_OP__POP_JUMP_IF_FALSE is
+   only fused on one line, since it has no such fallback.  The pairs are
+   among the most frequent in loops; Tools/scripts/dxpairs.py lists
+   them. */
+static void
+fuse_superinstructions(unsigned char *codestr, Py_ssize_t codelen,
+                       unsigned char *lineno, Py_ssize_t tabsiz)
+{
+    Py_ssize_t i, next, tab = 0;
+    Py_ssize_t line_start = tabsiz > 0 ? lineno[0] : codelen;
+    int super;
+
+    for (i=0 ; i<codelen ; i=next) {
+        next = i + CODESIZE(codestr[i]);
+        if (next >= codelen)
+            break;
+        while (line_start < next) {
+            tab += 2;
+            line_start = tab < tabsiz ? line_start + lineno[tab] : codelen;
+        }
+        super = 0;
+        switch (codestr[i]) {
+            case LOAD_FAST:
+                if (codestr[next] == LOAD_FAST)
+                    super = LOAD_FAST__LOAD_FAST;
+                else if (codestr[next] == LOAD_ATTR)
+                    super = LOAD_FAST__LOAD_ATTR;
+                break;
+            case STORE_FAST:
+                if (codestr[next] == LOAD_FAST)
+                    super = STORE_FAST__LOAD_FAST;
+                break;
+            case COMPARE_OP:
+                if (codestr[next] == POP_JUMP_IF_FALSE && line_start != next)
+                    super = COMPARE_OP__POP_JUMP_IF_FALSE;
+                break;
+        }
+        if (super) {
+            codestr[i] = super;
+            /* The second instruction is not fused with the one after it */
+            next += CODESIZE(codestr[next]);
+        }
+    }
+}
+
 /* Perform basic peephole optimizations to components of a code object.
    The consts object should still be in list form to allow new constants
    to be appended.
@@ -348,7 +397,8 @@ markblocks(unsigned char *code, Py_ssize_t len)
    single basic block.  All transformations keep the code size the same or
    smaller.  For those that reduce size, the gaps are initially filled with
    NOPs.  Later those NOPs are removed and the jump addresses retargeted in
-   a single pass.  Line numbering is adjusted accordingly. */
+   a single pass.  Line numbering is adjusted accordingly.  Superinstructions
+   are fused last. */
 
 PyObject *
 PyCode_Optimize(PyObject *code, PyObject* consts, PyObject *names,
@@ -717,6 +767,8 @@ PyCode_Optimize(PyObject *code, PyObject* consts, PyObject *names,
     }
     assert(h + nops == codelen);
 
+    fuse_superinstructions(codestr, h, lineno, tabsiz);
+
     code = PyBytes_FromStringAndSize((char *)codestr, h);
     CONST_STACK_DELETE();
     PyMem_Free(addrmap);
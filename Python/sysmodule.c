@@ -1059,6 +1059,36 @@ sys_getcounts(PyObject *self)
 }
 #endif
 
+#ifdef BITPACKED_STATS
+PyDoc_STRVAR(bitpacked_stats_doc,
+"bitpacked_stats() -> dict\n\
+\n\
+Return the bitpacked counters: 'tagged' maps type ids to the number of\n\
+tagged values made, 'fallback' maps reasons to the number of heap objects\n\
+made instead, and 'rebox' maps call sites to the number of tagged ints\n\
+converted to heap ints there."
+);
+
+static PyObject *
+sys_bitpacked_stats(PyObject *self)
+{
+    return _PyBitpacked_GetStats();
+}
+
+PyDoc_STRVAR(bitpacked_stats_reset_doc,
+"bitpacked_stats_reset()\n\
+\n\
+Reset all counters returned by bitpacked_stats() to zero."
+);
+
+static PyObject *
+sys_bitpacked_stats_reset(PyObject *self)
+{
+    _PyBitpacked_ResetStats();
+    Py_RETURN_NONE;
+}
+#endif
+
 PyDoc_STRVAR(getframe_doc,
 "_getframe([depth]) -> frameobject\n\
 \n\
@@ -1071,6 +1101,17 @@ This function should be used for internal and specialized\n\
 purposes only."
 );
 
+PyDoc_STRVAR(getquickenstats_doc,
+"_getquickenstats() -> dict\n\
+\n\
+Return how often each specialized opcode of quickened code was executed\n\
+as a dict mapping opcode names to (hits, misses) tuples.  A miss rewrites\n\
+the instruction back to its generic form.\n\
+\n\
+This function should be used for internal and specialized\n\
+purposes only."
+);
+
 static PyObject *
 sys_getframe(PyObject *self, PyObject *args)
 {
@@ -1183,6 +1224,9 @@ extern PyObject *_Py_GetObjects(PyObject *, PyObject *);
 extern PyObject *_Py_GetDXProfile(PyObject *,  PyObject *);
 #endif
 
+/* Defined in ceval.c because it uses static globals of that file */
+extern PyObject *_PyEval_GetQuickenStats(PyObject *, PyObject *);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1211,6 +1255,12 @@ Return True if Python is exiting.");
 
 static PyMethodDef sys_methods[] = {
     /* Might as well keep this in alphabetic order */
+#ifdef BITPACKED_STATS
+    {"bitpacked_stats", (PyCFunction)sys_bitpacked_stats, METH_NOARGS,
+     bitpacked_stats_doc},
+    {"bitpacked_stats_reset", (PyCFunction)sys_bitpacked_stats_reset,
+     METH_NOARGS, bitpacked_stats_reset_doc},
+#endif
     {"callstats", (PyCFunction)PyEval_GetCallStats, METH_NOARGS,
      callstats_doc},
     {"_clear_type_cache",       sys_clear_type_cache,     METH_NOARGS,
@@ -1249,6 +1299,8 @@ static PyMethodDef sys_methods[] = {
     {"getsizeof",   (PyCFunction)sys_getsizeof,
      METH_VARARGS | METH_KEYWORDS, getsizeof_doc},
     {"_getframe", sys_getframe, METH_VARARGS, getframe_doc},
+    {"_getquickenstats", _PyEval_GetQuickenStats, METH_NOARGS,
+     getquickenstats_doc},
 #ifdef MS_WINDOWS
     {"getwindowsversion", (PyCFunction)sys_getwindowsversion, METH_NOARGS,
      getwindowsversion_doc},
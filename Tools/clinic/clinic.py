@@ -710,6 +710,11 @@ class CLanguage(Language):
             {c_basename}({self_type}{self_name}, PyObject *args)
             """)
 
+        parser_prototype_fastcall = normalize_snippet("""
+            static PyObject *
+            {c_basename}({self_type}{self_name}, PyObject **args, Py_ssize_t nargs)
+            """)
+
         # parser_body_fields remembers the fields passed in to the
         # previous call to parser_body. this is used for an awful hack.
         parser_body_fields = ()
@@ -811,7 +816,7 @@ class CLanguage(Language):
 
             parser_definition = parser_body(parser_prototype, '    {option_group_parsing}')
 
-        elif positional and all_boring_objects:
+        elif positional and all_boring_objects and new_or_init:
             # positional-only, but no option groups,
             # and nothing but normal objects:
             # PyArg_UnpackTuple!
@@ -826,7 +831,22 @@ class CLanguage(Language):
                     goto exit;
                 """, indent=4))
 
-        elif positional:
+        elif positional and all_boring_objects:
+            # the same for a function or method, which gets its
+            # arguments from the caller's stack without a tuple:
+            # _PyArg_UnpackStack!
+
+            flags = "METH_FASTCALL"
+            parser_prototype = parser_prototype_fastcall
+
+            parser_definition = parser_body(parser_prototype, normalize_snippet("""
+                if (!_PyArg_UnpackStack(args, nargs, "{name}",
+                    {unpack_min}, {unpack_max},
+                    {parse_arguments}))
+                    goto exit;
+                """, indent=4))
+
+        elif positional and new_or_init:
             # positional-only, but no option groups
             # we only need one call to PyArg_ParseTuple
 
@@ -839,6 +859,18 @@ class CLanguage(Language):
                     goto exit;
                 """, indent=4))
 
+        elif positional:
+            # the same for a function or method: _PyArg_ParseStack
+
+            flags = "METH_FASTCALL"
+            parser_prototype = parser_prototype_fastcall
+
+            parser_definition = parser_body(parser_prototype, normalize_snippet("""
+                if (!_PyArg_ParseStack(args, nargs, "{format_units}:{name}",
+                    {parse_arguments}))
+                    goto exit;
+                """, indent=4))
+
         else:
             # positional-or-keyword arguments
             flags = "METH_VARARGS|METH_KEYWORDS"
@@ -0,0 +1,75 @@
+# Time of functions that spend their loops loading module globals and
+# builtins, the case the LOAD_GLOBAL cache is for, and of one that rebinds
+# a global on every iteration, which defeats it.
+# Run the same script under builds with and without the cache to compare.
+
+import sys
+import time
+from optparse import OptionParser
+
+SCALE = 3
+OFFSET = 7
+TABLE = {i: i * i for i in range(64)}
+
+def helper(x):
+    return x * SCALE + OFFSET
+
+def constants(n):
+    total = 0
+    for i in range(n):
+        total += SCALE * i + OFFSET - SCALE
+    return total
+
+def helpers(n):
+    total = 0
+    for i in range(n):
+        total += helper(i) + helper(OFFSET)
+    return total
+
+def builtins(n):
+    total = 0
+    for i in range(n):
+        total += len(TABLE) + abs(-i) + min(i, OFFSET)
+    return total
+
+counter = 0
+
+def rebinding(n):
+    global counter
+    for i in range(n):
+        counter = counter + SCALE + OFFSET
+    return counter
+
+def workloads():
+    return [
+        ('constants', constants),
+        ('helpers', helpers),
+        ('builtins', builtins),
+        ('rebinding', rebinding),
+    ]
+
+def best_of(repeat, func, *args):
+    best = None
+    for _ in range(repeat):
+        t = time.perf_counter()
+        func(*args)
+        t = time.perf_counter() - t
+        best = t if best is None else min(best, t)
+    return best
+
+def main():
+    parser = OptionParser(usage="usage: %prog [options]")
+    parser.add_option("-r", "--repeat", type="int", default=5,
+                      help="number of runs; the best one is reported "
+                           "(default: %default)")
+    parser.add_option("-n", "--loops", type="int", default=1000000,
+                      help="iterations per run (default: %default)")
+    options, args = parser.parse_args()
+    print(sys.version)
+    print("%-12s %10s" % ("workload", "ms"))
+    for name, func in workloads():
+        t = best_of(options.repeat, func, options.loops)
+        print("%-12s %10.2f" % (name, t * 1e3))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,75 @@
+# Throughput of marshal.dumps() and marshal.loads() for code objects (as in
+# .pyc files) and for the lists of numbers seen in marshal-based IPC.
+# Run the same script under a stock and a --with-bitpacked build to compare;
+# marshal version 5 only changes the output of bitpacked builds.
+
+import marshal
+import os
+import random
+import sys
+import time
+from optparse import OptionParser
+
+
+def code_objects():
+    # compiled modules of the standard library, like a cold import would load
+    libdir = os.path.dirname(os.__file__)
+    codes = []
+    for name in sorted(os.listdir(libdir)):
+        if name.endswith('.py'):
+            path = os.path.join(libdir, name)
+            with open(path, 'rb') as f:
+                source = f.read()
+            try:
+                codes.append(compile(source, path, 'exec'))
+            except SyntaxError:
+                pass
+    return codes
+
+def workloads():
+    rnd = random.Random(5)
+    return [
+        ('code', code_objects()),
+        ('small ints', [list(range(i, i + 100)) for i in range(1000)]),
+        ('ids', [[rnd.randrange(2**40) for i in range(100)]
+                 for j in range(1000)]),
+        ('floats', [[rnd.random() * 1e3 for i in range(100)]
+                    for j in range(1000)]),
+        ('records', [(i, 'name%d' % i, i * 0.5, None, True)
+                     for i in range(20000)]),
+    ]
+
+def best_of(repeat, func, *args):
+    best = None
+    for _ in range(repeat):
+        t = time.perf_counter()
+        func(*args)
+        t = time.perf_counter() - t
+        best = t if best is None else min(best, t)
+    return best
+
+def main():
+    parser = OptionParser(usage="usage: %prog [options]")
+    parser.add_option("-r", "--repeat", type="int", default=5,
+                      help="number of runs; the best one is reported "
+                           "(default: %default)")
+    parser.add_option("-v", "--versions", default="4,5",
+                      help="comma separated marshal versions "
+                           "(default: %default)")
+    options, args = parser.parse_args()
+    versions = [int(v) for v in options.versions.split(',')]
+    print(sys.version)
+    print("%-12s %3s %10s %10s %10s" %
+          ("workload", "ver", "bytes", "dumps ms", "loads ms"))
+    for name, data in workloads():
+        for version in versions:
+            dumped = marshal.dumps(data, version)
+            assert marshal.loads(dumped) == data
+            size = len(dumped)
+            tdump = best_of(options.repeat, marshal.dumps, data, version)
+            tload = best_of(options.repeat, marshal.loads, dumped)
+            print("%-12s %3d %10d %10.2f %10.2f" %
+                  (name, version, size, tdump * 1e3, tload * 1e3))
+
+if __name__ == "__main__":
+    main()
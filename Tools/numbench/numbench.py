@@ -0,0 +1,154 @@
+# Floating point benchmarks for the eval loop's number fast paths:
+# nbody and spectral-norm, as in the generic benchmark suite.
+# Run the same script under a stock and a --with-bitpacked build to compare.
+
+import sys
+import time
+from optparse import OptionParser
+
+
+# nbody: planets orbiting the sun, advanced with a symplectic integrator
+
+PI = 3.14159265358979323
+SOLAR_MASS = 4 * PI * PI
+DAYS_PER_YEAR = 365.24
+
+def make_bodies():
+    # [position], [velocity], mass
+    return [
+        # sun
+        ([0.0, 0.0, 0.0], [0.0, 0.0, 0.0], SOLAR_MASS),
+        # jupiter
+        ([4.84143144246472090e+00, -1.16032004402742839e+00,
+          -1.03622044471123109e-01],
+         [1.66007664274403694e-03 * DAYS_PER_YEAR,
+          7.69901118419740425e-03 * DAYS_PER_YEAR,
+          -6.90460016972063023e-05 * DAYS_PER_YEAR],
+         9.54791938424326609e-04 * SOLAR_MASS),
+        # saturn
+        ([8.34336671824457987e+00, 4.12479856412430479e+00,
+          -4.03523417114321381e-01],
+         [-2.76742510726862411e-03 * DAYS_PER_YEAR,
+          4.99852801234917238e-03 * DAYS_PER_YEAR,
+          2.30417297573763929e-05 * DAYS_PER_YEAR],
+         2.85885980666130812e-04 * SOLAR_MASS),
+        # uranus
+        ([1.28943695621391310e+01, -1.51111514016986312e+01,
+          -2.23307578892655734e-01],
+         [2.96460137564761618e-03 * DAYS_PER_YEAR,
+          2.37847173959480950e-03 * DAYS_PER_YEAR,
+          -2.96589568540237556e-05 * DAYS_PER_YEAR],
+         4.36624404335156298e-05 * SOLAR_MASS),
+        # neptune
+        ([1.53796971148509165e+01, -2.59193146099879641e+01,
+          1.79258772950371181e-01],
+         [2.68067772490389322e-03 * DAYS_PER_YEAR,
+          1.62824170038242295e-03 * DAYS_PER_YEAR,
+          -9.51592254519715870e-05 * DAYS_PER_YEAR],
+         5.15138902046611451e-05 * SOLAR_MASS),
+    ]
+
+def offset_momentum(bodies):
+    px = py = pz = 0.0
+    for (r, v, m) in bodies:
+        px -= v[0] * m
+        py -= v[1] * m
+        pz -= v[2] * m
+    v = bodies[0][1]
+    v[0] = px / SOLAR_MASS
+    v[1] = py / SOLAR_MASS
+    v[2] = pz / SOLAR_MASS
+
+def energy(bodies):
+    e = 0.0
+    for i, (r1, v1, m1) in enumerate(bodies):
+        e += m1 * (v1[0] * v1[0] + v1[1] * v1[1] + v1[2] * v1[2]) / 2
+        for (r2, v2, m2) in bodies[i+1:]:
+            dx = r1[0] - r2[0]
+            dy = r1[1] - r2[1]
+            dz = r1[2] - r2[2]
+            e -= (m1 * m2) / ((dx * dx + dy * dy + dz * dz) ** 0.5)
+    return e
+
+def nbody(steps, dt=0.01):
+    bodies = make_bodies()
+    offset_momentum(bodies)
+    pairs = [(bodies[i], bodies[j])
+             for i in range(len(bodies)) for j in range(i + 1, len(bodies))]
+    for _ in range(steps):
+        for (([x1, y1, z1], v1, m1), ([x2, y2, z2], v2, m2)) in pairs:
+            dx = x1 - x2
+            dy = y1 - y2
+            dz = z1 - z2
+            mag = dt * ((dx * dx + dy * dy + dz * dz) ** -1.5)
+            b1m = m1 * mag
+            b2m = m2 * mag
+            v1[0] -= dx * b2m
+            v1[1] -= dy * b2m
+            v1[2] -= dz * b2m
+            v2[0] += dx * b1m
+            v2[1] += dy * b1m
+            v2[2] += dz * b1m
+        for (r, [vx, vy, vz], m) in bodies:
+            r[0] += dt * vx
+            r[1] += dt * vy
+            r[2] += dt * vz
+    return energy(bodies)
+
+
+# spectral-norm: power iteration on an infinite matrix with
+# A[i, j] = 1 / ((i + j) * (i + j + 1) / 2 + i + 1)
+
+def eval_A(i, j):
+    return 1.0 / ((i + j) * (i + j + 1) // 2 + i + 1)
+
+def eval_A_times_u(u):
+    n = len(u)
+    return [sum([eval_A(i, j) * u[j] for j in range(n)]) for i in range(n)]
+
+def eval_At_times_u(u):
+    n = len(u)
+    return [sum([eval_A(j, i) * u[j] for j in range(n)]) for i in range(n)]
+
+def spectral_norm(n):
+    u = [1.0] * n
+    for _ in range(10):
+        v = eval_At_times_u(eval_A_times_u(u))
+        u = eval_At_times_u(eval_A_times_u(v))
+    vBv = vv = 0.0
+    for ue, ve in zip(u, v):
+        vBv += ue * ve
+        vv += ve * ve
+    return (vBv / vv) ** 0.5
+
+
+BENCHMARKS = [
+    ('nbody', nbody, 20000, -0.169089263),
+    ('spectral_norm', spectral_norm, 100, 1.274219991),
+]
+
+def main():
+    parser = OptionParser(usage="usage: %prog [options] [benchmark ...]")
+    parser.add_option("-r", "--repeat", type="int", default=5,
+                      help="number of runs; the best one is reported "
+                           "(default: %default)")
+    parser.add_option("-s", "--scale", type="float", default=1.0,
+                      help="scale the problem sizes (default: %default)")
+    options, args = parser.parse_args()
+    print(sys.version)
+    for name, func, size, expected in BENCHMARKS:
+        if args and name not in args:
+            continue
+        size = max(1, int(size * options.scale))
+        best = None
+        for _ in range(options.repeat):
+            t = time.perf_counter()
+            result = func(size)
+            t = time.perf_counter() - t
+            best = t if best is None else min(best, t)
+        if options.scale == 1.0 and round(result, 9) != expected:
+            raise SystemExit("%s: unexpected result %r" % (name, result))
+        print("%-16s %8.3f s" % (name, best))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""
+Runs a script and prints the opcode pairs that the evaluation loop
+dispatched most often while it ran, which are the candidates for
+superinstructions.  This needs a Python built with
+-DDYNAMIC_EXECUTION_PROFILE and -DDXPAIRS; for instance:
+
+$ ../configure CPPFLAGS="-DDYNAMIC_EXECUTION_PROFILE -DDXPAIRS" && make
+$ ./python ../Tools/scripts/dxpairs.py -n 10 ../Tools/numbench/numbench.py
+
+Each line gives the count of a pair, its share of all dispatches and, if
+the peephole optimizer already fuses the pair, the superinstruction for
+it (see fuse_superinstructions() in Python/peephole.c).  Such pairs only
+show up where the optimizer could not fuse them, for instance when the
+instruction before them was fused with their first one.
+"""
+
+import opcode
+import os
+import runpy
+import sys
+from optparse import OptionParser
+
+try:
+    import analyze_dxp
+except RuntimeError as e:
+    sys.exit(e)
+
+
+def superinstruction(first, second):
+    """Returns the name of the superinstruction for a pair, or None."""
+    name = '%s__%s' % (first, second)
+    return name if name in opcode.opmap else None
+
+
+def render_pairs(profile, count):
+    total = sum(n for _, _, n in analyze_dxp.common_instructions(profile))
+    lines = ["%d instructions dispatched" % total,
+             "%12s %6s  %s" % ("count", "share", "pair")]
+    for _, (first, second), n in analyze_dxp.common_pairs(profile)[:count]:
+        line = "%12d %5.1f%%  %s %s" % (n, 100.0 * n / total, first, second)
+        fused = superinstruction(first, second)
+        if fused is not None:
+            line += "  (%s)" % fused
+        lines.append(line)
+    return '\n'.join(lines)
+
+
+def main():
+    parser = OptionParser(usage="usage: %prog [options] script [args ...]")
+    parser.disable_interspersed_args()
+    parser.add_option("-n", "--pairs", type="int", default=20,
+                      help="number of pairs to print (default: %default)")
+    options, args = parser.parse_args()
+    if not args:
+        parser.error("no script given")
+    if not analyze_dxp.has_pairs(sys.getdxp()):
+        sys.exit("Python was built without -DDXPAIRS")
+
+    sys.argv = args
+    sys.path[0] = os.path.dirname(os.path.abspath(args[0]))
+    analyze_dxp.reset_profile()
+    runpy.run_path(args[0], run_name='__main__')
+    print(render_pairs(analyze_dxp.snapshot_profile(), options.pairs))
+
+if __name__ == "__main__":
+    main()